@@ -16,12 +16,21 @@
 #include "common/uart_io.hpp"
 #include "common/adc_io.hpp"
 #include "common/trb_io.hpp"
+#include "common/prof.hpp"
+#include "common/sched.hpp"
 
 namespace {
 
-	typedef device::trb_io<utils::null_task, uint8_t> TIMER_B;
+	// 0: A/D 変換と表示（周期）、1: UART の受信（イベント）
+	typedef utils::sched<2> SCHED;
+
+	typedef device::trb_io<SCHED::tick_task, uint8_t> TIMER_B;
 	TIMER_B	timer_b_;
 
+	// プロファイラー（Makefile で PROF_ENABLE を定義した場合だけ有効）
+	// 0: TIMER_RB_intr, 1: UART0_TX_intr, 2: UART0_RX_intr, 3: A/D 変換と表示
+	typedef utils::prof<TIMER_B, 4> PROF;
+
 	typedef utils::fifo<uint8_t, 16> TX_BUFF;  // 送信バッファ
 	typedef utils::fifo<uint8_t, 16> RX_BUFF;  // 受信バッファ
 	typedef device::uart_io<device::UART0, TX_BUFF, RX_BUFF> UART;
@@ -33,6 +42,44 @@ namespace {
 
 	typedef device::adc_io<utils::null_task> ADC;
 	ADC		adc_;
+
+	uint16_t	nnn_ = 0;
+
+	void adc_task_()
+	{
+		PROF_SCOPE(3);
+		adc_.scan();
+		adc_.sync();
+		// 「%3.2:8y」は小数点以下 8 ビットの固定小数点を 3 桁、小数点以下 2 桁表示
+		//   5V の場合 1.25  倍して、小数点以下 8 ビットで、1023 で   5V 表示となる。
+		// 3.3V の場合 0.825 倍して、小数点以下 8 ビットで、1023 で 3.3V 表示となる。
+		{
+			auto v = adc_.get_value(0);
+			utils::format("(%5d) CH0: %3.2:8y[V], %d\n")
+				% nnn_
+				% static_cast<uint16_t>(((v + 1) * VCC) / (1024 * 10 / 256))
+				% v;
+		}
+
+		{
+			auto v = adc_.get_value(1);
+			utils::format("        CH1: %3.2:8y[V], %d\n")
+				% static_cast<uint16_t>(((v + 1) * VCC) / (1024 * 10 / 256))
+				% v;
+		}
+		++nnn_;
+	}
+
+	void uart_task_()
+	{
+		while(uart_.length() != 0) {  // UART のレシーブデータがあるか？
+			auto ch = uart_.getch();
+			uart_.putch(ch);
+			if(ch == '?') {  // プロファイルの表を出す
+				PROF::dump(uart_);
+			}
+		}
+	}
 }
 
 extern "C" {
@@ -58,17 +105,21 @@ extern "C" {
 
 
 	void TIMER_RB_intr(void) {
+		PROF_SCOPE(0);
 		timer_b_.itask();
 	}
 
 
 	void UART0_TX_intr(void) {
+		PROF_SCOPE(1);
 		uart_.isend();
 	}
 
 
 	void UART0_RX_intr(void) {
+		PROF_SCOPE(2);
 		uart_.irecv();
+		SCHED::post(1);
 	}
 
 }
@@ -93,6 +144,7 @@ int main(int argc, char *argv[])
 	{
 		uint8_t ir_level = 2;
 		timer_b_.start(60, ir_level);
+		PROF::start(timer_b_);
 	}
 
 	// UART の設定 (P1_4: TXD0[out], P1_5: RXD0[in])
@@ -113,39 +165,8 @@ int main(int argc, char *argv[])
 		adc_.start(ADC::CH_TYPE::CH0_CH1, ADC::CH_GROUP::AN0_AN1, true);
 	}
 
-	uint8_t cnt = 0;
-	uint16_t nnn = 0;
-	while(1) {
-		timer_b_.sync();
-
-		++cnt;
-		if(cnt >= 30) {
-			cnt = 0;
-			adc_.scan();
-			adc_.sync();
-			// 「%3.2:8y」は小数点以下 8 ビットの固定小数点を 3 桁、小数点以下 2 桁表示
-			//   5V の場合 1.25  倍して、小数点以下 8 ビットで、1023 で   5V 表示となる。
-			// 3.3V の場合 0.825 倍して、小数点以下 8 ビットで、1023 で 3.3V 表示となる。
-			{
-				auto v = adc_.get_value(0);
-				utils::format("(%5d) CH0: %3.2:8y[V], %d\n")
-					% nnn
-					% static_cast<uint16_t>(((v + 1) * VCC) / (1024 * 10 / 256))
-					% v;
-			}
-
-			{
-				auto v = adc_.get_value(1);
-				utils::format("        CH1: %3.2:8y[V], %d\n")
-					% static_cast<uint16_t>(((v + 1) * VCC) / (1024 * 10 / 256))
-					% v;
-			}
-			++nnn;
-		}
-
-		if(uart_.length() != 0) {  // UART のレシーブデータがあるか？
-			auto ch = uart_.getch();
-			uart_.putch(ch);
-		}
-	}
+	// A/D 変換は、３０ティック（0.5 秒）毎、受信は、割り込みから直ぐ
+	SCHED::set_periodic(0, adc_task_, 30, 30);
+	SCHED::set_event(1, uart_task_);
+	SCHED::run();
 }
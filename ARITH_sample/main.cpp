@@ -14,6 +14,7 @@
 #include "common/trb_io.hpp"
 #include "common/command.hpp"
 #include "common/format.hpp"
+#include "common/fixed_point.hpp"
 #include "common/basic_arith.hpp"
 
 namespace {
@@ -29,7 +30,8 @@ namespace {
 	typedef utils::command<64> COMMAND;
 	COMMAND		command_;
 
-	typedef utils::basic_arith<int32_t> ARITH;
+	// 固定小数点 (Q16.16) で評価する（浮動小数点ライブラリー不要）
+	typedef utils::basic_arith<utils::q16_16> ARITH;
 	ARITH		arith_;
 }
 
@@ -122,7 +124,7 @@ int main(int argc, char *argv[])
 				utils::format("Error: %04X\n") % static_cast<uint16_t>(err());
 			} else {
 				auto v = arith_.get();
-				utils::format("Ans: %d\n") % v;
+				utils::format("Ans: %.4y\n") % v;
 			}
 		}
 	}
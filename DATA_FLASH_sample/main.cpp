@@ -13,6 +13,7 @@
 #include "common/uart_io.hpp"
 #include "common/trb_io.hpp"
 #include "common/flash_io.hpp"
+#include "common/flash_log.hpp"
 #include "common/command.hpp"
 
 namespace {
@@ -30,6 +31,10 @@ namespace {
 	typedef device::flash_io FLASH;
 	FLASH	flash_;
 
+	// キー／値ストア（BANK0/BANK1 を使う）
+	typedef utils::flash_log<FLASH, 8> FLASH_LOG;
+	FLASH_LOG	flash_log_(flash_);
+
 	typedef utils::command<64> COMMAND;
 	COMMAND	command_;
 
@@ -170,6 +175,10 @@ int main(int argc, char *argv[])
 
 	sci_puts("Start R8C DATA-FLASH monitor\n");
 
+	if(!flash_log_.start()) {
+		sci_puts("Flash log start error...\n");
+	}
+
 	command_.set_prompt("# ");
 
 	uint8_t cnt = 0;
@@ -228,10 +237,44 @@ int main(int argc, char *argv[])
 						}
 					}
 				}
+			} else if(command_.cmp_word(0, "set") && command_.get_words() >= 2) {
+				char tmp[8];
+				uint8_t buf[16];
+				uint8_t len = 0;
+				command_.get_word(1, sizeof(tmp), tmp);
+				uint8_t key = get_hexadecimal_(tmp);
+				for(uint16_t i = 2; i < command_.get_words() && len < sizeof(buf); ++i) {
+					if(command_.get_word(i, sizeof(tmp), tmp)) {
+						buf[len] = get_hexadecimal_(tmp);
+						++len;
+					}
+				}
+				if(!flash_log_.write(key, buf, len)) {
+					sci_puts("Set error...\n");
+				}
+			} else if(command_.cmp_word(0, "get") && command_.get_words() >= 2) {
+				char tmp[8];
+				uint8_t buf[16];
+				command_.get_word(1, sizeof(tmp), tmp);
+				uint8_t len = flash_log_.read(get_hexadecimal_(tmp), buf, sizeof(buf));
+				for(uint8_t i = 0; i < len; ++i) {
+					sci_putch(' ');
+					put_hexadecimal_byte_(buf[i]);
+				}
+				sci_putch('\n');
+			} else if(command_.cmp_word(0, "log")) {
+				sci_puts("bank");
+				put_hexadecimal_(flash_log_.get_bank());
+				sci_puts(", free ");
+				put_hexadecimal_word_(flash_log_.get_free());
+				sci_putch('\n');
 			} else if(command_.cmp_word(0, "?") || command_.cmp_word(0, "help")) {
 				sci_puts("dump xxxx [end]\n");
 				sci_puts("erase bank[01]\n");
+				sci_puts("get key\n");
+				sci_puts("log\n");
 				sci_puts("r xxxx\n");
+				sci_puts("set key [yy ...]\n");
 				sci_puts("write xxxx yy ...\n");
 				sci_puts("help\n");
 			} else {
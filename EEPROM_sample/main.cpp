@@ -167,11 +167,7 @@ namespace {
 			uint32_t val;
 			if(get_decimal_(1, val)) {
 				if(val >= 10 && val <= 1000) {
-					uint8_t clock = 1000 / val;
-					if(clock & 1) ++clock;
-					clock >>= 1;
-					if(clock == 0) clock = 1;
-					i2c_.set_clock(clock);
+					i2c_.set_rate(val * 1000);
 				} else {
 					sci_puts("Invalid SPEED renge.\n");
 				}
@@ -18,7 +18,7 @@
 #include "common/trb_io.hpp"
 #include "common/spi_io.hpp"
 #include "chip/ST7565.hpp"
-#include "common/monograph.hpp"
+#include "common/page_plot.hpp"
 
 namespace {
 
@@ -49,23 +49,7 @@ namespace {
 	typedef chip::ST7565<SPI, LCD_SEL, LCD_A0, LCD_RES> LCD;
 	LCD 	lcd_(spi_);
 
-	class PLOT {
-	public:
-		typedef int8_t value_type;
-
-		static const int8_t WIDTH  = 128;
-		static const int8_t HEIGHT = 64;
-
-		void clear(uint8_t v = 0)
-		{
-		} 
-
-		void operator() (int8_t x, int8_t y, bool val)
-		{
-			if(x < 0 || x >= WIDTH) return;
-			if(y < 0 || y >= HEIGHT) return;
-		}
-	};
+	typedef graphics::page_plot<128, 32> PLOT;
 
 	graphics::kfont_null kfont_;
 	graphics::monograph<PLOT> bitmap_(kfont_);
@@ -188,11 +172,16 @@ int main(int argc, char *argv[])
 	uint16_t xx;
 	uint16_t yy;
 	uint8_t loop = 20;
+	uint32_t lcd_bytes = 0;
 	while(1) {
 		timer_b_.sync();
-///		lcd_.copy(bitmap_.fb(), bitmap_.page_num());
+		// 変更のあった範囲だけを転送
+		lcd_bytes += bitmap_.at_plot().flush(lcd_);
 
 		if(loop >= 20) {
+			utils::format("LCD: %d bytes / 20 frames (full: %d)\n")
+				% lcd_bytes % (20 * (PLOT::WIDTH + PLOT::SEGMENT_CMD_BYTES) * PLOT::PAGE_NUM);
+			lcd_bytes = 0;
 			loop = 0;
 			bitmap_.clear(0);
 			bitmap_.frame(0, 0, 128, 32, 1);
@@ -33,7 +33,8 @@ namespace {
 
 	typedef device::iica_io<sda_port, scl_port> iica;
 	iica i2c_;
-	chip::MPU6050<iica> mpu6050_(i2c_);
+	typedef chip::MPU6050<iica> MPU6050;
+	MPU6050 mpu6050_(i2c_);
 
 	utils::command<64> command_;
 }
@@ -141,14 +142,14 @@ int main(int argc, char *argv[])
 		if(n >= 60) {
 			n = 0;
 
-			auto a = mpu6050_.get_accel();
-			utils::format("ACCEL: %d, %d, %d\n") % a.x % a.y % a.z;
-
-			auto t = mpu6050_.get_temp();
-			utils::format("TEMP:  %d.%1d\n") % (t / 10) % (t % 10);
-
-			auto g = mpu6050_.get_gyro();
-			utils::format("GYRO:  %d, %d, %d\n") % g.x % g.y % g.z;
+			MPU6050::int16_vec a;
+			int16_t t;
+			MPU6050::int16_vec g;
+			if(mpu6050_.get_motion(a, t, g)) {
+				utils::format("ACCEL: %d, %d, %d\n") % a.x % a.y % a.z;
+				utils::format("TEMP:  %d.%1d\n") % (t / 10) % (t % 10);
+				utils::format("GYRO:  %d, %d, %d\n") % g.x % g.y % g.z;
+			}
 		}
 
 		// コマンド入力と、コマンド解析
@@ -0,0 +1,96 @@
+//=====================================================================//
+/*!	@file
+	@brief	R8C バイナリー・パケット通信サンプル @n
+			・COBS フレーム + CRC-16 @n
+			・受信したフレームのペイロードを、そのまま送り返す @n
+			・ホスト側は「packet_term」を使う @n
+			P1_0: LED1 @n
+			P1_1: LED2 @n
+			P1_4: TXD(output) @n
+			P1_5: RXD(input)
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/renesas.hpp"
+
+#include "common/uart_io.hpp"
+#include "common/fifo.hpp"
+#include "common/packet_io.hpp"
+
+namespace {
+
+	typedef device::PORT<device::PORT1, device::bitpos::B0, false> LED0;
+	typedef device::PORT<device::PORT1, device::bitpos::B1, false> LED1;
+
+	typedef utils::fifo<uint8_t, 64> TX_BUFF;  // 送信バッファ
+	typedef utils::fifo<uint8_t, 64> RX_BUFF;  // 受信バッファ
+	typedef device::uart_io<device::UART0, TX_BUFF, RX_BUFF> UART;
+	UART uart_;
+
+	typedef utils::packet_io<UART> PACKET;
+	PACKET packet_(uart_);
+
+	// ペイロード最大６４バイト＋CRC
+	uint8_t packet_buff_[64 + PACKET::CRC_SIZE];
+}
+
+extern "C" {
+
+	void UART0_TX_intr(void) {
+		uart_.isend();
+	}
+
+
+	void UART0_RX_intr(void) {
+		uart_.irecv();
+	}
+
+};
+
+
+int main(int argc, char *argv[])
+{
+	using namespace device;
+
+// クロック関係レジスタ・プロテクト解除
+	PRCR.PRC0 = 1;
+
+// 高速オンチップオシレーターへ切り替え(20MHz)
+// ※ F_CLK を設定する事（Makefile内）
+	OCOCR.HOCOE = 1;
+	utils::delay::micro_second(1);  // >=30us(125KHz)
+	SCKCR.HSCKSEL = 1;
+	CKSTPR.SCKSEL = 1;
+
+	// UART の設定 (P1_4: TXD0[out], P1_5: RXD0[in])
+	{
+		utils::PORT_MAP(utils::port_map::P14::TXD0);
+		utils::PORT_MAP(utils::port_map::P15::RXD0);
+		uint8_t intr_level = 1;
+		uart_.start(115200, intr_level);
+	}
+
+	// LED ポート設定
+	{
+		LED0::DIR = 1;
+		LED1::DIR = 1;
+		LED0::P = 0;
+		LED1::P = 0;
+	}
+
+	packet_.set_buffer(packet_buff_, sizeof(packet_buff_));
+
+	uint8_t cnt = 0;
+	while(1) {
+		if(packet_.service()) {
+			// 受信バッファ上のペイロードを、そのまま送り返す
+			packet_.send(packet_buff_, packet_.get_length());
+			++cnt;
+			LED0::P = (cnt & 1) != 0;
+		}
+		LED1::P = packet_.get_crc_error() != 0 || packet_.get_frame_error() != 0;
+	}
+}
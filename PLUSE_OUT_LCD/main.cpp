@@ -20,7 +20,7 @@
 #include "common/trj_io.hpp"
 #include "common/spi_io.hpp"
 #include "chip/ST7565.hpp"
-#include "common/monograph.hpp"
+#include "common/page_plot.hpp"
 
 #include "bitmap/font32.h"
 
@@ -123,32 +123,7 @@ namespace {
 	typedef chip::ST7565<SPI, LCD_SEL, LCD_A0, LCD_RES> LCD;
 	LCD 	lcd_(spi_);
 
-	class PLOT {
-	public:
-		typedef int16_t value_type;
-
-		static const int16_t WIDTH  = 128;
-		static const int16_t HEIGHT = 32;
-
-	private:
-		uint8_t	fb_[WIDTH * HEIGHT / 8];
-
-	public:
-		void clear(uint8_t v = 0)
-		{
-			for(uint16_t i = 0; i < (WIDTH * HEIGHT / 8); ++i) {
-				fb_[i] = v;
-			}
-		} 
-
-		uint8_t* fb() { return fb_; }
-
-		void operator() (int16_t x, int16_t y, bool val)
-		{
-			if(x < 0 || x >= WIDTH) return;
-			if(y < 0 || y >= HEIGHT) return;
-		}
-	};
+	typedef graphics::page_plot<128, 32> PLOT;
 
 	graphics::kfont_null kfont_;
 	graphics::monograph<PLOT> bitmap_(kfont_);
@@ -270,6 +245,7 @@ int main(int argc, char *argv[])
 
 	uint8_t cnt = 0;
 	uint32_t value = 0;
+	uint8_t disp[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };  // 表示中の桁、単位
 	while(1) {
 		timer_b_.sync();
 
@@ -315,29 +291,36 @@ int main(int argc, char *argv[])
 
 		// 1/15 sec
 		if((cnt & 15) == 0) {
-			bitmap_.clear(0);
 			uint32_t n = count;
 			bool khz = false;
 			if(n > 99999) {
 				n /= 1000;
 				khz = true;
 			}
-			bitmap_.draw_mobj(20 * 4, 0, nmbs_[n % 10]);
-			n /= 10;
-			bitmap_.draw_mobj(20 * 3, 0, nmbs_[n % 10]);
-			n /= 10;
-			bitmap_.draw_mobj(20 * 2, 0, nmbs_[n % 10]);
-			n /= 10;
-			bitmap_.draw_mobj(20 * 1, 0, nmbs_[n % 10]);
-			n /= 10;
-			bitmap_.draw_mobj(20 * 0, 0, nmbs_[n % 10]);
-			if(khz) {
-				bitmap_.draw_mobj(20 * 5, 0, nmbs_[11]);
-				bitmap_.draw_mobj(20 * 5 + 11, 0, nmbs_[10]);
-			} else {
-				bitmap_.draw_mobj(20 * 5, 0, nmbs_[10]);
+			// 変化した桁だけを書き換え、変更範囲だけを転送する
+			for(int8_t i = 4; i >= 0; --i) {
+				uint8_t d = n % 10;
+				n /= 10;
+				if(disp[i] != d) {
+					disp[i] = d;
+					bitmap_.fill(20 * i, 0, 20, 32, 0);
+					bitmap_.draw_mobj(20 * i, 0, nmbs_[d]);
+				}
+			}
+			if(disp[5] != khz) {
+				disp[5] = khz;
+				bitmap_.fill(20 * 5, 0, 128 - 20 * 5, 32, 0);
+				if(khz) {
+					bitmap_.draw_mobj(20 * 5, 0, nmbs_[11]);
+					bitmap_.draw_mobj(20 * 5 + 11, 0, nmbs_[10]);
+				} else {
+					bitmap_.draw_mobj(20 * 5, 0, nmbs_[10]);
+				}
+			}
+			auto bytes = bitmap_.at_plot().flush(lcd_);
+			if(bytes > 0) {
+				utils::format("LCD: %d bytes\n") % bytes;
 			}
-			lcd_.copy(bitmap_.at_plot().fb(), 4);
 		}
 
 		++cnt;
@@ -0,0 +1,58 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	DPCM サンプル（psg_render で生成） @n
+			dpcm_kick, 566 bytes, 9420 Hz, 4 bits
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/psg_mng.hpp"
+
+namespace {
+
+	constexpr uint8_t dpcm_kick_data_[] = {
+		0x40,0x44,0x34,0x34,0x33,0x22,0x22,0x01,0xFF,0xDF,0xDF,0xDD,0xDD,0xDC,0xCC,0xDC,
+		0xDC,0xDC,0xDC,0xED,0xED,0x0D,0xFE,0x00,0x11,0x21,0x22,0x23,0x33,0x33,0x34,0x43,
+		0x33,0x33,0x34,0x32,0x23,0x23,0x12,0x02,0x01,0xF0,0xFF,0xEE,0xDE,0xDE,0xDE,0xDD,
+		0xED,0xDD,0xDD,0xDD,0xED,0xDD,0xEE,0xFD,0xFE,0xFF,0xFF,0x00,0x01,0x21,0x21,0x22,
+		0x22,0x32,0x32,0x32,0x23,0x23,0x33,0x32,0x32,0x22,0x22,0x22,0x22,0x11,0x01,0x01,
+		0xF0,0xF0,0xFF,0xFE,0xEE,0xEE,0xEE,0xFD,0xED,0xDE,0xEE,0xED,0xDE,0xDF,0xEF,0xEE,
+		0xEE,0xFE,0xFF,0xFF,0x0F,0x0F,0x00,0x01,0x11,0x11,0x11,0x12,0x22,0x22,0x22,0x22,
+		0x22,0x22,0x22,0x22,0x23,0x12,0x22,0x12,0x12,0x21,0x11,0x10,0x01,0x01,0x00,0xF0,
+		0xF0,0xF0,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xEE,0xFE,0xEE,0xEE,0xEF,0xFE,0xEE,0xEF,
+		0xEF,0xFF,0xFE,0xFF,0xFF,0xF0,0x0F,0xF0,0x00,0x00,0x10,0x00,0x01,0x11,0x01,0x11,
+		0x11,0x12,0x11,0x12,0x21,0x21,0x11,0x12,0x12,0x21,0x21,0x11,0x11,0x12,0x11,0x01,
+		0x11,0x01,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0xFF,0xF0,0xFF,0xFF,
+		0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xFF,
+		0xF0,0xF0,0x00,0x0F,0xF0,0x00,0x00,0x00,0x10,0x00,0x10,0x10,0x10,0x10,0x10,0x01,
+		0x11,0x01,0x11,0x11,0x01,0x11,0x11,0x11,0x11,0x10,0x11,0x11,0x10,0x11,0x10,0x01,
+		0x11,0x10,0x10,0x00,0x01,0x10,0x00,0x00,0x10,0x00,0xF0,0x00,0x00,0xF0,0x00,0x0F,
+		0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,
+		0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,
+		0x10,0x00,0x00,0x00,0x01,0x00,0x01,0x10,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+		0x01,0x01,0x01,0x01,0x01,0x11,0x10,0x10,0x00,0x01,0x01,0x01,0x10,0x10,0x00,0x10,
+		0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,
+		0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0xF0,0x00,0x0F,0x0F,0xF0,0xF0,0xF0,0x00,0x0F,
+		0x0F,0xF0,0x00,0x0F,0x0F,0x00,0x0F,0xF0,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x00,
+		0x0F,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x01,0x00,0x01,0x00,
+		0x01,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x00,0x01,
+		0x10,0x00,0x10,0x00,0x00,0x01,0x00,0x10,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,
+		0x0F,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,
+		0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x00,
+		0x01,0x00,0x10,0x00,0x00,0x01,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x01,0x00,0x00,
+		0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,
+		0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
+		0x0F,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x01,
+	};
+
+	constexpr utils::psg_base::DPCM dpcm_kick_ = {
+		dpcm_kick_data_, sizeof(dpcm_kick_data_), 65, true
+	};
+}
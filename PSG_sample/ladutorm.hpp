@@ -0,0 +1,153 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	PSG スコア（psg_mml で ladutorm.mml から生成） @n
+			ladutorm, 663 bytes（従来形式 1630 bytes）, sub 8
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/psg_mng.hpp"
+
+namespace {
+
+	typedef utils::psg_base PSG;
+
+	constexpr PSG::SCORE ladutorm_s0_[] = {
+		0xAF, 0x37, 8, 0xA5, 0xA9, 0xA3, 0xAB, 0xA2, 0xAC, 0xD0, 0xFF, 0x38, 8, 0xA6, 0xA8, 0xA4,
+		0xAA, 0xA2, 0xAC, 0xD1, 0xFF, 0x3A, 8, 0xA5, 0xA9, 0xA4, 0xAA, 0xA1, 0xAD, 0xC5, 0xC9, 0xC9,
+		0xA5, 0xA5, 0xC6, 0xA3, 0xAB, 0xC5, 0xC8, 0x37, 64, 0xAF, 0x8C, 0x86, 0xA8, 0x82, 0x86, 0xA8,
+		0x83, 0x86, 0xA8, 0xA4, 0xAF, 0x3C, 4, 0x86, 0xA8, 0x82, 0x86, 0xA8, 0x83, 0x86, 0xA8, 0xA4,
+		0xA9, 0xA3, 0xAC, 0xA2, 0x38, 8, 0x30, 8, 0xAA, 0xA4, 0xAE, 0x2B, 8, 0xAB, 0xAA, 0xAC,
+		0x2E, 8,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s1_[] = {
+		0x18, 8, 0xAA, 0xAB, 0xAC, 0xA5, 0xA5, 0xA6, 0xA5, 0x29, 8, 0xA5, 0xA9, 0xA4, 0xAA, 0xA2,
+		0xAC, 0xA1, 0xA3, 0xAB, 0xAA, 0xAC, 0x1F, 8, 0xA9, 0xA9, 0xA8, 0xAE, 0xA5, 0xA9, 0xA4, 0xAA,
+		0xA0, 0xAE, 0xA5, 0xA2, 0xAE, 0xA0, 0x2C, 8, 0x24, 8, 0xAE, 0xA5, 0xA5, 0xA2, 0x2B, 8,
+		0x22, 8, 0xAB, 0xAD, 0x24, 8, 0x2D, 8, 0xA9, 0x1F, 8, 0xAB, 0xAA, 0xAC, 0xA5, 0xA5,
+		0xA6, 0xA5, 0x8A, 0x86, 0xA8, 0x87, 0x86, 0xA8, 0x8A, 0x88, 0xA7,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s2_[] = {
+		0x37, 8, 0xAF, 0x8C, 0x86, 0xA8, 0x83, 0x86, 0xA8, 0x84, 0x86, 0xA8, 0xA2, 0xAF, 0x3C, 4,
+		0x86, 0xA8, 0x83, 0x86, 0xA8, 0x84, 0x86, 0xA8, 0xA2, 0xA9, 0xA3, 0xAC, 0xA2, 0x38, 8, 0x30, 8,
+		0xAA, 0xAC, 0xA6, 0xA0, 0xA6, 0xA4, 0xA6, 0xA5, 0xA5, 0xA6,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s3_[] = {
+		0x2C, 4, 0x86, 0xA8, 0xA4, 0xA5, 0x8C, 0x86, 0xA8, 0x84, 0x86, 0xA8, 0x8A, 0x86, 0xA8, 0xA4,
+		0x20, 16, 0xC6, 0xE5, 0xC9, 0xFF,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s4_[] = {
+		0x30, 8, 0xAD, 0xA1, 0xA4, 0xAA, 0xAD, 0xA1, 0xA4, 0xAA, 0xAE, 0xA2, 0xA4, 0xAA, 0xAC, 0xA2,
+		0xA4, 0xAA,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s5_[] = {
+		0x20, 16, 0xC6, 0xC5, 0xC8, 0xE8, 0xEC, 0xA0, 0x2C, 4, 0x86, 0xA8, 0x84, 0x86,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s6_[] = {
+		0x31, 8, 0xA3, 0xAB,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_s7_[] = {
+		PSG::CTRL::VOLUME, 128,
+		PSG::CTRL::SQ50,
+		PSG::CTRL::TEMPO, 80,
+		PSG::CTRL::ATTACK, 175,
+		PSG::CTRL::RET,
+	};
+
+	constexpr PSG::SCORE ladutorm_a_[] = {
+		PSG::CTRL::CALL7,
+		PSG::CTRL::CALL0,
+		0xAD,
+		PSG::CTRL::CALL2,
+		PSG::CTRL::CALL0,
+		0xAC,
+		PSG::CTRL::CALL2,
+		0xAF, 0x37, 8, 0xA5, 0xA9, 0xA3, 0xAB, 0xA2, 0xAC, 0xA0, 0xA6, 0xA8, 0xA9, 0xA9, 0xA8, 0xA9,
+		0xA4, 0xA8, 0xAA, 0xA6, 0xA8, 0xA4, 0xAA, 0xAB, 0xA3, 0xAA, 0xA5, 0xA6, 0xA8, 0xA9, 0xA8, 0xA9,
+		0xA4, 0xA9, 0xA3, 0xA2, 0xAC, 0x31, 8, 0xAA, 0xAC, 0xA2, 0xAE, 0xA4, 0xA4, 0xAA, 0x2F, 8,
+		0xAD, 0xAA, 0xA4, 0xAB, 0xA4, 0xA2, 0xAC, 0x2D, 8, 0xAB, 0xAC, 0xA2, 0xAD,
+		PSG::CTRL::CALL6,
+		0xA1, 0xA9, 0xAB, 0xA3, 0xCC, 0xC6, 0xC8, 0xCE, 0x2A, 8, 0xA5, 0xA9, 0xA8, 0xA9, 0xA9, 0xA8,
+		0xA4, 0xAF, 0xA9, 0xA5, 0xA9, 0xA3, 0xAB, 0xA2, 0xAA, 0xA5, 0xA6, 0xA8, 0xA9, 0xA9, 0xA8, 0xA9,
+		0xA4, 0xAC, 0xA3, 0xA2, 0xAC, 0xAB, 0xA3, 0xA2,
+		PSG::CTRL::CALL4,
+		0xAC, 0x43, 8, 0xA5, 0xA5, 0xA6, 0xA5, 0xA6, 0xA3, 0xA4, 0xA4, 0xA4, 0xA3, 0x34, 8, 0x2A, 8,
+		0xAB, 0xAA, 0xAB, 0xA2, 0xA3, 0xAB, 0xAC, 0xA2, 0xA3,
+		PSG::CTRL::CALL4,
+		0xAD, 0xA3, 0xA2, 0xAC, 0xAB, 0xA3, 0xA2, 0xAC, 0xAC, 0xA2, 0xA0, 0xAE, 0xAC, 0xA2, 0xA0, 0xAE,
+		0xAD, 0xA1, 0xA4, 0xAA, 0xAD, 0xA1, 0xA4, 0xAA, 0xAE, 0x2F, 8, 0xA5, 0xA5, 0xA6, 0xA5, 0xA6,
+		0xA3, 0xAF, 0x3B, 8, 0xA5, 0xA9, 0xA3, 0xAB, 0xA2, 0xAC, 0xA0, 0x3D, 8, 0xA5, 0xA9, 0xA3,
+		0xAB, 0xA1, 0xAD, 0xA0, 0x3E, 8, 0xA5, 0xA9, 0xA2, 0xAC, 0xA2, 0xAC, 0xA0, 0xA6, 0xA8, 0xA9,
+		0xA9, 0xA8, 0xA9, 0xA4,
+		PSG::CTRL::END,
+	};
+
+	constexpr PSG::SCORE ladutorm_b_[] = {
+		PSG::CTRL::CALL7,
+		0x18, 8, 0x58, 64,
+		PSG::CTRL::CALL1,
+		0xA3, 0xA2, 0x8C, 0x86, 0xA8, 0x87, 0x86, 0xAC, 0x86, 0x88, 0xA7, 0xA3,
+		PSG::CTRL::CALL5,
+		0xA9,
+		PSG::CTRL::CALL3,
+		0xC0, 0x58, 56,
+		PSG::CTRL::CALL1,
+		0x1B, 8, 0x24, 8, 0x8A, 0x86, 0xA8, 0x87, 0x86, 0xA8, 0x8A, 0x88, 0xA7, 0x1B, 8,
+		PSG::CTRL::CALL5,
+		0xA8,
+		PSG::CTRL::CALL3,
+		0xCC, 0x58, 176, 0x32, 8, 0xA5, 0xA6, 0xA8, 0xA9, 0xA8, 0xA9, 0xA4, 0xA9,
+		PSG::CTRL::CALL6,
+		0x28, 8,
+		PSG::CTRL::CALL6,
+		0xA2, 0x35, 8, 0xA3, 0xAB, 0x2C, 8, 0xAC, 0xAB, 0xA3, 0xA0,
+		PSG::CTRL::CALL6,
+		0xA0,
+		PSG::CTRL::CALL6,
+		0x28, 8, 0xAC, 0x25, 8, 0x2D, 8, 0xA2, 0xA4, 0x2D, 8, 0x25, 8, 0xA8, 0xA2, 0xA5,
+		0xA9, 0xA4, 0xAA, 0xA2, 0xAC, 0xA0, 0xA6, 0xA8, 0xA8, 0xAA, 0xA8, 0xA9, 0xA5, 0xA7, 0xAE, 0xA5,
+		0xA9, 0xA4, 0xAA, 0xA2, 0xAC, 0xA4, 0xA5, 0xA9, 0xA8, 0xA9, 0xA9, 0xA8, 0xA4, 0xC5, 0x18, 16,
+		0x24, 16, 0x18, 16, 0x21, 16, 0x15, 16, 0xCC, 0xC7, 0xCC, 0x13, 16, 0x1F, 16, 0x13, 16,
+		0x1F, 16, 0xFF, 0x2B, 16, 0xC7, 0xC7, 0xC7, 0xC5, 0xC7, 0xC7, 0xC7, 0xC5, 0xC7, 0xC7, 0xC7,
+		0xC6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC5, 0xC7, 0xC7, 0xC7, 0xC1, 0xC7, 0xC7, 0xC7,
+		0xA0, 0x23, 8, 0xA5, 0xA5, 0xA6, 0xA5, 0xA6, 0xA3, 0xCC, 0x58, 240,
+		PSG::CTRL::END,
+	};
+
+	constexpr const PSG::SCORE* ladutorm_sub_[8] = {
+		ladutorm_s0_, ladutorm_s1_, ladutorm_s2_, ladutorm_s3_, ladutorm_s4_, ladutorm_s5_, ladutorm_s6_, ladutorm_s7_
+	};
+
+	constexpr const PSG::SCORE* ladutorm_score_[2] = {
+		ladutorm_a_, ladutorm_b_
+	};
+
+	// サブ・スコアと、チャネル毎のスコアを設定して、演奏を開始
+	template <class PSG_MNG>
+	void ladutorm_start_(PSG_MNG& psg)
+	{
+		for(uint8_t i = 0; i < 8; ++i) {
+			psg.set_sub_score(i, ladutorm_sub_[i]);
+		}
+		for(uint8_t i = 0; i < 2; ++i) {
+			if(ladutorm_score_[i] != nullptr) psg.set_score(i, ladutorm_score_[i]);
+		}
+	}
+}
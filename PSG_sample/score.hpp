@@ -0,0 +1,62 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	PSG サンプル楽曲（スコア） @n
+			ターゲット（main.cpp）と、ホスト・ツール（host_bench、psg_render）で共有する
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2021 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/psg_mng.hpp"
+#include "dpcm_kick.hpp"
+// ドラゴンクエスト１・ラダトーム城（ladutorm.mml から psg_mml で生成）
+#include "ladutorm.hpp"
+
+namespace {
+
+	typedef utils::psg_base PSG;
+
+	constexpr PSG::SCORE score_test_[] = {
+		PSG::CTRL::VOLUME, 128,
+		PSG::CTRL::TRI,
+		PSG::CTRL::TEMPO,1,
+		PSG::CTRL::FOR,100,
+		PSG::KEY::A_4, 128,
+		PSG::CTRL::BEFORE,
+		PSG::CTRL::REPEAT
+	};
+
+	// ドラム（DPCM のキック、ノイズのスネアとハイハット） @n
+	// ノイズ、DPCM では、キーの位置に周期番号（0 〜 15）を書く
+	constexpr PSG::SCORE score_drum_[] = {
+		PSG::CTRL::VOLUME, 128,
+		PSG::CTRL::TEMPO, 80,
+		PSG::CTRL::ATTACK, 255,
+		PSG::CTRL::FOR, 16,
+		PSG::CTRL::DPCM, 0,
+		8, 8,  // キック（9420Hz）
+		PSG::CTRL::NOISE_S,
+		PSG::CTRL::RELEASE, 23, 96,
+		0, 8,  // ハイハット
+		PSG::CTRL::NOISE,
+		PSG::CTRL::RELEASE, 21, 40,
+		5, 8,  // スネア
+		PSG::CTRL::NOISE_S,
+		PSG::CTRL::RELEASE, 23, 96,
+		0, 8,  // ハイハット
+		PSG::CTRL::DPCM, 0,
+		8, 8,  // キック
+		8, 8,  // キック
+		PSG::CTRL::NOISE,
+		PSG::CTRL::RELEASE, 21, 40,
+		5, 8,  // スネア
+		PSG::CTRL::NOISE_S,
+		PSG::CTRL::RELEASE, 10, 96,
+		0, 4,  // ハイハット
+		0, 4,  // ハイハット
+		PSG::CTRL::BEFORE,
+		PSG::CTRL::END
+	};
+}
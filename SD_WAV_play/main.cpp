@@ -22,9 +22,6 @@
 
 namespace {
 
-	typedef device::trb_io<utils::null_task, uint8_t> timer_b;
-	timer_b timer_b_;
-
 	typedef device::trc_io<utils::null_task> timer_c;
 	timer_c timer_c_;
 
@@ -55,6 +52,10 @@ namespace {
 	};
 
 	typedef device::trb_io<wave_out, uint8_t> timer_audio;
+	timer_audio timer_b_;
+
+	// 出力の最大サンプルレート（これを超えるファイルは整数比で間引く）
+	static const uint32_t out_rate_max_ = 22050;
 
 	audio::wav_in wav_in_;
 
@@ -143,28 +144,21 @@ extern "C" {
 
 static void play_wav_()
 {
-//	uint32_t pos = 0;
-	uint16_t n = 0;
-//	while(pos < wav_in_.get_size()) {
+	timer_b_.start(wav_in_.get_out_rate(), 2);
 	while(1) {
 		uint8_t d;
 		do {
 			timer_b_.sync();
 			d = wave_get_ - wave_put_;
 		} while(d < 128) ;
-		UINT br;
-		if(pf_read(&wave_buff_[wave_put_], 128 * 2, &br) == FR_OK) {
-			if(br == 0) break;
-			wave_put_ += 128;
-//			pos += 256;
-//			++n;
-//			if(n >= (11025 / 128)) {
-//				n = 0;
-//				sci_putch('.');
-//			}
-		} else {
-			break;
+		// 補充毎に１２８フレームをデコード
+		uint16_t n = wav_in_.render(&wave_buff_[wave_put_], 128);
+		for(uint16_t i = n; i < 128; ++i) {
+			wave_buff_[wave_put_ + i].left  = 128;
+			wave_buff_[wave_put_ + i].right = 128;
 		}
+		wave_put_ += 128;
+		if(n < 128) break;
 	}
 	clear_wave_();
 }
@@ -271,19 +265,15 @@ int main(int argc, char *argv[])
 				sci_puts("WAV file header error: '");
 				sci_puts(file_name);
 				sci_puts("'\n");		
-			} else if(wav_in_.get_chanel() != 2) {
-				utils::format("WAV chanel error(2): %d '%s'\n")
-					% static_cast<uint32_t>(wav_in_.get_chanel()) % file_name;
-			} else if(wav_in_.get_rate() != 11025) {
-				utils::format("WAV sample rate error(11025): %d '%s'\n")
-					% static_cast<uint32_t>(wav_in_.get_rate()) % file_name;
-			} else if(wav_in_.get_bits() != 8) {
-				utils::format("WAV sample bits error(8): %d '%s'\n")
-					% static_cast<uint32_t>(wav_in_.get_bits()) % file_name;
+			} else if(!wav_in_.start(out_rate_max_)) {
+				utils::format("WAV format error: %04X, %d ch, %d bits, %d Hz '%s'\n")
+					% static_cast<uint32_t>(wav_in_.get_format())
+					% static_cast<uint32_t>(wav_in_.get_chanel())
+					% static_cast<uint32_t>(wav_in_.get_bits())
+					% wav_in_.get_rate() % file_name;
 			} else {
-				sci_puts("Play WAVE: '");
-				sci_puts(file_name);
-				sci_puts("'\n");
+				utils::format("Play WAVE: '%s' (%d Hz -> %d Hz)\n")
+					% file_name % wav_in_.get_rate() % wav_in_.get_out_rate();
 				play_wav_();
 			}
 		}
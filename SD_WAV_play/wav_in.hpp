@@ -1,6 +1,14 @@
+#pragma once
 //=====================================================================//
 /*!	@file
-	@brief	WAV 音声ファイルを扱うクラス
+	@brief	WAV 音声ファイルを扱うクラス @n
+			・PCM（8/16 ビット）、IMA-ADPCM（4 ビット）@n
+			・モノラル、ステレオ（モノラルは、左右に複製）@n
+			・16 ビットは、ディザーを加えて 8 ビットへ @n
+			・整数比の間引き（平均）で、サンプルレートを下げる @n
+			デコードは、render() の呼び出し（バッファの補充）毎に行い、@n
+			１フレームの処理量は、間引き数 x（PCM: 読み出し、ADPCM: ニブル展開）@n
+			で上限が決まる。
 	@author	平松邦仁 (hira@rvf-rc45.net)
 */
 //=====================================================================//
@@ -35,16 +43,177 @@ namespace audio {
 			uint16_t	usBlockAlign;
 			uint16_t	usBitsPerSample;
 			uint16_t	usSize;
-			uint16_t	usReserved;
+			uint16_t	usReserved;		///< IMA-ADPCM ではブロック当たりのサンプル数
 			uint32_t	ulChannelMask;
 			uint32_t	guidSubFormat;
 		};
 
+	public:
+		static const uint16_t FORMAT_PCM = 0x0001;	///< リニア PCM
+		static const uint16_t FORMAT_IMA = 0x0011;	///< IMA-ADPCM（DVI-ADPCM）
+
+	private:
+		static const uint16_t FORMAT_EXT = 0xFFFE;	///< WAVE_FORMAT_EXTENSIBLE
+		static const uint8_t  IN_SIZE = 16;			///< 読み出しバッファ
+
 		uint32_t	data_size_;
 
 		uint32_t	rate_;
 		uint8_t		chanel_;
 		uint8_t		bits_;
+		uint16_t	format_;
+		uint16_t	align_;
+		uint16_t	spb_;		///< ADPCM ブロック当たりのサンプル数
+
+		// ストリーム
+		uint32_t	remain_;	///< data チャンクの残りバイト
+		uint8_t		in_[IN_SIZE];
+		uint8_t		in_pos_;
+		uint8_t		in_len_;
+
+		uint8_t		down_;		///< 間引き数
+		uint8_t		down_shift_;	///< 間引き数が２の累乗ならシフト数、以外は 0xff
+		bool		dither_;
+		uint16_t	rnd_;
+
+		// IMA-ADPCM
+		int16_t		pred_[2];
+		uint8_t		index_[2];
+		uint16_t	blk_left_;	///< ブロックの残りフレーム
+		uint8_t		grp_[8];	///< ８フレーム分のニブル（チャネル毎に４バイト）
+		uint8_t		grp_pos_;
+
+
+		bool get_byte_(uint8_t& d)
+		{
+			if(in_pos_ >= in_len_) {
+				if(remain_ == 0) return false;
+				UINT n = remain_ < IN_SIZE ? static_cast<UINT>(remain_) : IN_SIZE;
+				UINT br;
+				if(pf_read(in_, n, &br) != FR_OK || br == 0) {
+					remain_ = 0;
+					return false;
+				}
+				remain_ -= br;
+				in_len_ = br;
+				in_pos_ = 0;
+			}
+			d = in_[in_pos_++];
+			return true;
+		}
+
+
+		bool get_word_(int16_t& d)
+		{
+			uint8_t lo, hi;
+			if(!get_byte_(lo) || !get_byte_(hi)) return false;
+			d = static_cast<int16_t>(lo | (static_cast<uint16_t>(hi) << 8));
+			return true;
+		}
+
+
+		int16_t decode_(uint8_t ch, uint8_t nib)
+		{
+			static const int16_t step_tbl[89] = {
+				7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+				19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+				50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+				130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+				337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+				876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+				2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+				5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+				15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+			};
+			static const int8_t index_tbl[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+			int16_t step = step_tbl[index_[ch]];
+			int16_t diff = step >> 3;
+			if(nib & 1) diff += step >> 2;
+			if(nib & 2) diff += step >> 1;
+			if(nib & 4) diff += step;
+			int32_t p = pred_[ch];
+			if(nib & 8) p -= diff;
+			else p += diff;
+			if(p > 32767) p = 32767;
+			else if(p < -32768) p = -32768;
+			pred_[ch] = p;
+
+			int8_t idx = static_cast<int8_t>(index_[ch]) + index_tbl[nib & 7];
+			if(idx < 0) idx = 0;
+			else if(idx > 88) idx = 88;
+			index_[ch] = idx;
+			return p;
+		}
+
+
+		bool fetch_adpcm_(int16_t& l, int16_t& r)
+		{
+			if(blk_left_ == 0) {  // ブロック・ヘッダー（予測値、インデックス）
+				for(uint8_t ch = 0; ch < chanel_; ++ch) {
+					uint8_t idx, tmp;
+					if(!get_word_(pred_[ch]) || !get_byte_(idx) || !get_byte_(tmp)) return false;
+					index_[ch] = idx > 88 ? 88 : idx;
+				}
+				blk_left_ = spb_ - 1;
+				grp_pos_ = 8;
+				l = pred_[0];
+				r = pred_[chanel_ - 1];
+				return true;
+			}
+			if(grp_pos_ >= 8) {
+				for(uint8_t i = 0; i < (chanel_ * 4); ++i) {
+					if(!get_byte_(grp_[i])) return false;
+				}
+				grp_pos_ = 0;
+			}
+			uint8_t sh = (grp_pos_ & 1) << 2;
+			uint8_t i = grp_pos_ >> 1;
+			l = decode_(0, (grp_[i] >> sh) & 15);
+			if(chanel_ == 2) r = decode_(1, (grp_[4 + i] >> sh) & 15);
+			else r = l;
+			++grp_pos_;
+			--blk_left_;
+			return true;
+		}
+
+
+		bool fetch_(int16_t& l, int16_t& r)
+		{
+			if(format_ == FORMAT_IMA) return fetch_adpcm_(l, r);
+
+			if(bits_ == 8) {
+				uint8_t d;
+				if(!get_byte_(d)) return false;
+				l = static_cast<int16_t>(d - 128) << 8;
+				if(chanel_ == 2) {
+					if(!get_byte_(d)) return false;
+					r = static_cast<int16_t>(d - 128) << 8;
+				} else {
+					r = l;
+				}
+			} else {
+				if(!get_word_(l)) return false;
+				if(chanel_ == 2) {
+					if(!get_word_(r)) return false;
+				} else {
+					r = l;
+				}
+			}
+			return true;
+		}
+
+
+		uint8_t out_(int32_t v, uint16_t tpdf)
+		{
+			if(dither_) {
+				// 三角分布（-255 ～ +255）のディザー
+				v += static_cast<int16_t>((tpdf & 0xff) + (tpdf >> 8)) - 255;
+				if(v > 32767) v = 32767;
+				else if(v < -32768) v = -32768;
+			}
+			return static_cast<uint8_t>((v >> 8) + 128);
+		}
 
 	public:
 		//-----------------------------------------------------------------//
@@ -52,7 +221,9 @@ namespace audio {
 			@brief	コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		wav_in() : data_size_(0), rate_(0), chanel_(0), bits_(0) { }
+		wav_in() : data_size_(0), rate_(0), chanel_(0), bits_(0), format_(0), align_(0), spb_(0),
+			remain_(0), in_pos_(0), in_len_(0), down_(1), down_shift_(0), dither_(false), rnd_(1),
+			pred_{ 0 }, index_{ 0 }, blk_left_(0), grp_pos_(8) { }
 
 
 		//-----------------------------------------------------------------//
@@ -88,21 +259,100 @@ namespace audio {
 					if(pf_read(&wf, sizeof(wf), &br) != FR_OK) {
 						return false;
 					}
-					if(br != sizeof(wf)) return false;
+					if(br < 16) return false;
+					format_ = wf.usFormatTag;
+					if(format_ == FORMAT_EXT) format_ = wf.guidSubFormat & 0xffff;
 					rate_ = wf.ulSamplesPerSec;
 					chanel_ = wf.usChannels;
 					bits_ = wf.usBitsPerSample;
+					align_ = wf.usBlockAlign;
+					spb_ = format_ == FORMAT_IMA ? wf.usReserved : 0;
 				} else if(strncmp(rc.szChunkName, "data", 4) == 0) {
 					data_size_ = rc.ulChunkSize;
 					break;
 				}
-				ofs += rc.ulChunkSize;
+				ofs += rc.ulChunkSize + (rc.ulChunkSize & 1);  // チャンクは偶数境界
 				pf_lseek(ofs);
 			}
+			remain_ = data_size_;
+			in_pos_ = in_len_ = 0;
+			blk_left_ = 0;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	デコードの開始（load_header の後）
+			@param[in]	max_rate	出力の最大サンプルレート（整数比で間引く）
+			@return 扱えないフォーマットなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start(uint32_t max_rate)
+		{
+			if(chanel_ != 1 && chanel_ != 2) return false;
+			if(format_ == FORMAT_PCM) {
+				if(bits_ != 8 && bits_ != 16) return false;
+			} else if(format_ == FORMAT_IMA) {
+				if(bits_ != 4) return false;
+				// データ部は、チャネル毎に４バイト（８サンプル）のグループ
+				uint16_t n = (align_ - chanel_ * 4) * 2 / chanel_ + 1;
+				if(align_ <= (chanel_ * 4) || (align_ % (chanel_ * 4)) != 0) return false;
+				if(spb_ == 0) spb_ = n;
+				else if(spb_ != n) return false;
+			} else {
+				return false;
+			}
+			if(rate_ == 0 || max_rate == 0) return false;
+
+			down_ = (rate_ + max_rate - 1) / max_rate;
+			down_shift_ = 0xff;
+			for(uint8_t i = 0; i < 8; ++i) {
+				if(down_ == (1 << i)) down_shift_ = i;
+			}
+			dither_ = format_ != FORMAT_PCM || bits_ != 8 || down_ > 1;
+			blk_left_ = 0;
 			return true;
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	デコードして、符号無し 8 ビット、ステレオのフレームを作る
+			@param[out]	out	出力（left、right メンバー）
+			@param[in]	n	フレーム数
+			@return 作ったフレーム数（n より少なければ、データの終わり）
+		*/
+		//-----------------------------------------------------------------//
+		template <class WAVE>
+		uint16_t render(WAVE* out, uint16_t n)
+		{
+			for(uint16_t i = 0; i < n; ++i) {
+				int32_t sl = 0;
+				int32_t sr = 0;
+				for(uint8_t j = 0; j < down_; ++j) {
+					int16_t l, r;
+					if(!fetch_(l, r)) return i;
+					sl += l;
+					sr += r;
+				}
+				if(down_shift_ != 0xff) {
+					sl >>= down_shift_;
+					sr >>= down_shift_;
+				} else {
+					sl /= down_;
+					sr /= down_;
+				}
+				rnd_ ^= rnd_ << 7;  // xorshift16
+				rnd_ ^= rnd_ >> 9;
+				rnd_ ^= rnd_ << 8;
+				out[i].left  = out_(sl, rnd_);
+				out[i].right = out_(sr, rnd_ ^ 0x5a5a);
+			}
+			return n;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	データサイズを取得
@@ -113,6 +363,14 @@ namespace audio {
 		uint32_t get_rate() const { return rate_; }
 		uint8_t get_chanel() const { return chanel_; }
 		uint8_t get_bits() const { return  bits_; }
+		uint16_t get_format() const { return format_; }
+
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	出力サンプルレートを取得（start の後）
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_out_rate() const { return rate_ / down_; }
 	};
 }
@@ -12,25 +12,31 @@
 #include "common/renesas.hpp"
 
 #include "common/trb_io.hpp"
+#include "common/sched.hpp"
 
 namespace {
 
 	typedef device::PORT<device::PORT1, device::bitpos::B0, false> LED0;
 	typedef device::PORT<device::PORT1, device::bitpos::B1, false> LED1;
 
-	volatile uint16_t trb_count_;
+	// タスク（id）２つ、タイマー割り込みで、ティックを進める
+	typedef utils::sched<2> SCHED;
 
-	/// タイマー割り込みで実行する動作の定義
-	class trb_intr_task {
-	public:
-		void operator() () {
-			++trb_count_;
-		}
-	};
-
-	typedef device::trb_io<trb_intr_task, uint8_t> TIMER_B;
+	typedef device::trb_io<SCHED::tick_task, uint8_t> TIMER_B;
 	TIMER_B	timer_b_;
 
+	// LED0、LED1 を、交互に点ける
+	void led_a_()
+	{
+		LED0::P = 0;
+		LED1::P = 1;
+	}
+
+	void led_b_()
+	{
+		LED0::P = 1;
+		LED1::P = 0;
+	}
 }
 
 
@@ -72,18 +78,8 @@ int main(int argc, char *argv[])
 		LED1::P = 0;
 	}
 
-	// タイマー・メイン
-	uint8_t cnt = 0;
-	while(1) {
-		timer_b_.sync();
-		if(cnt < 20) {
-			LED0::P = 0;
-			LED1::P = 1;
-		} else {
-			LED0::P = 1;
-			LED1::P = 0;
-		}
-		++cnt;
-		if(cnt >= 60) cnt = 0;
-	}
+	// タイマー・メイン（６０ティック周期、led_b_ は、２０ティック遅らせる）
+	SCHED::set_periodic(0, led_a_, 60);
+	SCHED::set_periodic(1, led_b_, 60, 20);
+	SCHED::run();
 }
@@ -17,8 +17,8 @@
 #include "common/adc_io.hpp"
 #include "common/spi_io.hpp"
 #include "chip/ST7565.hpp"
-#include "common/monograph.hpp"
-#include "common/font6x12.hpp"
+#include "common/page_plot.hpp"
+#include "common/font6x12_page.hpp"
 #include "common/fixed_string.hpp"
 
 namespace app {
@@ -114,44 +114,18 @@ namespace app {
 		typedef chip::ST7565<SPI, LCD_SEL, LCD_A0, LCD_RES> LCD;
 		LCD 	lcd_;
 
-		class PLOT {
-		public:
-			typedef int16_t value_type;
+		// 画面（128 x 48）の上半分、下半分を、交互に描画して転送する
+		typedef graphics::page_plot<128, 24> PLOT;
 
-			static const int16_t WIDTH  = 128;
-			static const int16_t HEIGHT = 24;
-			static const int8_t PAGE_NUM = 2;
-
-		private:
-			uint8_t		fb_[WIDTH * HEIGHT / 8];
-
-		public:
-			void clear(uint8_t v = 0)
-			{
-				for(uint16_t i = 0; i < (WIDTH * HEIGHT / 8); ++i) {
-					fb_[i] = v;
-				}
-			} 
-
-			uint8_t* fb() { return fb_; }
-
-			void operator() (value_type x, value_type y, bool val)
-			{
-				if(x < 0 || x >= WIDTH) return;
-				if(y < 0 || y >= HEIGHT) return;
-
-				if(val) { fb_[(x >> 3) * y] |= 1 << (x & 7); }
-				else { fb_[(x >> 3) * y] &= ~(1 << (x & 7)); }
-			}
-		};
-
-
-		typedef graphics::font6x12 afont;
+		// ASCII は、ページ・レイアウトのグリフで、カラム単位に描画
+		typedef graphics::font6x12_page afont;
 		graphics::monograph<PLOT, afont> bitmap_;
 		graphics::kfont_null kfont_;
 
 		uint8_t		loop_;
 		uint8_t		page_;
+		uint8_t		text_w_[2];	///< 上下の半分毎の、表示している文字列の幅
+		uint8_t		clear_;		///< 全体を消す回数（表示の切り替えで、両方の半分）
 
 		float		volt_;
 		float		current_;
@@ -171,6 +145,7 @@ namespace app {
 		};
 
 		TASK		task_;
+		TASK		last_task_;
 
 		uint8_t		log_;
 		uint8_t		log_itv_;
@@ -192,9 +167,9 @@ namespace app {
             @brief  コンストラクター
         */
         //-------------------------------------------------------------//
-		checker() : lcd_(spi_), bitmap_(kfont_), loop_(0), page_(0),
+		checker() : lcd_(spi_), bitmap_(kfont_), loop_(0), page_(0), text_w_{ 0, 0 }, clear_(0),
 					volt_(0.0f), current_(0.0f), watt_(0.0f),
-					task_(TASK::MAIN),
+					task_(TASK::MAIN), last_task_(TASK::limit),
 					log_(0), log_itv_(0), gain_idx_(0), interval_(12),
 					usb_m_(0.0f), usb_p_(0.0f)
 #ifdef UART
@@ -254,6 +229,24 @@ namespace app {
 		}
 
 
+        //-------------------------------------------------------------//
+        /*!
+            @brief  文字列の描画（前の文字列を消してから描くので、@n
+					変わった所だけが転送される）@n
+					バッファは上下の半分で共有なので、バッファにある、もう一方の @n
+					文字列と、この半分の前の文字列の、広い方を消す（短くなった @n
+					文字列の後ろも、転送される）
+			@param[in]	str		文字列
+        */
+        //-------------------------------------------------------------//
+		void text_(const char* str)
+		{
+			uint8_t w = text_w_[0] > text_w_[1] ? text_w_[0] : text_w_[1];
+			if(w > 0) bitmap_.fill(0, 0, w, afont::HEIGHT, 0);
+			text_w_[page_] = static_cast<uint8_t>(bitmap_.draw_text(0, 0, str));
+		}
+
+
         //-------------------------------------------------------------//
         /*!
             @brief  電圧、電流表示
@@ -264,10 +257,10 @@ namespace app {
 			// 400mV/A * 3
 			if(page_ == 0) {
 				utils::sformat("%3.2fV", str_, sizeof(str_)) % volt_;
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			} else {
 				utils::sformat("%3.2fA", str_, sizeof(str_)) % current_;
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			}
 		}
 
@@ -286,10 +279,10 @@ namespace app {
 				auto m = s / 60;
 				auto h = m / 60;
 				utils::sformat("%02d:%02d:%02d", str_, sizeof(str_)) % (h % 24) % (m % 60) % (s % 60);
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			} else {
 				utils::sformat(form, str_, sizeof(str_)) % watt;
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			}
 		}
 
@@ -305,6 +298,7 @@ namespace app {
 		{
 			static const int8_t gain_tbl[] = { 1, 2, 3, 4, 6, 8, 12, 16 };
 			int16_t gain = gain_tbl[gain_idx_];
+			bitmap_.fill(o, 0, w + 1, PLOT::HEIGHT, 0);
 			if(page_ == 0) {
  				int16_t v = w - gain * w / 16;
 				bitmap_.line(o, 0, o + v, 0, true);
@@ -345,10 +339,10 @@ namespace app {
 		{
 			if(page_ == 0) {
 				utils::sformat("-D: %3.2fV", str_, sizeof(str_)) % usb_m_;
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			} else {
 				utils::sformat("+D: %3.2fV", str_, sizeof(str_)) % usb_p_;
-				bitmap_.draw_text(0, 0, str_);
+				text_(str_);
 			}
 		}
 
@@ -449,7 +443,16 @@ namespace app {
 #endif
 
 			if(loop_ == 0) {
-				bitmap_.clear(0);
+				// 表示を切り替えた時だけ、全体を消す（上下の半分で２回）
+				if(task_ != last_task_) {
+					last_task_ = task_;
+					clear_ = 2;
+				}
+				if(clear_ > 0) {
+					--clear_;
+					bitmap_.clear(0);
+					text_w_[page_] = 0;  // この半分は全体を転送、もう一方は表示のまま
+				}
 			} else if(loop_ == 1) {
 				switch(task_) {
 				case TASK::MAIN:
@@ -480,7 +483,8 @@ namespace app {
 					break;
 				}
 			} else if(loop_ == 2) {
-				lcd_.copy(bitmap_.at_plot().fb(), PLOT::PAGE_NUM, page_ * 3);
+				// 描き直した文字列、グラフの範囲だけが転送される
+				bitmap_.at_plot().flush(lcd_, page_ * 3);
 				++page_;
 				page_ &= 1;
 			}
@@ -14,12 +14,15 @@
 #include "common/uart_io.hpp"
 #include "common/fifo.hpp"
 #include "common/trb_io.hpp"
+#include "common/soft_timer.hpp"
 #include "common/iica_io.hpp"
 #include "chip/VL53L0X.hpp"
 
 namespace {
 
-	typedef device::trb_io<utils::null_task, uint8_t> timer_b;
+	// タイマー RB（100Hz）のティックで、VL53L0X のタイムアウトを計る
+	typedef utils::soft_timer<100, 1> soft_timer;
+	typedef device::trb_io<soft_timer::tick_task, uint8_t> timer_b;
 	timer_b timer_b_;
 
 	typedef utils::fifo<uint8_t, 16> buffer;
@@ -34,7 +37,7 @@ namespace {
 
 	typedef device::iica_io<SDA, SCL> I2C;
 	I2C		i2c_;
-	typedef chip::VL53L0X<I2C> VLX;
+	typedef chip::VL53L0X<I2C, soft_timer::timeout> VLX;
 	VLX		vlx_(i2c_);
 
 	utils::command<64> command_;
@@ -87,35 +87,33 @@ namespace chip {
 
 		int32_t		t_fine_;
 
+		void read_(REG adr, uint8_t* dst, uint8_t num) {
+			i2c_.read(addr_, static_cast<uint8_t>(adr), dst, num);
+		}
+
 		uint8_t read8_(REG adr) {
 			uint8_t reg[1];
-			reg[0] = static_cast<uint8_t>(adr);
-			i2c_.send(addr_, reg, 1);
-			i2c_.recv(addr_, reg, 1);
+			read_(adr, reg, 1);
 			return reg[0];
 		}
 
 		uint16_t read16_(REG adr) {
 			uint8_t reg[2];
-			reg[0] = static_cast<uint8_t>(adr);
-			i2c_.send(addr_, reg, 1);
-			i2c_.recv(addr_, reg, 2);
+			read_(adr, reg, 2);
 			return (reg[0] << 8) | reg[1];
 		}
 
+		static uint32_t get24_(const uint8_t* reg) {
+			return (static_cast<uint32_t>(reg[0]) << 16) | (static_cast<uint32_t>(reg[1]) << 8) | reg[2];
+		}
+
 		uint32_t read24_(REG adr) {
 			uint8_t reg[3];
-			reg[0] = static_cast<uint8_t>(adr);
-			i2c_.send(addr_, reg, 1);
-			i2c_.recv(addr_, reg, 3);
-			return (static_cast<uint32_t>(reg[0]) << 16) | (static_cast<uint32_t>(reg[1]) << 8) | reg[2];
+			read_(adr, reg, 3);
+			return get24_(reg);
 		}
 
-		uint16_t read16le_(REG adr) {
-			uint8_t reg[2];
-			reg[0] = static_cast<uint8_t>(adr);
-			i2c_.send(addr_, reg, 1);
-			i2c_.recv(addr_, reg, 2);
+		static uint16_t get16le_(const uint8_t* reg) {
 			return (reg[1] << 8) | reg[0];
 		}
 
@@ -127,19 +125,37 @@ namespace chip {
 		}
 
 		void get_coefficients_() {
-			calib_.dig_T1 = read16le_(REG::DIG_T1);
-			calib_.dig_T2 = read16le_(REG::DIG_T2);
-			calib_.dig_T3 = read16le_(REG::DIG_T3);
-
-			calib_.dig_P1 = read16le_(REG::DIG_P1);
-			calib_.dig_P2 = read16le_(REG::DIG_P2);
-			calib_.dig_P3 = read16le_(REG::DIG_P3);
-			calib_.dig_P4 = read16le_(REG::DIG_P4);
-			calib_.dig_P5 = read16le_(REG::DIG_P5);
-			calib_.dig_P6 = read16le_(REG::DIG_P6);
-			calib_.dig_P7 = read16le_(REG::DIG_P7);
-			calib_.dig_P8 = read16le_(REG::DIG_P8);
-			calib_.dig_P9 = read16le_(REG::DIG_P9);
+			// DIG_T1 ～ DIG_P9（24 バイト）を、１回で読む
+			uint8_t reg[24];
+			read_(REG::DIG_T1, reg, sizeof(reg));
+			calib_.dig_T1 = get16le_(&reg[0]);
+			calib_.dig_T2 = get16le_(&reg[2]);
+			calib_.dig_T3 = get16le_(&reg[4]);
+
+			calib_.dig_P1 = get16le_(&reg[6]);
+			calib_.dig_P2 = get16le_(&reg[8]);
+			calib_.dig_P3 = get16le_(&reg[10]);
+			calib_.dig_P4 = get16le_(&reg[12]);
+			calib_.dig_P5 = get16le_(&reg[14]);
+			calib_.dig_P6 = get16le_(&reg[16]);
+			calib_.dig_P7 = get16le_(&reg[18]);
+			calib_.dig_P8 = get16le_(&reg[20]);
+			calib_.dig_P9 = get16le_(&reg[22]);
+		}
+
+		int32_t temperature_(int32_t adc_T) {
+			adc_T >>= 4;
+
+  			int32_t var1  = ((((adc_T>>3) - (static_cast<int32_t>(calib_.dig_T1) << 1))) *
+				(static_cast<int32_t>(calib_.dig_T2))) >> 11;
+
+			int32_t var2  = (((((adc_T>>4) - (static_cast<int32_t>(calib_.dig_T1))) *
+				((adc_T>>4) - (static_cast<int32_t>(calib_.dig_T1)))) >> 12) *
+				(static_cast<int32_t>(calib_.dig_T3))) >> 14;
+
+			t_fine_ = var1 + var2;
+
+			return (t_fine_ * 5 + 128) >> 8;
 		}
 
 	public:
@@ -196,19 +212,7 @@ namespace chip {
 		{
 			if(addr_ == 0) return 0;
 
-			int32_t adc_T = read24_(REG::TEMPDATA);
-			adc_T >>= 4;
-
-  			int32_t var1  = ((((adc_T>>3) - (static_cast<int32_t>(calib_.dig_T1) << 1))) *
-				(static_cast<int32_t>(calib_.dig_T2))) >> 11;
-
-			int32_t var2  = (((((adc_T>>4) - (static_cast<int32_t>(calib_.dig_T1))) *
-				((adc_T>>4) - (static_cast<int32_t>(calib_.dig_T1)))) >> 12) *
-				(static_cast<int32_t>(calib_.dig_T3))) >> 14;
-
-			t_fine_ = var1 + var2;
-
-			return (t_fine_ * 5 + 128) >> 8;
+			return temperature_(read24_(REG::TEMPDATA));
 		}
 
 
@@ -255,10 +259,13 @@ namespace chip {
 		{
 			if(addr_ == 0) return 0;
 
+			// 圧力と温度（0xF7 ～ 0xFC）を、１回で読む（同じ変換の値）
+			uint8_t reg[6];
+			read_(REG::PRESSUREDATA, reg, sizeof(reg));
 			// Must be done first to get the t_fine variable set up
-			get_temperature();
+			temperature_(get24_(&reg[3]));
 
-			int32_t adc_P = read24_(REG::PRESSUREDATA);
+			int32_t adc_P = get24_(&reg[0]);
 			adc_P >>= 4;
 
 			int64_t var1 = (static_cast<int64_t>(t_fine_)) - 128000;
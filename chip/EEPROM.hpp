@@ -157,6 +157,19 @@ namespace chip {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	書き込み終了の検査（ACK ポーリング）@n
+					アドレスだけを送り、ACK が返れば、書き込みは終了している
+			@param[in]	adr	検査アドレス
+			@return 「false」なら、書き込み中
+		 */
+		//-----------------------------------------------------------------//
+		bool poll(uint32_t adr) const {
+			return i2c_.send(i2c_adr_(adr), nullptr, 0);
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	書き込み同期
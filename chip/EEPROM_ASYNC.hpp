@@ -0,0 +1,249 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	I2C EEPROM 非同期書き込み（ライト・コンバイン・キャッシュ）@n
+			・write() は、キャッシュ・ライン（ページ内の LINE バイト）に書くだけ @n
+			・service() をメインループから呼ぶと、ACK ポーリングと、@n
+			　ページ書き込みを、それぞれ最大１回行い、tWR を待たずに戻る @n
+			・同じラインへの書き込みは、フラッシュされるまで１回にまとまる @n
+			・read() は、書き込み待ちのデータを含めて読む
+	@author	平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+
+namespace chip {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  EEPROM 非同期書き込みテンプレートクラス
+		@param[in]	EEPROM_	EEPROM クラス（chip::EEPROM）
+		@param[in]	LINE	ラインのバイト数（2 ～ 16 の２の累乗、ページサイズ以下）
+		@param[in]	LINES	ライン数（RAM は、ライン当たり LINE + 9 バイト）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class EEPROM_, uint8_t LINE = 16, uint8_t LINES = 4>
+	class EEPROM_ASYNC {
+
+		static_assert(LINE >= 2 && LINE <= 16 && (LINE & (LINE - 1)) == 0, "LINE: 2 to 16, power of 2");
+
+		static const uint32_t NONE = 0xFFFFFFFF;
+
+		struct line_t {
+			uint32_t	adr;		///< ラインの先頭（NONE なら空き）
+			uint16_t	valid;		///< データのあるバイト
+			uint16_t	dirty;		///< 書き込み待ちのバイト
+			uint8_t		age;		///< 書き込み待ちになってからの service 回数
+			uint8_t		data[LINE];
+		};
+
+		EEPROM_&	eeprom_;
+
+		line_t		line_[LINES];
+		uint32_t	busy_adr_;	///< 書き込み中のアドレス
+		bool		busy_;
+		bool		flush_;
+		uint8_t		hold_;
+		uint16_t	writes_;
+
+		line_t* find_(uint32_t top) {
+			for(uint8_t i = 0; i < LINES; ++i) {
+				if(line_[i].adr == top) return &line_[i];
+			}
+			return nullptr;
+		}
+
+		line_t* alloc_(uint32_t top) {
+			line_t* t = nullptr;
+			for(uint8_t i = 0; i < LINES; ++i) {
+				if(line_[i].adr == NONE) {
+					t = &line_[i];
+					break;
+				}
+				if(line_[i].dirty == 0 && t == nullptr) t = &line_[i];
+			}
+			if(t != nullptr) {
+				t->adr = top;
+				t->valid = 0;
+				t->dirty = 0;
+				t->age = 0;
+			}
+			return t;
+		}
+
+		static uint16_t full_() { return LINE == 16 ? 0xFFFF : ((1 << LINE) - 1); }
+
+		// 書き込むラインを選ぶ（満杯、保持時間を過ぎた、フラッシュ中、の中で古い順）
+		line_t* select_() {
+			line_t* t = nullptr;
+			for(uint8_t i = 0; i < LINES; ++i) {
+				line_t& l = line_[i];
+				if(l.dirty == 0) continue;
+				if(l.dirty != full_() && l.age < hold_ && !flush_) continue;
+				if(t == nullptr || l.age > t->age) t = &l;
+			}
+			return t;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+			@param[in]	eeprom	EEPROM クラス（start 済み）
+		 */
+		//-----------------------------------------------------------------//
+		EEPROM_ASYNC(EEPROM_& eeprom) : eeprom_(eeprom), line_(), busy_adr_(0), busy_(false),
+			flush_(false), hold_(0), writes_(0) {
+			for(uint8_t i = 0; i < LINES; ++i) line_[i].adr = NONE;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	保持時間の設定 @n
+					満杯でないラインは、hold 回の service() の間、書き込みを待ち、@n
+					その間の書き込みをまとめる（0 なら直ぐに書く）
+			@param[in]	hold	service() の回数
+		 */
+		//-----------------------------------------------------------------//
+		void set_hold(uint8_t hold) { hold_ = hold; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	書き込み（キャッシュへ）
+			@param[in]	adr	書き込みアドレス
+			@param[in]	src	元
+			@param[in]	len	長さ
+			@return 受け付けたバイト数（len より少ない場合、空きが無いので、@n
+					service() を呼んでから残りを書く）
+		 */
+		//-----------------------------------------------------------------//
+		uint16_t write(uint32_t adr, const uint8_t* src, uint16_t len) {
+			for(uint16_t i = 0; i < len; ++i) {
+				uint32_t top = adr & ~static_cast<uint32_t>(LINE - 1);
+				line_t* t = find_(top);
+				if(t == nullptr) {
+					t = alloc_(top);
+					if(t == nullptr) return i;
+				}
+				uint8_t pos = adr & (LINE - 1);
+				uint16_t bit = 1 << pos;
+				if(t->dirty == 0) t->age = 0;
+				t->data[pos] = src[i];
+				t->valid |= bit;
+				t->dirty |= bit;
+				++adr;
+			}
+			return len;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	読み出し（書き込み待ちのデータを含む）@n
+					全てキャッシュにあれば、I2C を使わない
+			@param[in]	adr	読み出しアドレス
+			@param[out]	dst	先
+			@param[in]	len	長さ
+			@return EEPROM が書き込み中、又はエラーなら「false」
+		 */
+		//-----------------------------------------------------------------//
+		bool read(uint32_t adr, uint8_t* dst, uint16_t len) {
+			bool hit = true;
+			for(uint16_t i = 0; i < len && hit; ++i) {
+				uint32_t a = adr + i;
+				const line_t* t = find_(a & ~static_cast<uint32_t>(LINE - 1));
+				hit = t != nullptr && (t->valid & (1 << (a & (LINE - 1)))) != 0;
+			}
+			if(!hit) {
+				if(busy_) {
+					if(!eeprom_.poll(busy_adr_)) return false;
+					busy_ = false;
+				}
+				if(!eeprom_.read(adr, dst, len)) return false;
+			}
+			for(uint16_t i = 0; i < len; ++i) {
+				uint32_t a = adr + i;
+				const line_t* t = find_(a & ~static_cast<uint32_t>(LINE - 1));
+				if(t == nullptr) continue;
+				uint8_t pos = a & (LINE - 1);
+				if(t->valid & (1 << pos)) dst[i] = t->data[pos];
+			}
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	サービス（メインループから呼ぶ）@n
+					書き込み中なら ACK ポーリング、終わっていれば、@n
+					次のラインの連続した書き込み待ちバイトを、１回で書く
+			@return エラーがあれば「false」
+		 */
+		//-----------------------------------------------------------------//
+		bool service() {
+			for(uint8_t i = 0; i < LINES; ++i) {
+				if(line_[i].dirty != 0 && line_[i].age < 255) ++line_[i].age;
+			}
+			if(busy_) {
+				if(!eeprom_.poll(busy_adr_)) return true;
+				busy_ = false;
+			}
+			line_t* t = select_();
+			if(t == nullptr) {
+				flush_ = false;
+				return true;
+			}
+			uint8_t pos = 0;
+			while((t->dirty & (1 << pos)) == 0) ++pos;
+			uint8_t end = pos;
+			uint16_t mask = 0;
+			while(end < LINE && (t->dirty & (1 << end)) != 0) {
+				mask |= 1 << end;
+				++end;
+			}
+			if(!eeprom_.write(t->adr + pos, &t->data[pos], end - pos)) return false;
+			t->dirty &= ~mask;
+			busy_adr_ = t->adr;
+			busy_ = true;
+			++writes_;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	全ての書き込み待ちを、保持時間を待たずに書く（非同期）
+		 */
+		//-----------------------------------------------------------------//
+		void flush() { flush_ = true; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	書き込みが全て終わったか
+			@return 終わっていれば「true」
+		 */
+		//-----------------------------------------------------------------//
+		bool is_idle() const {
+			if(busy_) return false;
+			for(uint8_t i = 0; i < LINES; ++i) {
+				if(line_[i].dirty != 0) return false;
+			}
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ページ書き込みの回数を取得
+			@return 回数
+		 */
+		//-----------------------------------------------------------------//
+		uint16_t get_writes() const { return writes_; }
+	};
+}
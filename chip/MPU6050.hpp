@@ -410,9 +410,7 @@ DMP_MEMORY_CHUNK_SIZE   16
 
 		uint8_t recv_(REG reg) const {
 			uint8_t tmp[1];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, tmp, 1);
+			i2c_.read(MPU6050_ADR_, static_cast<uint8_t>(reg), tmp, 1);
 			return tmp[0];
 		}
 
@@ -424,51 +422,46 @@ DMP_MEMORY_CHUNK_SIZE   16
 		}
 
 		void set_bit_(REG reg, uint8_t bpos, bool f) {
-			uint8_t tmp[2];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, &tmp[1], 1);
-			if(f) tmp[1] |= 1 << bpos;
-			else tmp[1] &= ~(1 << bpos);
- 			i2c_.send(MPU6050_ADR_, tmp, 2);
+			uint8_t v = recv_(reg);
+			if(f) v |= 1 << bpos;
+			else v &= ~(1 << bpos);
+			send_(reg, v);
 		}
 
 		void set_bits_(REG reg, uint8_t bpos, uint8_t len, uint8_t v) {
-			uint8_t tmp[2];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, &tmp[1], 1);
-			tmp[1] &= ((1 << len) - 1) << bpos;
-			tmp[1] |= v << bpos;
- 			i2c_.send(MPU6050_ADR_, tmp, 2);
+			uint8_t t = recv_(reg);
+			t &= ~(((1 << len) - 1) << bpos);
+			t |= v << bpos;
+			send_(reg, t);
 		}
 
 		void get_8_(REG reg, uint8_t& v) const {
-			uint8_t tmp[1];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, tmp, 1);
-			v = tmp[0];
+			v = recv_(reg);
 		}
 
 		void get_16_(REG reg, uint16_t& v) const {
 			uint8_t tmp[2];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, tmp, 2);
+			i2c_.read(MPU6050_ADR_, static_cast<uint8_t>(reg), tmp, 2);
 		    v = static_cast<uint16_t>((tmp[0] << 8) | tmp[1]);
 		}
 
-		void get_vec_(REG reg, int16_vec& vec) const {
-			uint8_t tmp[6];
-			tmp[0] = static_cast<uint8_t>(reg);
-			i2c_.send(MPU6050_ADR_, tmp, 1);
-			i2c_.recv(MPU6050_ADR_, tmp, 6);
+		static void get_vec_(const uint8_t* tmp, int16_vec& vec) {
 		    vec.x = static_cast<int16_t>((tmp[0] << 8) | tmp[1]);
 		    vec.y = static_cast<int16_t>((tmp[2] << 8) | tmp[3]);
 		    vec.z = static_cast<int16_t>((tmp[4] << 8) | tmp[5]);
 		}
 
+		void get_vec_(REG reg, int16_vec& vec) const {
+			uint8_t tmp[6];
+			i2c_.read(MPU6050_ADR_, static_cast<uint8_t>(reg), tmp, 6);
+			get_vec_(tmp, vec);
+		}
+
+		static int16_t temp_(uint16_t v) {
+			// Temperature in degrees C = (TEMP_OUT Register Value as a signed quantity)/340 + 36.53
+			return (static_cast<int16_t>(v) / 34) + 365;
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
@@ -539,8 +532,7 @@ DMP_MEMORY_CHUNK_SIZE   16
 		int16_t get_temp() const {
 			uint16_t v;
 			get_16_(REG::TEMP_OUT_H, v);
-			// Temperature in degrees C = (TEMP_OUT Register Value as a signed quantity)/340 + 36.53
-			return (static_cast<int16_t>(v) / 34) + 365; 
+			return temp_(v);
 		}
 
 
@@ -555,6 +547,28 @@ DMP_MEMORY_CHUNK_SIZE   16
 			get_vec_(REG::GYRO_XOUT_H, vec);
 			return vec;
 		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	加速度、温度、ジャイロを、１回のバースト・リードで取得 @n
+					（同じサンプルの値になる）
+			@param[out]	accel	加速度値
+			@param[out]	temp	温度（*10）
+			@param[out]	gyro	ジャイロ値
+			@return エラーなら「false」を返す
+		 */
+		//-----------------------------------------------------------------//
+		bool get_motion(int16_vec& accel, int16_t& temp, int16_vec& gyro) const {
+			uint8_t tmp[14];
+			if(!i2c_.read(MPU6050_ADR_, static_cast<uint8_t>(REG::ACCEL_XOUT_H), tmp, 14)) {
+				return false;
+			}
+			get_vec_(&tmp[0], accel);
+			temp = temp_(static_cast<uint16_t>((tmp[6] << 8) | tmp[7]));
+			get_vec_(&tmp[8], gyro);
+			return true;
+		}
 	};
 }
 
@@ -50,6 +50,8 @@ namespace chip {
 
 			SETSTARTLINE		= 0x40,
 
+			SETPAGEADDR			= 0xB0,
+
 			MEMORYMODE			= 0x20,
 			COLUMNADDR			= 0x21,
 			PAGEADDR			= 0x22,
@@ -119,6 +121,24 @@ namespace chip {
 		}
 
 
+		void write_data_(const uint8_t* src, uint8_t len)
+		{
+			DC::P = 1;
+			CS::P = 0;
+			csi_.send(src, len);
+			CS::P = 1;
+		}
+
+
+		void set_pointer_(uint8_t page, uint8_t col)
+		{
+			col += COLUMN_OFS;
+			write_cmd_(static_cast<CMD>(static_cast<uint8_t>(CMD::SETPAGEADDR) | page));
+			write_cmd_(static_cast<CMD>(static_cast<uint8_t>(CMD::SETLOWCOLUMN) | (col & 0x0f)));
+			write_cmd_(static_cast<CMD>(static_cast<uint8_t>(CMD::SETHIGHCOLUMN) | (col >> 4)));
+		}
+
+
 #if 0
 
 // startscrollright
@@ -300,6 +320,9 @@ void Adafruit_SH1106::stopscroll(void){
 #endif
 
 	public:
+		static const uint8_t COLUMN_OFS = 2;	///< 表示 RAM（132 カラム）上の、先頭カラム位置
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクター
@@ -397,5 +420,42 @@ void Adafruit_SH1106::stopscroll(void){
 				write_cmd_(CMD::NORMALDISPLAY);
 			}
 		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コピー
+			@param[in]	src	フレームバッファソース
+			@param[in]	num	転送ページ数
+			@param[in]	ofs	転送先オフセット
+		*/
+		//-----------------------------------------------------------------//
+		void copy(const uint8_t* src, uint8_t num, uint8_t ofs = 0)
+		{
+			for(uint8_t page = 0; page < num; ++page) {
+				set_pointer_(page + ofs, 0);
+				write_data_(src, 128);
+				src += 128;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ページの一部をコピー
+			@param[in]	src	転送ソース（カラム col の位置）
+			@param[in]	page	転送先ページ
+			@param[in]	col	転送先カラム
+			@param[in]	len	転送バイト数
+		*/
+		//-----------------------------------------------------------------//
+		void copy_part(const uint8_t* src, uint8_t page, uint8_t col, uint8_t len)
+		{
+			set_pointer_(page, col);
+			write_data_(src, len);
+		}
 	};
+
+	template <class CSI_IO, class CS, class DC, class RES, bool EXT_VCC>
+	const uint8_t SH1106<CSI_IO, CS, DC, RES, EXT_VCC>::COLUMN_OFS;
 }
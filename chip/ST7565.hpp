@@ -218,5 +218,26 @@ namespace chip {
 			chip_enable_(false);
 		}
 
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ページの一部をコピー
+			@param[in]	src	転送ソース（カラム col の位置）
+			@param[in]	page	転送先ページ
+			@param[in]	col	転送先カラム
+			@param[in]	len	転送バイト数
+		*/
+		//-----------------------------------------------------------------//
+		void copy_part(const uint8_t* src, uint8_t page, uint8_t col, uint8_t len) {
+			chip_enable_();
+			reg_select_(0);
+			write_(CMD::SET_COLUMN_LOWER, col & 0x0f);
+			write_(CMD::SET_COLUMN_UPPER, col >> 4);
+			write_(CMD::SET_PAGE, page);
+			reg_select_(1);
+			csi_.send(src, len);
+			reg_select_(0);
+			chip_enable_(false);
+		}
 	};
 }
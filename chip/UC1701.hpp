@@ -132,5 +132,24 @@ namespace chip {
 			chip_enable_(false);
 		}
 
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ページの一部をコピー
+			@param[in]	src	転送ソース（カラム col の位置）
+			@param[in]	page	転送先ページ
+			@param[in]	col	転送先カラム
+			@param[in]	len	転送バイト数
+		*/
+		//-----------------------------------------------------------------//
+		void copy_part(const uint8_t* src, uint8_t page, uint8_t col, uint8_t len) {
+			chip_enable_();
+			reg_select_(0);
+			set_pointer_(col, page);
+			reg_select_(1);
+			csi_.send(src, len);
+			reg_select_(0);
+			chip_enable_(false);
+		}
 	};
 }
@@ -18,9 +18,10 @@ namespace chip {
 	/*!
 		@brief  VL53L0X テンプレートクラス
 		@param[in]	I2C_IO	i2c I/O クラス
+		@param[in]	TIMEOUT	タイムアウト（utils::delay_timeout、soft_timer の timeout）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class I2C_IO>
+	template <class I2C_IO, class TIMEOUT = utils::delay_timeout>
 	class VL53L0X {
 	public:
 
@@ -164,7 +165,7 @@ namespace chip {
 
 		uint32_t	measurement_timing_budget_us_;
 
-		uint16_t	timeout_start_ms_;
+		TIMEOUT		timeout_;
 		uint16_t	io_timeout_;
 
 		// read by init and used when starting measurement; is StopVariable field of VL53L0X_
@@ -175,14 +176,14 @@ namespace chip {
 
 
 		void start_timeout_() {
-			timeout_start_ms_ = 0;
+			timeout_ = TIMEOUT(io_timeout_);
 		}
 
 
 		bool check_timeout_expired_() {
-			++timeout_start_ms_;
-			utils::delay::micro_second(1000 - 100);  // 1ms から、他の処理を大雑把に100uS引く
-			return (io_timeout_ > 0 && timeout_start_ms_ > io_timeout_);
+			if(io_timeout_ > 0 && timeout_.expired()) return true;
+			timeout_.pause(1000);
+			return false;
 		}
 
 
@@ -197,10 +198,7 @@ namespace chip {
 
 		void write_(reg_addr reg, const uint8_t* src, uint8_t len)
 		{
-			uint8_t tmp[1 + len];
-			tmp[0] = static_cast<uint8_t>(reg);
-			std::memcpy(&tmp[1], src, len); 
-			last_status_ = i2c_io_.send(ADR_, tmp, len + 1);
+			last_status_ = i2c_io_.write(ADR_, static_cast<uint8_t>(reg), src, len);
 		}
 
 
@@ -229,35 +227,24 @@ namespace chip {
 		uint8_t read_(reg_addr reg)
 		{
 			uint8_t tmp[1];
-			tmp[0] = static_cast<uint8_t>(reg);
-			last_status_ = i2c_io_.send(ADR_, tmp, 1);
+			last_status_ = i2c_io_.read(ADR_, static_cast<uint8_t>(reg), tmp, 1);
 			if(!last_status_) return 0;
-
-			last_status_ = i2c_io_.recv(ADR_, tmp, 1);
 			return tmp[0];
 		}
 
 
 		bool read_(reg_addr reg, uint8_t* dst, uint8_t len)
 		{
-			uint8_t tmp[1];
-			tmp[0] = static_cast<uint8_t>(reg);
-			if(!i2c_io_.send(ADR_, tmp, 1)) {
-				return false;
-			}
-
-			return i2c_io_.recv(ADR_, dst, len);
+			return i2c_io_.read(ADR_, static_cast<uint8_t>(reg), dst, len);
 		}
 
 
 		uint16_t read16_(reg_addr reg)
 		{
 			uint8_t tmp[2];
-			tmp[0] = static_cast<uint8_t>(reg);
-			last_status_ = i2c_io_.send(ADR_, tmp, 1);
+			last_status_ = i2c_io_.read(ADR_, static_cast<uint8_t>(reg), tmp, 2);
 			if(!last_status_) return 0;
 
-			last_status_ =  i2c_io_.recv(ADR_, tmp, 2);
 			uint16_t value = static_cast<uint16_t>(tmp[0]) << 8;
 			value |= static_cast<uint16_t>(tmp[1]);
 			return value;
@@ -267,11 +254,9 @@ namespace chip {
 		uint32_t read32_(reg_addr reg)
 		{
 			uint8_t tmp[4];
-			tmp[0] = static_cast<uint8_t>(reg);
-			last_status_ = i2c_io_.send(ADR_, tmp, 1);
+			last_status_ = i2c_io_.read(ADR_, static_cast<uint8_t>(reg), tmp, 4);
 			if(!last_status_) return 0;
 
-			last_status_ =  i2c_io_.recv(ADR_, tmp, 4);
 			uint32_t value = static_cast<uint32_t>(tmp[0]) << 24;
 			value |= static_cast<uint32_t>(tmp[1]) << 16;
 			value |= static_cast<uint32_t>(tmp[2]) << 8;
@@ -359,7 +344,7 @@ namespace chip {
 		 */
 		//-----------------------------------------------------------------//
 		VL53L0X(I2C_IO& i2c) : i2c_io_(i2c),
-			measurement_timing_budget_us_(0), timeout_start_ms_(0), io_timeout_(500), 
+			measurement_timing_budget_us_(0), timeout_(0), io_timeout_(500), 
 			stop_variable_(0),
 			last_status_(true), did_timeout_(false) { }
 
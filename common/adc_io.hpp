@@ -66,7 +66,7 @@ namespace device {
 
 		// ※同期が必要なら、実装する
 		void sleep_() const {
-			asm("nop");
+			io_sleep_();
 		}
 
 	public:
@@ -0,0 +1,467 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	Arithmetic コンパイル・テンプレート @n
+			※テキストの数式を、一度だけ解析して RPN バイトコードに変換し、@n
+			変数の値を変えながら、繰り返し評価する。@n
+			演算子の優先順位、表記は「basic_arith」と同じ @n
+			コード形式（１命令１バイト）： @n
+			　0x00         終端 @n
+			　0x01 - 0x0B  単項／２項演算 @n
+			　0x40 | n     定数 n をプッシュ（n < 64） @n
+			　0x80 | n     変数 n をプッシュ（n < 128）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/basic_arith.hpp"
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	Arithmetic コンパイル・クラス
+		@param[in]	VTYPE	基本型
+		@param[in]	CSIZE	コード領域の最大バイト数
+		@param[in]	CNUM	定数の最大数（最大６４）
+		@param[in]	SNUM	評価スタックの深さ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <typename VTYPE, uint8_t CSIZE = 24, uint8_t CNUM = 4, uint8_t SNUM = 6>
+	class arith_code {
+
+		static_assert(CNUM > 0 && CNUM <= 64, "arith_code: CNUM must be 1 to 64 (CONST opcode is 0x40|n)");
+
+	public:
+		typedef typename basic_arith<VTYPE>::error error;
+		typedef typename basic_arith<VTYPE>::error_t error_t;
+
+	private:
+
+		enum class code : uint8_t {
+			END,	///< 終端
+			NEG,	///< 符号反転
+			ADD,	///< +
+			SUB,	///< -
+			MUL,	///< *
+			DIV,	///< / または %
+			MOD,	///< //
+			AND,	///< &
+			XOR,	///< ^
+			OR,		///< |
+			SHL,	///< <<
+			SHR,	///< >>
+			CONST = 0x40,	///< 定数
+			VAR   = 0x80,	///< 変数
+		};
+
+		const char*		tx_;
+		char			ch_;
+
+		const char* const*	sym_;
+		uint8_t			symn_;
+
+		error_t			error_;
+
+		uint8_t			pos_;
+		uint8_t			cnum_;
+		int8_t			depth_;
+		uint8_t			last_;
+
+		uint8_t			code_[CSIZE];
+		VTYPE			const_[CNUM];
+
+		void emit_(code c, uint8_t n = 0) {
+			if(pos_ >= (CSIZE - 1)) {
+				error_.set(error::fatal);
+				return;
+			}
+			// 浮動小数点型では、剰余、ビット演算、シフトは使えない
+			if(std::is_floating_point<VTYPE>::value && c >= code::MOD && c <= code::SHR) {
+				error_.set(error::fatal);
+				return;
+			}
+			last_ = pos_;
+			code_[pos_] = static_cast<uint8_t>(c) | n;
+			++pos_;
+			if(c == code::CONST || c == code::VAR) {
+				++depth_;
+				if(depth_ > static_cast<int8_t>(SNUM)) error_.set(error::fatal);
+			} else if(c != code::NEG) {
+				--depth_;
+			}
+		}
+
+		void emit_const_(VTYPE v) {
+			uint8_t i;
+			for(i = 0; i < cnum_; ++i) {
+				if(const_[i] == v) break;
+			}
+			if(i == cnum_) {
+				if(cnum_ >= CNUM) {
+					error_.set(error::num_fatal);
+					return;
+				}
+				const_[cnum_] = v;
+				++cnum_;
+			}
+			emit_(code::CONST, i);
+		}
+
+		void skip_space_() {
+			while(ch_ == ' ' || ch_ == '\t') {
+				ch_ = *tx_++;
+			}
+		}
+
+		static bool symbol_char_(char ch, bool top) {
+			if(ch >= 'A' && ch <= 'Z') return true;
+			else if(ch >= 'a' && ch <= 'z') return true;
+			else if(ch == '_' || ch == '?') return true;
+			else if(!top && ch >= '0' && ch <= '9') return true;
+			return false;
+		}
+
+		void symbol_() {
+			const char* top = tx_ - 1;
+			uint8_t len = 0;
+			while(symbol_char_(ch_, false)) {
+				++len;
+				ch_ = *tx_++;
+			}
+			for(uint8_t i = 0; i < symn_; ++i) {
+				const char* s = sym_[i];
+				uint8_t j = 0;
+				while(j < len && s[j] == top[j]) ++j;
+				if(j == len && s[j] == 0) {
+					emit_(code::VAR, i);
+					return;
+				}
+			}
+			error_.set(error::symbol_fatal);
+		}
+
+		void number_() {
+			bool inv = false;
+
+			skip_space_();
+
+			// 符号、反転の判定
+			if(ch_ == '-') {
+				inv = true;
+				ch_ = *tx_++;
+			} else if(ch_ == '+') {
+				ch_ = *tx_++;
+			}
+
+			skip_space_();
+
+			if(ch_ == '(') {
+				factor_();
+			} else if(symbol_char_(ch_, true)) {
+				symbol_();
+			} else {
+				bool point = false;
+				bool num = false;
+				uint32_t v = 0;
+				uint32_t fp = 0;
+				uint32_t fs = 1;
+				while(1) {
+					if(ch_ == '.') {
+						if(point) {
+							error_.set(error::fatal);
+							break;
+						}
+						point = true;
+					} else if(ch_ >= '0' && ch_ <= '9') {
+						if(point) {
+							fp *= 10;
+							fp += ch_ - '0';
+							fs *= 10;
+						} else {
+							v *= 10;
+							v += ch_ - '0';
+						}
+						num = true;
+					} else {
+						break;
+					}
+					ch_ = *tx_++;
+				}
+				if(!num) {
+					error_.set(error::number_fatal);
+					return;
+				}
+				VTYPE a = arith_op<VTYPE>::decimal(v, fp, fs);
+				if(inv) {
+					a = -a;
+					inv = false;
+				}
+				emit_const_(a);
+			}
+
+			if(inv) {
+				// 直前が定数なら、符号反転を畳み込む
+				uint8_t c = code_[last_];
+				if(pos_ > 0 && (c & 0xC0) == static_cast<uint8_t>(code::CONST)) {
+					--pos_;
+					--depth_;
+					emit_const_(-const_[c & 0x3F]);
+				} else {
+					emit_(code::NEG);
+				}
+			}
+		}
+
+
+		void factor_() {
+			if(ch_ == '(') {
+				ch_ = *tx_++;
+				expression_();
+				skip_space_();
+				if(ch_ == ')') {
+					ch_ = *tx_++;
+				} else {
+					error_.set(error::fatal);
+				}
+			} else {
+				number_();
+			}
+		}
+
+
+		void term_() {
+			factor_();
+			while(error_() == 0) {
+				switch(ch_) {
+				case ' ':
+				case '\t':
+					ch_ = *tx_++;
+					break;
+				case '*':
+					ch_ = *tx_++;
+					factor_();
+					emit_(code::MUL);
+					break;
+				case '%':
+					ch_ = *tx_++;
+					factor_();
+					emit_(code::DIV);
+					break;
+				case '/':
+					ch_ = *tx_++;
+					if(ch_ == '/') {
+						ch_ = *tx_++;
+						factor_();
+						emit_(code::MOD);
+					} else {
+						factor_();
+						emit_(code::DIV);
+					}
+					break;
+				case '<':
+					ch_ = *tx_++;
+					if(ch_ == '<') {
+						ch_ = *tx_++;
+						factor_();
+						emit_(code::SHL);
+					} else {
+						error_.set(error::fatal);
+					}
+					break;
+				case '>':
+					ch_ = *tx_++;
+					if(ch_ == '>') {
+						ch_ = *tx_++;
+						factor_();
+						emit_(code::SHR);
+					} else {
+						error_.set(error::fatal);
+					}
+					break;
+				default:
+					return;
+				}
+			}
+		}
+
+
+		void expression_() {
+			term_();
+			while(error_() == 0) {
+				switch(ch_) {
+				case ' ':
+				case '\t':
+					ch_ = *tx_++;
+					break;
+				case '+':
+					ch_ = *tx_++;
+					term_();
+					emit_(code::ADD);
+					break;
+				case '-':
+					ch_ = *tx_++;
+					term_();
+					emit_(code::SUB);
+					break;
+				case '&':
+					ch_ = *tx_++;
+					term_();
+					emit_(code::AND);
+					break;
+				case '^':
+					ch_ = *tx_++;
+					term_();
+					emit_(code::XOR);
+					break;
+				case '|':
+					ch_ = *tx_++;
+					term_();
+					emit_(code::OR);
+					break;
+				default:
+					return;
+				}
+			}
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		arith_code() : tx_(nullptr), ch_(0), sym_(nullptr), symn_(0), error_(),
+			pos_(0), cnum_(0), depth_(0), last_(0) { code_[0] = 0; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンパイル
+			@param[in]	text	解析テキスト
+			@param[in]	sym		変数名テーブル（インデックスが変数スロット）
+			@param[in]	symn	変数の数
+			@return	文法にエラーがあった場合、「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool compile(const char* text, const char* const* sym = nullptr, uint8_t symn = 0) {
+			error_.clear();
+			pos_ = 0;
+			cnum_ = 0;
+			depth_ = 0;
+			last_ = 0;
+			code_[0] = 0;
+			if(text == nullptr || symn > 0x80) {
+				error_.set(error::fatal);
+				return false;
+			}
+			tx_ = text;
+			sym_ = sym;
+			symn_ = symn;
+
+			ch_ = *tx_++;
+			if(ch_ != 0) {
+				expression_();
+			} else {
+				error_.set(error::fatal);
+			}
+
+			if(error_() == 0 && ch_ != 0) {
+				error_.set(error::fatal);
+			}
+			if(error_() != 0) {
+				pos_ = 0;
+				code_[0] = 0;
+				return false;
+			}
+			code_[pos_] = static_cast<uint8_t>(code::END);
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	評価
+			@param[in]	var	変数テーブル
+			@param[out]	ans	結果
+			@return	０除算の場合、未コンパイルの場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool run(const VTYPE* var, VTYPE& ans) const {
+			if(pos_ == 0) return false;
+
+			VTYPE stk[SNUM];
+			VTYPE* sp = stk;
+			const uint8_t* p = code_;
+			while(1) {
+				uint8_t c = *p++;
+				if(c & static_cast<uint8_t>(code::VAR)) {
+					*sp++ = var[c & 0x7F];
+					continue;
+				} else if(c & static_cast<uint8_t>(code::CONST)) {
+					*sp++ = const_[c & 0x3F];
+					continue;
+				}
+				if(c == static_cast<uint8_t>(code::END)) break;
+				if(c == static_cast<uint8_t>(code::NEG)) {
+					sp[-1] = -sp[-1];
+					continue;
+				}
+				--sp;
+				VTYPE b = *sp;
+				VTYPE& a = sp[-1];
+				switch(static_cast<code>(c)) {
+				case code::ADD: a += b; break;
+				case code::SUB: a -= b; break;
+				case code::MUL: a *= b; break;
+				case code::DIV:
+					if(b == 0) return false;
+					a /= b;
+					break;
+				case code::MOD:
+					if(b == 0) return false;
+					arith_op<VTYPE>::mod(a, b);
+					break;
+				case code::AND: arith_op<VTYPE>::and_(a, b); break;
+				case code::XOR: arith_op<VTYPE>::xor_(a, b); break;
+				case code::OR:  arith_op<VTYPE>::or_(a, b); break;
+				case code::SHL: arith_op<VTYPE>::shl(a, b); break;
+				case code::SHR: arith_op<VTYPE>::shr(a, b); break;
+				default:
+					break;
+				}
+			}
+			ans = stk[0];
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	エラーを受け取る
+			@return エラー
+		*/
+		//-----------------------------------------------------------------//
+		const error_t& get_error() const { return error_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コード・サイズを取得（終端を含まない）
+			@return	コード・サイズ
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_code_size() const { return pos_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	定数の数を取得
+			@return	定数の数
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_const_num() const { return cnum_; }
+	};
+}
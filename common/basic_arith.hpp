@@ -11,10 +11,67 @@
 */
 //=====================================================================//
 #include <cstdint>
+#include <type_traits>
 #include "common/bitset.hpp"
 
 namespace utils {
 
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	Arithmetic 演算補助 @n
+				・小数表記の数値を、基本型へ変換 @n
+				　基本型に「from_decimal」がある場合は、それを使う @n
+				・剰余、ビット演算、シフト（浮動小数点型では「false」）
+		@param[in]	VTYPE	基本型
+		@param[in]	REAL	浮動小数点型の場合「true」
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <typename VTYPE, bool REAL = std::is_floating_point<VTYPE>::value>
+	struct arith_op {
+
+		template <typename T>
+		static auto decimal_(uint32_t v, uint32_t fp, uint32_t fs, int)
+			-> decltype(T::from_decimal(v, fp, fs)) {
+			return T::from_decimal(v, fp, fs);
+		}
+
+		template <typename T>
+		static T decimal_(uint32_t v, uint32_t fp, uint32_t fs, long) {
+			T a = static_cast<T>(v);
+			if(fs > 1) a += static_cast<T>(fp) / static_cast<T>(fs);
+			return a;
+		}
+
+		static VTYPE decimal(uint32_t v, uint32_t fp, uint32_t fs) {
+			return decimal_<VTYPE>(v, fp, fs, 0);
+		}
+
+		static bool mod(VTYPE& a, const VTYPE& b) { a %= b; return true; }
+		static bool and_(VTYPE& a, const VTYPE& b) { a &= b; return true; }
+		static bool xor_(VTYPE& a, const VTYPE& b) { a ^= b; return true; }
+		static bool or_(VTYPE& a, const VTYPE& b) { a |= b; return true; }
+		static bool shl(VTYPE& a, const VTYPE& b) { a <<= b; return true; }
+		static bool shr(VTYPE& a, const VTYPE& b) { a >>= b; return true; }
+	};
+
+	template <typename VTYPE>
+	struct arith_op<VTYPE, true> {
+
+		static VTYPE decimal(uint32_t v, uint32_t fp, uint32_t fs) {
+			VTYPE a = static_cast<VTYPE>(v);
+			if(fs > 1) a += static_cast<VTYPE>(fp) / static_cast<VTYPE>(fs);
+			return a;
+		}
+
+		static bool mod(VTYPE& a, const VTYPE& b) { return false; }
+		static bool and_(VTYPE& a, const VTYPE& b) { return false; }
+		static bool xor_(VTYPE& a, const VTYPE& b) { return false; }
+		static bool or_(VTYPE& a, const VTYPE& b) { return false; }
+		static bool shl(VTYPE& a, const VTYPE& b) { return false; }
+		static bool shr(VTYPE& a, const VTYPE& b) { return false; }
+	};
+
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief	Arithmetic クラス
@@ -65,6 +122,7 @@ namespace utils {
 			uint32_t v = 0;
 			uint32_t fp = 0;
 			uint32_t fs = 1;
+			VTYPE a = 0;
 
 			skip_space_();
 
@@ -82,7 +140,7 @@ namespace utils {
 			skip_space_();
 
 			if(ch_ == '(') {
-				v = factor_();
+				a = factor_();
 			} else {
 				skip_space_();
 
@@ -134,15 +192,12 @@ namespace utils {
 					}
 				}
 #endif
+				a = arith_op<VTYPE>::decimal(v, fp, fs);
 			}
 
-			if(inv) { v = -v; }
-///			if(neg) { v = ~v; }
-			if(point) {
-				return static_cast<VTYPE>(v) + static_cast<VTYPE>(fp) / static_cast<VTYPE>(fs);
-			} else {
-				return static_cast<VTYPE>(v);
-			}
+			if(inv) { a = -a; }
+///			if(neg) { a = ~a; }
+			return a;
 		}
 
 
@@ -194,7 +249,7 @@ namespace utils {
 							error_.set(error::zero_divide);
 							break;
 						}
-						v %= tmp;
+						if(!arith_op<VTYPE>::mod(v, tmp)) error_.set(error::fatal);
 					} else {
 						tmp = factor_();
 						if(tmp == 0) {
@@ -208,7 +263,8 @@ namespace utils {
 					ch_ = *tx_++;
 					if(ch_ == '<') {
 						ch_ = *tx_++;
-						v <<= factor_();
+						tmp = factor_();
+						if(!arith_op<VTYPE>::shl(v, tmp)) error_.set(error::fatal);
 					} else {
 						error_.set(error::fatal);
 					}
@@ -217,7 +273,8 @@ namespace utils {
 					ch_ = *tx_++;
 					if(ch_ == '>') {
 						ch_ = *tx_++;
-						v <<= factor_();
+						tmp = factor_();
+						if(!arith_op<VTYPE>::shr(v, tmp)) error_.set(error::fatal);
 					} else {
 						error_.set(error::fatal);
 					}
@@ -233,6 +290,7 @@ namespace utils {
 
 		VTYPE expression_() {
 			VTYPE v = term_();
+			VTYPE tmp;
 			while(error_() == 0) {
 				switch(ch_) {
 				case ' ':
@@ -249,15 +307,18 @@ namespace utils {
 					break;
 				case '&':
 					ch_ = *tx_++;
-					v &= term_();
+					tmp = term_();
+					if(!arith_op<VTYPE>::and_(v, tmp)) error_.set(error::fatal);
 					break;
 				case '^':
 					ch_ = *tx_++;
-					v ^= term_();
+					tmp = term_();
+					if(!arith_op<VTYPE>::xor_(v, tmp)) error_.set(error::fatal);
 					break;
 				case '|':
 					ch_ = *tx_++;
-					v |= term_();
+					tmp = term_();
+					if(!arith_op<VTYPE>::or_(v, tmp)) error_.set(error::fatal);
 					break;
 				default:
 					return v;
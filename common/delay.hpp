@@ -1,7 +1,12 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	delay ユーティリティー
+	@brief	delay ユーティリティー @n
+			・待ちは、F_CLK から求めたサイクル数の、adjnz ループと nop @n
+			・cycles、nano、micro は、コンパイル時に、回数と端数を決める @n
+			・ループのサイクル数（DELAY_LOOP_CYCLES、DELAY_US_CYCLES）は、@n
+			　ソフトウェアマニュアルの値、実測と違う場合は、Makefile で定義する @n
+			※割り込みが入ると、その分だけ長くなる
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2015, 2017 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -9,28 +14,152 @@
 */
 //=====================================================================//
 #include <cstdint>
+#ifdef IO_HOST
+#include "common/io_utils.hpp"
+#endif
+
+/// F_CLK は待ちのサイクル計算で必要で、設定が無いとエラーにします。
+#ifndef F_CLK
+#  error "delay.hpp requires F_CLK to be defined"
+#endif
+
+/// adjnz.w（分岐）の１回のサイクル
+#ifndef DELAY_LOOP_CYCLES
+#  define DELAY_LOOP_CYCLES 5
+#endif
+
+/// micro_second の１回（1us）毎の、ループ以外のサイクル（カウンターの更新、分岐）
+#ifndef DELAY_US_CYCLES
+#  define DELAY_US_CYCLES 5
+#endif
 
 namespace utils {
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
-		@brief  基準クロック２０ＭＨｚの待ち
+		@brief  F_CLK の待ち
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	struct delay {
 
+		static constexpr uint32_t LOOP_CYCLES = DELAY_LOOP_CYCLES;
+		static constexpr uint32_t LOOP_MAX = 65535;
+
+		/// 1us のサイクル
+		static constexpr uint32_t US_CYCLES = F_CLK / 1000000;
+
+	private:
+		// n 回のループ（5n サイクル、設定の mov を含む）、n は 1 以上
+		static void loop_(uint16_t n) {
+#if defined(IO_HOST)
+			device::io_host_delay(static_cast<uint32_t>(n) * LOOP_CYCLES);
+#elif defined(__m32c__)
+			asm volatile ("1:\n\tadjnz.w #-1,%0,1b" : "+r" (n));
+#else
+			// ホストのネイティブ・ビルド（時間は合わない）
+			while(n > 0) {
+				asm volatile ("nop");
+				--n;
+			}
+#endif
+		}
+
+		template <uint32_t N, bool ZERO = (N == 0)>
+		struct nop_ {
+			static void run() {
+#ifdef IO_HOST
+				device::io_host_delay(N);
+#else
+				asm volatile ("nop");
+				nop_<N - 1>::run();
+#endif
+			}
+		};
+
+		template <uint32_t N>
+		struct nop_<N, true> {
+			static void run() { }
+		};
+
+		template <uint32_t N, bool LONG = (N / LOOP_CYCLES > LOOP_MAX)>
+		struct cycles_ {
+			static void run() {
+				if(N / LOOP_CYCLES) loop_(N / LOOP_CYCLES);
+				nop_<N % LOOP_CYCLES>::run();
+			}
+		};
+
+		template <uint32_t N>
+		struct cycles_<N, true> {
+			static void run() {
+				cycles_<LOOP_MAX * LOOP_CYCLES>::run();
+				cycles_<N - LOOP_MAX * LOOP_CYCLES>::run();
+			}
+		};
+
+		static constexpr uint32_t US_BODY = US_CYCLES > DELAY_US_CYCLES ? US_CYCLES - DELAY_US_CYCLES : 0;
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ループ単位の待ち（LOOP_CYCLES x n サイクル）@n
+					回数を、実行時に決める場合（iica_io のビット時間など）
+			@param[in]	n	回数（0 なら待たない）
+		*/
+		//-----------------------------------------------------------------//
+		static void loop(uint16_t n) {
+			if(n > 0) loop_(n);
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  ナノ秒単位の待ち
+			@brief  サイクル単位の待ち（コンパイル時）
+			@param[in]	N	サイクル
+		*/
+		//-----------------------------------------------------------------//
+		template <uint32_t N>
+		static void cycles() { cycles_<N>::run(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ナノ秒単位の待ち（コンパイル時、サイクルに切り上げ）
+			@param[in]	NS	待ち時間（ナノ秒）
+		*/
+		//-----------------------------------------------------------------//
+		template <uint32_t NS>
+		static void nano() {
+			cycles_<static_cast<uint32_t>((static_cast<uint64_t>(F_CLK) * NS + 999999999) / 1000000000)>::run();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  マイクロ秒単位の待ち（コンパイル時）
+			@param[in]	US	待ち時間（マイクロ秒）
+		*/
+		//-----------------------------------------------------------------//
+		template <uint32_t US>
+		static void micro() {
+			cycles_<static_cast<uint32_t>(static_cast<uint64_t>(F_CLK) * US / 1000000)>::run();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ナノ秒単位の待ち（ループの単位に切り上げ）
 			@param[in]	ns	待ち時間（ナノ秒）
 		*/
 		//-----------------------------------------------------------------//
 		static void nano_second(uint16_t ns) {
-			ns /= 50;   ///< 20MHz clock base
-			while(ns > 0) {
-				asm("nop");
-				--ns;
+			uint32_t c = (static_cast<uint32_t>(ns) * US_CYCLES + 999) / 1000;
+			uint32_t n = (c + LOOP_CYCLES - 1) / LOOP_CYCLES;
+			while(n > LOOP_MAX) {
+				loop_(LOOP_MAX);
+				n -= LOOP_MAX;
 			}
+			if(n > 0) loop_(n);
 		}
 
 
@@ -41,17 +170,12 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		static void micro_second(uint16_t us) {
+#ifdef IO_HOST
+			device::io_host_delay(static_cast<uint32_t>(us) * US_CYCLES);
+			us = 0;
+#endif
 			while(us > 0) {
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
-				asm("nop");
+				cycles_<US_BODY>::run();
 				--us;
 			}
 		}
@@ -69,4 +193,46 @@ namespace utils {
 			}
 		}
 	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  待ちループのタイムアウト（ドライバーの TIMEOUT の標準）@n
+				タイマーを使わず、pause の待ちだけを数える（その間の処理の @n
+				時間は数えないので、実際のタイムアウトは、少し長くなる）@n
+				ティックで計る場合は、soft_timer の timeout を使う
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class delay_timeout {
+		uint32_t	rest_;	///< 残り（マイクロ秒）
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター（開始）
+			@param[in]	ms	タイムアウト（ミリ秒）
+		*/
+		//-----------------------------------------------------------------//
+		explicit delay_timeout(uint16_t ms) : rest_(static_cast<uint32_t>(ms) * 1000) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  時間が過ぎたか
+			@return 過ぎたら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool expired() const { return rest_ == 0; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  次に調べるまでの待ち
+			@param[in]	us	待ち（マイクロ秒）
+		*/
+		//-----------------------------------------------------------------//
+		void pause(uint16_t us) {
+			delay::micro_second(us);
+			rest_ = rest_ > us ? rest_ - us : 0;
+		}
+	};
 }
@@ -0,0 +1,220 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	固定小数点テンプレート @n
+			・全ての演算は、整数演算のみで行う（ソフト浮動小数点不要） @n
+			・加減乗除、符号反転、シフトは、飽和演算 @n
+			・ビット演算、剰余は、内部表現（raw 値）に対して行う @n
+			・「basic_arith」で、小数表記の数値を直接変換出来る @n
+			・「format」の「%N.My」で、そのまま表示出来る
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <type_traits>
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  固定小数点クラス
+		@param[in]	T		内部表現型（符号付き整数、最大３２ビット）
+		@param[in]	FRAC	小数部のビット数
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <typename T, uint8_t FRAC>
+	class fixed_point {
+
+		static_assert(std::is_signed<T>::value && sizeof(T) <= 4, "T must be signed and 32 bits or less");
+		static_assert(FRAC < (sizeof(T) * 8 - 1), "FRAC too large");
+
+	public:
+		typedef T value_type;	///< 内部表現型
+		typedef typename std::make_unsigned<T>::type unsigned_type;	///< 符号無し内部表現型
+		typedef typename std::conditional<(sizeof(T) <= 2), int32_t, int64_t>::type wide_type;	///< 乗除算用
+
+		static const uint8_t FRAC_BITS = FRAC;	///< 小数部のビット数
+		static const uint8_t BITS = sizeof(T) * 8;	///< 全ビット数
+		static const T RAW_MAX = static_cast<T>(static_cast<unsigned_type>(~0) >> 1);	///< 最大値
+		static const T RAW_MIN = -RAW_MAX - 1;	///< 最小値
+
+	private:
+		T	v_;
+
+		static T sat_(wide_type v) {
+			if(v > RAW_MAX) return RAW_MAX;
+			else if(v < RAW_MIN) return RAW_MIN;
+			return static_cast<T>(v);
+		}
+
+		static T add_(T a, T b) {
+			unsigned_type r = static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b);
+			// 同符号の加算で、符号が変わったらオーバーフロー
+			if(static_cast<T>((a ^ r) & (b ^ r)) < 0) {
+				return a < 0 ? RAW_MIN : RAW_MAX;
+			}
+			return static_cast<T>(r);
+		}
+
+		static T sub_(T a, T b) {
+			unsigned_type r = static_cast<unsigned_type>(a) - static_cast<unsigned_type>(b);
+			// 異符号の減算で、符号が変わったらオーバーフロー
+			if(static_cast<T>((a ^ b) & (a ^ r)) < 0) {
+				return a < 0 ? RAW_MIN : RAW_MAX;
+			}
+			return static_cast<T>(r);
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		fixed_point() : v_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター（整数から変換、飽和）
+			@param[in]	v	整数値
+		*/
+		//-----------------------------------------------------------------//
+		template <typename I, typename = typename std::enable_if<std::is_integral<I>::value>::type>
+		fixed_point(I v) : v_(0) {
+			if(std::is_signed<I>::value && v < 0) {
+				if(static_cast<int32_t>(v) < static_cast<int32_t>(RAW_MIN >> FRAC)) v_ = RAW_MIN;
+				else v_ = static_cast<T>(static_cast<unsigned_type>(static_cast<T>(v)) << FRAC);
+			} else {
+				if(static_cast<uint32_t>(v) > static_cast<uint32_t>(RAW_MAX >> FRAC)) v_ = RAW_MAX;
+				else v_ = static_cast<T>(v) << FRAC;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  内部表現から生成
+			@param[in]	raw	内部表現
+			@return 固定小数点
+		*/
+		//-----------------------------------------------------------------//
+		static fixed_point from_raw(T raw) {
+			fixed_point t;
+			t.v_ = raw;
+			return t;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  １０進表記から生成（四捨五入、飽和） @n
+					ipart + fpart / fscale
+			@param[in]	ipart	整数部
+			@param[in]	fpart	小数部
+			@param[in]	fscale	小数部のスケール（10, 100, 1000 ...）
+			@return 固定小数点
+		*/
+		//-----------------------------------------------------------------//
+		static fixed_point from_decimal(uint32_t ipart, uint32_t fpart, uint32_t fscale) {
+			fixed_point t(ipart);
+			if(fscale > 1 && fpart > 0) {
+				uint64_t f = ((static_cast<uint64_t>(fpart) << FRAC) + (fscale >> 1)) / fscale;
+				t.v_ = add_(t.v_, static_cast<T>(f));
+			}
+			return t;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  内部表現を取得
+			@return 内部表現
+		*/
+		//-----------------------------------------------------------------//
+		T get_raw() const { return v_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  整数部を取得（負の無限大方向への切り捨て）
+			@return 整数部
+		*/
+		//-----------------------------------------------------------------//
+		T get_int() const { return v_ >> FRAC; }
+
+
+		fixed_point operator - () const {
+			return from_raw(v_ == RAW_MIN ? RAW_MAX : -v_);
+		}
+
+		fixed_point& operator += (const fixed_point& t) { v_ = add_(v_, t.v_); return *this; }
+		fixed_point& operator -= (const fixed_point& t) { v_ = sub_(v_, t.v_); return *this; }
+
+		fixed_point& operator *= (const fixed_point& t) {
+			v_ = sat_((static_cast<wide_type>(v_) * t.v_) >> FRAC);
+			return *this;
+		}
+
+		fixed_point& operator /= (const fixed_point& t) {
+			if(t.v_ == 0) {
+				v_ = v_ < 0 ? RAW_MIN : RAW_MAX;
+			} else {
+				v_ = sat_((static_cast<wide_type>(v_) * (static_cast<wide_type>(1) << FRAC)) / t.v_);
+			}
+			return *this;
+		}
+
+		fixed_point& operator %= (const fixed_point& t) {
+			if(t.v_ != 0) v_ %= t.v_;
+			return *this;
+		}
+
+		fixed_point& operator &= (const fixed_point& t) { v_ &= t.v_; return *this; }
+		fixed_point& operator |= (const fixed_point& t) { v_ |= t.v_; return *this; }
+		fixed_point& operator ^= (const fixed_point& t) { v_ ^= t.v_; return *this; }
+
+		fixed_point& operator <<= (const fixed_point& t) {
+			T n = t.get_int();
+			if(n <= 0 || v_ == 0) return *this;
+			if(n >= BITS) v_ = v_ < 0 ? RAW_MIN : RAW_MAX;
+			else v_ = sat_(static_cast<wide_type>(v_) * (static_cast<wide_type>(1) << n));
+			return *this;
+		}
+
+		fixed_point& operator >>= (const fixed_point& t) {
+			T n = t.get_int();
+			if(n <= 0) return *this;
+			if(n >= BITS) n = BITS - 1;
+			v_ >>= n;
+			return *this;
+		}
+
+		fixed_point operator + (const fixed_point& t) const { fixed_point a(*this); a += t; return a; }
+		fixed_point operator - (const fixed_point& t) const { fixed_point a(*this); a -= t; return a; }
+		fixed_point operator * (const fixed_point& t) const { fixed_point a(*this); a *= t; return a; }
+		fixed_point operator / (const fixed_point& t) const { fixed_point a(*this); a /= t; return a; }
+		fixed_point operator % (const fixed_point& t) const { fixed_point a(*this); a %= t; return a; }
+		fixed_point operator & (const fixed_point& t) const { fixed_point a(*this); a &= t; return a; }
+		fixed_point operator | (const fixed_point& t) const { fixed_point a(*this); a |= t; return a; }
+		fixed_point operator ^ (const fixed_point& t) const { fixed_point a(*this); a ^= t; return a; }
+		fixed_point operator << (const fixed_point& t) const { fixed_point a(*this); a <<= t; return a; }
+		fixed_point operator >> (const fixed_point& t) const { fixed_point a(*this); a >>= t; return a; }
+
+		bool operator == (const fixed_point& t) const { return v_ == t.v_; }
+		bool operator != (const fixed_point& t) const { return v_ != t.v_; }
+		bool operator <  (const fixed_point& t) const { return v_ <  t.v_; }
+		bool operator <= (const fixed_point& t) const { return v_ <= t.v_; }
+		bool operator >  (const fixed_point& t) const { return v_ >  t.v_; }
+		bool operator >= (const fixed_point& t) const { return v_ >= t.v_; }
+	};
+
+	template <typename T, uint8_t FRAC> const T fixed_point<T, FRAC>::RAW_MAX;
+	template <typename T, uint8_t FRAC> const T fixed_point<T, FRAC>::RAW_MIN;
+
+	typedef fixed_point<int32_t, 16> q16_16;	///< Q16.16 形式
+	typedef fixed_point<int16_t, 8>  q8_8;		///< Q8.8 形式
+}
@@ -1,7 +1,12 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	R8C グループ・フラッシュ制御
+	@brief	R8C グループ・フラッシュ制御 @n
+			データ・フラッシュの書き換えは、EW1 モードのバックグラウンド動作 @n
+			（プログラム ROM 上の CPU は止まらない）を使い、割り込みを禁止するのは、@n
+			レジスターの連続書き込みと、コマンド発行の間だけにする。@n
+			※書き換え中（消去、書き込み）の割り込み処理から、データ・フラッシュを @n
+			読んではいけない
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2015, 2021 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -32,7 +37,7 @@ namespace device {
 		};
 
 	private:
-		void sleep_() const { asm("nop"); }
+		void sleep_() const { io_sleep_(); }
 
 		void sync_() const {
 			while(FST.FST7() == 0) {
@@ -40,7 +45,8 @@ namespace device {
 			}
 		}
 
-		void enable_(uint16_t ofs) const {
+		// ofs から len バイトを含むバンクを書き換え可能にする（割り込み禁止で呼ぶ）
+		void enable_(uint16_t ofs, uint16_t len) const {
 			FMR0.FMR01 = 0;
 			FMR0.FMR01 = 1;  // CPU 書き換え有効
 			FMR0.FMR02 = 0;
@@ -48,32 +54,36 @@ namespace device {
 			if(ofs < 0x0400) {
 				FMR1.FMR16 = 1;
 				FMR1.FMR16 = 0;
-			} else {
+			}
+			if((ofs + len) > 0x0400) {
 				FMR1.FMR17 = 1;
 				FMR1.FMR17 = 0;
 			}
 		}
 
-		void disable_(uint16_t ofs) const {
-			if(ofs < 0x0400) {
-				FMR1.FMR16 = 1;
-			} else {
-				FMR1.FMR17 = 1;
-			}
+		void disable_() const {
+			FMR1.FMR16 = 1;
+			FMR1.FMR17 = 1;
 			FMR0.FMR01 = 0;  // CPU 書き換え無効
 		}
 
+		// エラーならステータスを消去
+		bool status_(bool err) const {
+			if(err) {
+				di();
+				wr8_(0x3000, 0x50);  // ステータス消去
+				ei();
+			}
+			return !err;
+		}
+
 		bool write_(uint16_t ofs, uint8_t data) const {
+			di();
 			wr8_(0x3000 + ofs, 0x40);
 			wr8_(0x3000 + ofs, data);
-			sync_();
-
-			bool ret = FST.FST4();
-			if(ret) {
-				wr8_(0x3000, 0x50);  // ステータス消去 
-			}
-
-			return !ret;
+			ei();
+			sync_();  // 書き込み中は、割り込みを受け付ける
+			return status_(FST.FST4());
 		}
 
 	public:
@@ -103,23 +113,20 @@ namespace device {
 			}
 
 			di();
-			enable_(ofs);
-
+			enable_(ofs, 1);
 			wr8_(0x3000,       0x20);  // ブロック消去
 			wr8_(0x3000 + ofs, 0xd0);
-			sync_();
+			ei();
+			sync_();  // 消去中は、割り込みを受け付ける
 
-			bool ret = FST.FST5();
-			if(ret) {
-				wr8_(0x3000, 0x50);  // ステータス消去 
-			}
+			bool ret = status_(FST.FST5());
 
+			di();
 			wr8_(0x3000, 0xff);
-
-			disable_(ofs);
+			disable_();
 			ei();
 
-			return !ret;
+			return ret;
 		}
 
 
@@ -169,30 +176,19 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		bool write(uint16_t ofs, uint8_t data) const {
-			if(ofs >= 0x0800) {
-				return false;
-			}
-
-			di();
-			enable_(ofs);
-
-			bool ret = write_(ofs, data);
-
-			wr8_(0x3000, 0xff);
-
-			disable_(ofs);
-			ei();
-
-			return ret;
+			return write(&data, ofs, 1);
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  書き込み
+			@brief  書き込み @n
+					書き換えモードへの切り替えは１回だけで、１バイト毎の @n
+					書き込み時間の間は、割り込みを受け付ける
 			@param[in]	src ソース
 			@param[in]	ofs	開始オフセット
 			@param[in]	len	バイト数
+			@return エラーがあれば「false」
 		*/
 		//-----------------------------------------------------------------//
 		bool write(const uint8_t* src, uint16_t ofs, uint16_t len) const {
@@ -201,18 +197,19 @@ namespace device {
 			}
 
 			di();
-			enable_(ofs);
+			enable_(ofs, len);
+			ei();
 
-			bool ret;
+			bool ret = true;
 			for(uint16_t i = 0; i < len; ++i) {
 				ret = write_(ofs + i, *src);
 				if(!ret) break;
 				++src;
 			}
 
+			di();
 			wr8_(0x3000, 0xff);
-
-			disable_(ofs);
+			disable_();
 			ei();
 
 			return ret;
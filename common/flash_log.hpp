@@ -0,0 +1,293 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	データ・フラッシュ上のログ構造キー／値ストア @n
+			・BANK0/BANK1 の片方に、レコードを追記する（消去無しで更新）@n
+			・レコード：key(1) len(1) data(len) CRC16(2, big endian) @n
+			・CRC は最後に書くので、書き込み途中の電源断は無効なレコードになる @n
+			・起動時にバンクを走査して、キー毎の最新レコードの位置を RAM に持つ @n
+			・バンクが一杯になると、有効なレコードだけを、もう一方のバンクへ @n
+			　詰めて移し（GC）、最後にバンク・ヘッダーを書いて切り替える @n
+			・バンク・ヘッダー：MAGIC seq ~seq（seq が新しい方が有効）@n
+			FLASH クラスには、flash_io と同じ、以下の関数が必要 @n
+			　bool erase(DATA_AREA bank); @n
+			　uint8_t read(uint16_t ofs); @n
+			　bool write(const uint8_t* src, uint16_t ofs, uint16_t len);
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include "common/packet_io.hpp"
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  フラッシュ・ログ・クラス
+		@param[in]	FLASH	フラッシュ制御クラス（device::flash_io）
+		@param[in]	KEYS	キーの数（0 ～ KEYS-1、RAM はキー当たり２バイト）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class FLASH, uint8_t KEYS>
+	class flash_log {
+	public:
+		static const uint16_t BANK_SIZE = 0x0400;	///< バンクのサイズ
+		static const uint8_t  HEAD_SIZE = 3;		///< バンク・ヘッダーのサイズ
+		static const uint8_t  REC_EXTRA = 4;		///< レコードの key、len、CRC
+		static const uint8_t  LEN_MAX = 250;		///< データの最大長（0 は削除）
+
+	private:
+		static const uint8_t  MAGIC = 0x4B;
+		static const uint16_t NONE = 0xFFFF;
+		static const uint8_t  COPY = 16;
+
+		FLASH&		flash_;
+
+		uint16_t	index_[KEYS];	///< 最新レコードのオフセット
+		uint16_t	base_;			///< 有効バンクの先頭
+		uint16_t	tail_;			///< 追記位置（バンク内）
+		uint8_t		seq_;
+
+		static typename FLASH::DATA_AREA area_(uint16_t base) {
+			return base == 0 ? FLASH::DATA_AREA::BANK0 : FLASH::DATA_AREA::BANK1;
+		}
+
+		bool head_valid_(uint16_t base) const {
+			return flash_.read(base) == MAGIC
+				&& static_cast<uint8_t>(flash_.read(base + 1) ^ flash_.read(base + 2)) == 0xFF;
+		}
+
+		bool write_head_(uint16_t base, uint8_t seq) {
+			uint8_t tmp[HEAD_SIZE] = { MAGIC, seq, static_cast<uint8_t>(~seq) };
+			return flash_.write(tmp, base, HEAD_SIZE);
+		}
+
+
+		// レコードを確認、有効なら「true」（len が不正なら end を「true」）
+		bool check_(uint16_t pos, uint8_t& len, bool& end) const {
+			end = false;
+			len = flash_.read(base_ + pos + 1);
+			if(len > LEN_MAX || (pos + REC_EXTRA + len) > BANK_SIZE) {
+				end = true;
+				return false;
+			}
+			uint16_t crc = crc16::INIT;
+			uint16_t n = len + 2;
+			for(uint16_t i = 0; i < n; ++i) {
+				crc = crc16::update(crc, flash_.read(base_ + pos + i));
+			}
+			uint16_t org = (flash_.read(base_ + pos + n) << 8) | flash_.read(base_ + pos + n + 1);
+			return crc == org;
+		}
+
+
+		void scan_() {
+			for(uint8_t i = 0; i < KEYS; ++i) index_[i] = NONE;
+			uint16_t pos = HEAD_SIZE;
+			while((pos + REC_EXTRA) <= BANK_SIZE) {
+				uint8_t key = flash_.read(base_ + pos);
+				if(key == 0xFF) break;  // 未書き込み
+				uint8_t len;
+				bool end;
+				bool ok = check_(pos, len, end);
+				if(end) {  // 壊れた長さ、以降は使わない（次の書き込みで GC）
+					pos = BANK_SIZE;
+					break;
+				}
+				if(ok && key < KEYS) {
+					index_[key] = len == 0 ? NONE : pos;
+				}
+				pos += REC_EXTRA + len;
+			}
+			tail_ = pos;
+		}
+
+
+		bool append_(uint8_t key, const uint8_t* src, uint8_t len) {
+			uint8_t tmp[2] = { key, len };
+			uint16_t crc = crc16::calc(tmp, 2);
+			crc = crc16::calc(src, len, crc);
+			uint16_t pos = base_ + tail_;
+			// 失敗したら、このバンクには追記しない（未書き込みの穴で scan_ が止まる為、次の書き込みで GC）
+			tail_ = BANK_SIZE;
+			if(!flash_.write(tmp, pos, 2)) return false;
+			if(len > 0 && !flash_.write(src, pos + 2, len)) return false;
+			tmp[0] = crc >> 8;
+			tmp[1] = crc & 0xff;
+			// CRC を最後に書く（コミット）
+			if(!flash_.write(tmp, pos + 2 + len, 2)) return false;
+			tail_ = pos - base_ + REC_EXTRA + len;
+			index_[key] = len == 0 ? NONE : (pos - base_);
+			return true;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+			@param[in]	flash	フラッシュ制御クラス
+		*/
+		//-----------------------------------------------------------------//
+		flash_log(FLASH& flash) : flash_(flash), index_{ 0 }, base_(0), tail_(BANK_SIZE), seq_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  開始（有効なバンクを選んで、インデックスを作る）@n
+					有効なバンクが無ければ、BANK0 を初期化する
+			@return エラーがあれば「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start() {
+			bool v0 = head_valid_(0);
+			bool v1 = head_valid_(BANK_SIZE);
+			if(v0 && v1) {  // GC の後、旧バンクは次の GC まで残る
+				uint8_t s0 = flash_.read(1);
+				uint8_t s1 = flash_.read(BANK_SIZE + 1);
+				v0 = static_cast<int8_t>(s0 - s1) > 0;
+				v1 = !v0;
+			}
+			if(v0 || v1) {
+				base_ = v0 ? 0 : BANK_SIZE;
+				seq_ = flash_.read(base_ + 1);
+				scan_();
+				return true;
+			}
+			base_ = 0;
+			seq_ = 0;
+			for(uint8_t i = 0; i < KEYS; ++i) index_[i] = NONE;
+			tail_ = HEAD_SIZE;
+			if(!flash_.erase(area_(0))) return false;
+			return write_head_(0, 0);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  有効なレコードを、もう一方のバンクへ移す
+			@return エラーがあれば「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool collect() {
+			uint16_t dst = base_ ^ BANK_SIZE;
+			if(!flash_.erase(area_(dst))) return false;
+			// 新しい位置は、切り替えが終わるまで index_ に入れない（失敗時は旧バンクのまま）
+			uint16_t idx[KEYS];
+			uint16_t pos = HEAD_SIZE;
+			for(uint8_t key = 0; key < KEYS; ++key) {
+				idx[key] = NONE;
+				if(index_[key] == NONE) continue;
+				uint16_t src = base_ + index_[key];
+				uint16_t n = REC_EXTRA + flash_.read(src + 1);
+				uint16_t top = pos;
+				for(uint16_t i = 0; i < n; i += COPY) {
+					uint8_t tmp[COPY];
+					uint8_t m = (n - i) < COPY ? (n - i) : COPY;
+					for(uint8_t j = 0; j < m; ++j) tmp[j] = flash_.read(src + i + j);
+					if(!flash_.write(tmp, dst + pos + i, m)) return false;
+				}
+				pos += n;
+				idx[key] = top;
+			}
+			// ヘッダーを最後に書いて、切り替える
+			if(!write_head_(dst, seq_ + 1)) return false;
+			for(uint8_t key = 0; key < KEYS; ++key) index_[key] = idx[key];
+			++seq_;
+			base_ = dst;
+			tail_ = pos;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  書き込み（同じ値なら何もしない）
+			@param[in]	key	キー
+			@param[in]	src	データ
+			@param[in]	len	長さ（0 なら削除）
+			@return エラーがあれば「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool write(uint8_t key, const void* src, uint8_t len) {
+			if(key >= KEYS || len > LEN_MAX) return false;
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			if(index_[key] == NONE) {
+				if(len == 0) return true;
+			} else if(get_length(key) == len) {
+				uint16_t org = base_ + index_[key] + 2;
+				uint8_t i = 0;
+				while(i < len && flash_.read(org + i) == p[i]) ++i;
+				if(i == len) return true;
+			}
+			if((tail_ + REC_EXTRA + len) > BANK_SIZE) {
+				if(!collect()) return false;
+				if((tail_ + REC_EXTRA + len) > BANK_SIZE) return false;
+			}
+			return append_(key, p, len);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  削除
+			@param[in]	key	キー
+			@return エラーがあれば「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool remove(uint8_t key) { return write(key, nullptr, 0); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  データの長さを取得
+			@param[in]	key	キー
+			@return 長さ（0 なら無し）
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_length(uint8_t key) const {
+			if(key >= KEYS || index_[key] == NONE) return 0;
+			return flash_.read(base_ + index_[key] + 1);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  読み出し
+			@param[in]	key	キー
+			@param[out]	dst	先
+			@param[in]	max	先の大きさ
+			@return 読み出した長さ（0 なら無し）
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t read(uint8_t key, void* dst, uint8_t max) const {
+			if(key >= KEYS || index_[key] == NONE) return 0;
+			uint8_t len = flash_.read(base_ + index_[key] + 1);
+			if(len > max) len = max;
+			uint8_t* p = static_cast<uint8_t*>(dst);
+			uint16_t org = base_ + index_[key] + 2;
+			for(uint8_t i = 0; i < len; ++i) p[i] = flash_.read(org + i);
+			return len;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  有効バンクの空きを取得
+			@return 空きバイト数
+		*/
+		//-----------------------------------------------------------------//
+		uint16_t get_free() const { return BANK_SIZE - tail_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  有効バンクを取得
+			@return バンク（0, 1）
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_bank() const { return base_ != 0; }
+	};
+}
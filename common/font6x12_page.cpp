@@ -0,0 +1,112 @@
+//=====================================================================//
+/*!	@file
+	@brief	６×１２フォント、ページ・レイアウト（font_page で生成）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/font6x12_page.hpp"
+
+namespace graphics {
+
+	const uint8_t font6x12_page::page_bitmap_[] = {
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 0x20
+		0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // '!'
+		0x04,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '"'
+		0x04,0xFF,0x04,0xFF,0x04,0x00,0x01,0x07,0x01,0x07,0x01,0x00,  // '#'
+		0x8C,0x12,0xFF,0x22,0xCC,0x00,0x01,0x02,0x07,0x02,0x01,0x00,  // '$'
+		0x06,0xC9,0xB6,0x4C,0x83,0x00,0x03,0x00,0x01,0x02,0x01,0x00,  // '%'
+		0xE6,0x19,0x66,0x80,0x60,0x00,0x01,0x02,0x02,0x01,0x02,0x00,  // '&'
+		0x00,0x05,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '''
+		0x00,0xF8,0x06,0x01,0x00,0x00,0x00,0x00,0x03,0x04,0x00,0x00,  // '('
+		0x00,0x01,0x06,0xF8,0x00,0x00,0x00,0x04,0x03,0x00,0x00,0x00,  // ')'
+		0xD8,0x20,0xFC,0x20,0xD8,0x00,0x00,0x00,0x01,0x00,0x00,0x00,  // '*'
+		0x20,0x20,0xFC,0x20,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,  // '+'
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x03,0x00,0x00,0x00,  // ','
+		0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '-'
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,  // '.'
+		0x00,0x80,0x70,0x0C,0x03,0x00,0x06,0x01,0x00,0x00,0x00,0x00,  // '/'
+		0xFC,0x02,0x02,0xFC,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '0'
+		0x00,0x04,0xFE,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // '1'
+		0x0C,0xC2,0x22,0x1C,0x00,0x00,0x03,0x02,0x02,0x02,0x00,0x00,  // '2'
+		0x8C,0x22,0x22,0xDC,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '3'
+		0xC0,0xB0,0x8C,0xFE,0x80,0x00,0x00,0x00,0x00,0x03,0x00,0x00,  // '4'
+		0xBE,0x12,0x12,0xE2,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '5'
+		0xFC,0x22,0x22,0xCC,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '6'
+		0x02,0x82,0x72,0x0E,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,  // '7'
+		0xDC,0x22,0x22,0xDC,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '8'
+		0x9C,0x22,0x22,0xFC,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // '9'
+		0x00,0x18,0x18,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,  // ':'
+		0x00,0x18,0x18,0x00,0x00,0x00,0x00,0x05,0x03,0x00,0x00,0x00,  // ';'
+		0x20,0x50,0x88,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x02,0x00,  // '<'
+		0x48,0x48,0x48,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '='
+		0x02,0x04,0x88,0x50,0x20,0x00,0x02,0x01,0x00,0x00,0x00,0x00,  // '>'
+		0x0C,0x02,0x62,0x1C,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // '?'
+		0xFC,0x4A,0x7A,0x82,0x7C,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // '@'
+		0xC0,0xB8,0x86,0xB8,0xC0,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'A'
+		0xFE,0x22,0x22,0x22,0xDC,0x00,0x03,0x02,0x02,0x02,0x01,0x00,  // 'B'
+		0xFC,0x02,0x02,0x02,0x8C,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'C'
+		0xFE,0x02,0x02,0x04,0xF8,0x00,0x03,0x02,0x02,0x01,0x00,0x00,  // 'D'
+		0xFE,0x22,0x22,0x22,0x02,0x00,0x03,0x02,0x02,0x02,0x02,0x00,  // 'E'
+		0xFE,0x22,0x22,0x22,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,  // 'F'
+		0xFC,0x02,0x02,0x42,0xCC,0x00,0x01,0x02,0x02,0x01,0x03,0x00,  // 'G'
+		0xFE,0x20,0x20,0x20,0xFE,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'H'
+		0x00,0x02,0xFE,0x02,0x00,0x00,0x00,0x02,0x03,0x02,0x00,0x00,  // 'I'
+		0x80,0x00,0x00,0xFE,0x00,0x00,0x01,0x02,0x02,0x01,0x00,0x00,  // 'J'
+		0xFE,0x20,0xD8,0x06,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,  // 'K'
+		0xFE,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x02,0x02,0x02,0x00,  // 'L'
+		0xFE,0x38,0xC0,0x38,0xFE,0x00,0x03,0x00,0x03,0x00,0x03,0x00,  // 'M'
+		0xFE,0x0C,0x70,0x80,0xFE,0x00,0x03,0x00,0x00,0x01,0x03,0x00,  // 'N'
+		0xFC,0x02,0x02,0x02,0xFC,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'O'
+		0xFE,0x22,0x22,0x22,0x1C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,  // 'P'
+		0xFC,0x02,0x82,0x02,0xFC,0x00,0x01,0x02,0x02,0x01,0x02,0x00,  // 'Q'
+		0xFE,0x22,0x22,0x62,0x9C,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'R'
+		0x8C,0x12,0x22,0x42,0x8C,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'S'
+		0x02,0x02,0xFE,0x02,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'T'
+		0xFE,0x00,0x00,0x00,0xFE,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'U'
+		0x0E,0x70,0x80,0x70,0x0E,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'V'
+		0x3E,0xC0,0x3E,0xC0,0x3E,0x00,0x00,0x03,0x00,0x03,0x00,0x00,  // 'W'
+		0x06,0xD8,0x20,0xD8,0x06,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'X'
+		0x06,0x18,0xE0,0x18,0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'Y'
+		0x02,0xC2,0x22,0x1A,0x06,0x00,0x03,0x02,0x02,0x02,0x02,0x00,  // 'Z'
+		0x00,0x00,0xFF,0x01,0x01,0x00,0x00,0x00,0x07,0x04,0x04,0x00,  // '['
+		0xA6,0xB8,0xE0,0xB8,0xA6,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // '\'
+		0x01,0x01,0xFF,0x00,0x00,0x00,0x04,0x04,0x07,0x00,0x00,0x00,  // ']'
+		0x00,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '^'
+		0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x08,0x08,  // '_'
+		0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '`'
+		0xA0,0x50,0x50,0xE0,0x00,0x00,0x01,0x02,0x02,0x01,0x02,0x00,  // 'a'
+		0xFE,0x10,0x10,0x10,0xE0,0x00,0x03,0x02,0x02,0x02,0x01,0x00,  // 'b'
+		0xE0,0x10,0x10,0x10,0x20,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'c'
+		0xE0,0x10,0x10,0x10,0xFE,0x00,0x01,0x02,0x02,0x02,0x03,0x00,  // 'd'
+		0xE0,0x50,0x50,0x50,0x60,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'e'
+		0x10,0xFC,0x12,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,  // 'f'
+		0xA0,0x50,0x50,0x20,0x10,0x00,0x02,0x05,0x05,0x05,0x02,0x00,  // 'g'
+		0xFE,0x10,0x10,0x10,0xE0,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'h'
+		0x00,0x00,0xF6,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'i'
+		0x00,0x00,0xF6,0x00,0x00,0x00,0x04,0x04,0x03,0x00,0x00,0x00,  // 'j'
+		0xFE,0x80,0xC0,0x20,0x10,0x00,0x03,0x00,0x00,0x01,0x02,0x00,  // 'k'
+		0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'l'
+		0xF0,0x10,0xE0,0x10,0xE0,0x00,0x03,0x00,0x03,0x00,0x03,0x00,  // 'm'
+		0xF0,0x10,0x10,0x10,0xE0,0x00,0x03,0x00,0x00,0x00,0x03,0x00,  // 'n'
+		0xE0,0x10,0x10,0x10,0xE0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 'o'
+		0xF0,0x10,0x10,0x10,0xE0,0x00,0x07,0x01,0x01,0x01,0x00,0x00,  // 'p'
+		0xE0,0x10,0x10,0x10,0xF0,0x00,0x00,0x01,0x01,0x01,0x07,0x00,  // 'q'
+		0x00,0xF0,0x20,0x10,0x10,0x00,0x00,0x03,0x00,0x00,0x00,0x00,  // 'r'
+		0x20,0x50,0x50,0x90,0x20,0x00,0x01,0x02,0x02,0x02,0x01,0x00,  // 's'
+		0x10,0xFE,0x10,0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x00,0x00,  // 't'
+		0xF0,0x00,0x00,0x00,0xF0,0x00,0x01,0x02,0x02,0x02,0x03,0x00,  // 'u'
+		0x30,0xC0,0x00,0xC0,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // 'v'
+		0x70,0x80,0x70,0x80,0x70,0x00,0x00,0x03,0x00,0x03,0x00,0x00,  // 'w'
+		0x10,0x20,0xC0,0x20,0x10,0x00,0x02,0x01,0x00,0x01,0x02,0x00,  // 'x'
+		0x30,0xC0,0x00,0xC0,0x30,0x00,0x04,0x04,0x03,0x00,0x00,0x00,  // 'y'
+		0x10,0x10,0x90,0x50,0x30,0x00,0x02,0x03,0x02,0x02,0x02,0x00,  // 'z'
+		0x00,0x20,0xDF,0x01,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,  // '{'
+		0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,  // '|'
+		0x00,0x01,0xDF,0x20,0x00,0x00,0x00,0x04,0x07,0x00,0x00,0x00,  // '}'
+		0x02,0x01,0x01,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '~'
+		0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,  // 0x7F
+	};
+}
@@ -0,0 +1,47 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	６×１２フォント・クラス（ページ・レイアウト付き） @n
+			font6x12 に、縦８ドット／バイトのカラム並びのグリフを追加 @n
+			ページ・レイアウトの PLOT（page_plot）では、monograph は、@n
+			このグリフをカラム単位で転送する（common/font6x12_page.cpp が必要） @n
+			グリフのデータは、font_page ツールで生成する
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/font6x12.hpp"
+
+namespace graphics {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	フォント・クラス（ページ・レイアウト付き）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class font6x12_page : public font6x12 {
+		static const uint8_t page_bitmap_[];
+
+	public:
+		static const uint8_t FIRST = 0x20;	///< 最初の文字コード
+		static const uint8_t LAST  = 0x7F;	///< 最後の文字コード
+		static const uint8_t PAGES = (HEIGHT + 7) / 8;	///< グリフのページ数
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ページ・レイアウトのグリフを取得 @n
+					ページ０のカラム（WIDTH バイト）、ページ１のカラム ... の順
+			@param[in]	code	文字コード
+			@return グリフ（範囲外の場合「nullptr」）
+		*/
+		//-----------------------------------------------------------------//
+		static const uint8_t* get_page(uint8_t code)
+		{
+			if(code < FIRST || code > LAST) return nullptr;
+			return &page_bitmap_[static_cast<uint16_t>(code - FIRST) * (WIDTH * PAGES)];
+		}
+	};
+}
@@ -13,7 +13,8 @@
 			+ 2017/06/11 21:00- 固定文字列クラス向け chaout、実装 @n
 			+ 2017/06/12 14:50- memory_chaoutと、専用コンストラクター実装 @n
 			+ 2017/06/14 05:34- memory_chaout size() のバグ修正 @n
-			+ 2018/11/20 05:10- float を無効にするオプションを復活
+			+ 2018/11/20 05:10- float を無効にするオプションを復活 @n
+			+ 2026/10/19 - fixed_point 型を「%N.My」「%N.Mf」「%d」で直接表示
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2013, 2018 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -23,6 +24,7 @@
 #include <type_traits>
 #include <unistd.h>
 #include <cstring>
+#include "common/fixed_point.hpp"
 
 // float を無効にする場合（８ビット系マイコンでのメモリ節約用）
 // #define NO_FLOAT_FORM
@@ -793,6 +795,49 @@ namespace utils {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  オペレーター「%」（固定小数点） @n
+					「%N.My」「%N.Mf」では、小数部のビット数は型から決まる @n
+					（「:L」の指定は無視される）、「%d」は整数部
+			@param[in]	val	値
+			@return	自分の参照
+		*/
+		//-----------------------------------------------------------------//
+		template <typename T, uint8_t FRAC>
+		basic_format& operator % (const fixed_point<T, FRAC>& val) noexcept
+		{
+			typedef typename fixed_point<T, FRAC>::unsigned_type UT;
+
+			if(error_ != error::none) {
+				return *this;
+			}
+
+			switch(mode_) {
+			case mode::FIXED_REAL:
+			case mode::REAL:
+				{
+					if(num_ == 0) num_ = 6;
+					T raw = val.get_raw();
+					bool sign = raw < 0;
+					UT v = sign ? -static_cast<UT>(raw) : static_cast<UT>(raw);
+					out_fixed_point_<UT>(v, FRAC, sign);
+				}
+				break;
+			case mode::DECIMAL:
+				out_dec_(val.get_int());
+				break;
+			default:
+				error_ = error::different;
+				break;
+			}
+
+			reset_();
+			next_();
+			return *this;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  オペレーター「%」
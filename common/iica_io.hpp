@@ -1,7 +1,13 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	IICA(I2C) テンプレートクラス (20MHz system clock) 
+	@brief	IICA(I2C) テンプレートクラス @n
+			・ビット時間は、F_CLK から計算（100K/400K b.p.s.）@n
+			　待ちは、delay の adjnz ループ（DELAY_LOOP_CYCLES）で、@n
+			　半周期の待ち以外の処理（IICA_EDGE_CYCLES）は、命令からの見積もり @n
+			　なので、速度は公称値（実測と違う場合は、Makefile で定義する）@n
+			・xfer() で、書き込み、リピーテッド・スタート、読み出しを、@n
+			　１回のトランザクションで行う（レジスターのバースト・リード）
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2015, 2017 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -11,18 +17,26 @@
 #include <cstdint>
 #include "common/delay.hpp"
 
+/// F_CLK はビット時間の計算で必要で、設定が無いとエラーにします。
+#ifndef F_CLK
+#  error "iica_io.hpp requires F_CLK to be defined"
+#endif
+
+/// 半周期毎の、待ち以外のサイクル（delay_ の回数の読み出しと判定、@n
+/// ポートのビット操作、シフト、ループの分岐）
+#ifndef IICA_EDGE_CYCLES
+#  define IICA_EDGE_CYCLES 12
+#endif
+
 namespace device {
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
-		@brief  I2C テンプレートクラス @n
-		@param[in]	SDA	SDA ポート定義クラス
-		@param[in]	SCL	SCL ポート定義クラス
+		@brief  I2C 共通定義（iica_io、iica_trj）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class SDA, class SCL>
-	class iica_io {
-	public:
+	struct iica_base {
+
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 		/*!
 			@brief  I2C の速度タイプ
@@ -49,29 +63,57 @@ namespace device {
 			recv_data,	///< 受信データ転送
 			stop,		///< ストップ・コンディション
 		};
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C テンプレートクラス @n
+		@param[in]	SDA	SDA ポート定義クラス
+		@param[in]	SCL	SCL ポート定義クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class SDA, class SCL>
+	class iica_io : public iica_base {
+
+		static const uint16_t LOOP_CYCLES = utils::delay::LOOP_CYCLES;
+		static const uint16_t EDGE_CYCLES = IICA_EDGE_CYCLES;
 
-	private:
-		uint8_t		clock_;
+		uint16_t	clock_;
 		error		error_;
 		uint16_t	busy_;
 
-		static const uint8_t slow_clock_ = 10 / 2;
-		static const uint8_t fast_clock_ = 4 / 2;
+		static uint16_t loops_(uint32_t bps) {
+			uint32_t half = F_CLK / (bps * 2);
+			if(half <= EDGE_CYCLES) return 0;
+			return (half - EDGE_CYCLES) / LOOP_CYCLES;
+		}
+
+		void delay_() const { utils::delay::loop(clock_); }
 
 		void start_() const {
 			SDA::P = 0;
-			utils::delay::micro_second(clock_);
+			delay_();
 			SCL::P = 0;
-			utils::delay::micro_second(clock_);
+			delay_();
+		}
+
+
+		void restart_() const {
+			SDA::P = 1;
+			delay_();
+			SCL::P = 1;
+			delay_();
+			start_();
 		}
 
 
 		bool ack_() const {
 			SDA::P = 1;
-			utils::delay::micro_second(clock_);
+			delay_();
 			SCL::P = 1;
 			SDA::DIR = 0;
-			utils::delay::micro_second(clock_);
+			delay_();
 			bool f = SDA::P();
 			SDA::P = 0;
 			SDA::DIR = 1;
@@ -81,10 +123,10 @@ namespace device {
 
 
 		void out_ack_(bool b) const {
-			utils::delay::micro_second(clock_);
+			delay_();
 			SDA::P = b;
 			SCL::P = 1;
-			utils::delay::micro_second(clock_);
+			delay_();
 			SCL::P = 0;
 		}
 
@@ -107,9 +149,10 @@ namespace device {
 
 
 		void stop_() const {
-			utils::delay::micro_second(clock_);
+			SDA::P = 0;  // NACK の後は SDA が High
+			delay_();
 			SCL::P = 1;
-			utils::delay::micro_second(clock_);
+			delay_();
 			SDA::P = 1;
 		}
 
@@ -117,13 +160,13 @@ namespace device {
 		bool write_(uint8_t val, bool sync) const {
 			for(uint8_t n = 0; n < 8; ++n) {
 				SDA::P = (val & 0x80) != 0 ? 1 : 0;
-				utils::delay::micro_second(clock_);
+				delay_();
 				SCL::P = 1;
 				if(n == 0 && sync) {
 					if(!wait_()) return false;
 				}
 				val <<= 1;
-				utils::delay::micro_second(clock_);
+				delay_();
 				SCL::P = 0;
 			}
 			return true;
@@ -162,7 +205,7 @@ namespace device {
 		bool read_(uint8_t& val, bool sync) const {
 			SDA::DIR = 0;
 			for(uint8_t n = 0; n < 8; ++n) {
-				utils::delay::micro_second(clock_);
+				delay_();
 				val <<= 1;
 				SCL::P = 1;
 				if(n == 0 && sync) {
@@ -171,7 +214,7 @@ namespace device {
 						return false;
 					}
 				}
-				utils::delay::micro_second(clock_);
+				delay_();
 				if(SDA::P()) val |= 1;
 				SCL::P = 0;
 			}
@@ -179,13 +222,38 @@ namespace device {
 			return true;
 		}
 
+
+		bool address_(uint8_t adr) {
+			write_(adr, false);
+			if(ack_()) {
+				stop_();
+				error_ = error::address;
+				return false;
+			}
+			return true;
+		}
+
+
+		bool read_(uint8_t* dst, uint8_t num) {
+			for(uint8_t n = 0; n < num; ++n) {
+				if(!read_(*dst, true)) {
+					stop_();
+					error_ = error::recv_data;
+					return false;
+				}
+				out_ack_(n == (num - 1));
+				++dst;
+			}
+			return true;
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		iica_io() : clock_(slow_clock_), error_(error::none), busy_(200) { }
+		iica_io() : clock_(loops_(100000)), error_(error::none), busy_(200) { }
 
 
 		//-----------------------------------------------------------------//
@@ -221,23 +289,32 @@ namespace device {
 			@param[in]	clock	パルス５０％待ち時間（単位マイクロ秒）
 		*/
 		//-----------------------------------------------------------------//
-		void set_clock(uint8_t clock) { clock_ = clock; }
+		void set_clock(uint8_t clock) { clock_ = static_cast<uint32_t>(clock) * (F_CLK / 1000000) / LOOP_CYCLES; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  転送速度設定（F_CLK から待ち時間を計算）
+			@param[in]	bps	転送速度（b.p.s.）
+		*/
+		//-----------------------------------------------------------------//
+		void set_rate(uint32_t bps) { clock_ = loops_(bps); }
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  標準速度指定（maybe 100KBPS）
+			@brief  標準速度指定（100KBPS）
 		*/
 		//-----------------------------------------------------------------//
-		void set_standard() { clock_ = slow_clock_; }
+		void set_standard() { set_rate(100000); }
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  高速指定（maybe 400KBPS）
+			@brief  高速指定（400KBPS、F_CLK が低い場合は、それ以下）
 		*/
 		//-----------------------------------------------------------------//
-		void set_fast() { clock_ = fast_clock_; }
+		void set_fast() { set_rate(400000); }
 
 
 		//-----------------------------------------------------------------//
@@ -260,38 +337,81 @@ namespace device {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  受信（リード）
+			@brief  トランザクション（送信、リピーテッド・スタート、受信）@n
+					snum が０なら受信のみ、rnum が０なら送信のみ
 			@param[in] address スレーブアドレス（７ビット）
-			@param[out]	dst	先
-			@param[in]	num	数
+			@param[in]	src	送信元
+			@param[in]	snum	送信数
+			@param[out]	dst	受信先
+			@param[in]	rnum	受信数
 			@return 失敗なら「false」が返る
 		*/
 		//-----------------------------------------------------------------//
-		bool recv(uint8_t address, uint8_t* dst, uint8_t num) {
+		bool xfer(uint8_t address, const uint8_t* src, uint8_t snum, uint8_t* dst, uint8_t rnum) {
 			start_();
-			write_((address << 1) | 1, false);
-			if(ack_()) {
-				stop_();
-				error_ = error::address;
-				return false;
-			}
-
-			for(uint8_t n = 0; n < num; ++n) {
-				if(!read_(*dst, true)) {
-					stop_();
-					error_ = error::recv_data;
+			if(snum > 0 || rnum == 0) {
+				if(!address_(address << 1)) return false;
+				if(!write_(src, snum)) {
+					error_ = error::send_data;
 					return false;
 				}
-				bool f = 0;
-				if(n == (num - 1)) f = 1;
-				out_ack_(f);
-				++dst;
+				if(rnum == 0) {
+					stop_();
+					return true;
+				}
+				restart_();
 			}
+			if(!address_((address << 1) | 1)) return false;
+			if(!read_(dst, rnum)) return false;
 			stop_();
 			return true;
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスターの読み出し（バースト・リード）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	reg	先頭レジスター
+			@param[out]	dst	先
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool read(uint8_t address, uint8_t reg, uint8_t* dst, uint8_t num) {
+			return xfer(address, &reg, 1, dst, num);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスターの書き込み（バースト・ライト）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	reg	先頭レジスター
+			@param[in]	src	元
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool write(uint8_t address, uint8_t reg, const uint8_t* src, uint8_t num) {
+			return send(address, reg, src, num);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信（リード）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[out]	dst	先
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool recv(uint8_t address, uint8_t* dst, uint8_t num) {
+			return xfer(address, nullptr, 0, dst, num);
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  送信（ライト）
@@ -303,15 +423,9 @@ namespace device {
 		//-----------------------------------------------------------------//
 		bool send(uint8_t address, const uint8_t* src, uint8_t num) {
 			start_();
-			write_(address << 1, false);
-			if(ack_()) {
-				stop_();
-				error_ = error::address;
-				return false;
-			}
+			if(!address_(address << 1)) return false;
 
 			if(!write_(src, num)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
@@ -332,21 +446,14 @@ namespace device {
 		//-----------------------------------------------------------------//
 		bool send(uint8_t address, uint8_t first, const uint8_t* src, uint8_t num) {
 			start_();
-			write_(address << 1, false);
-			if(ack_()) {
-				stop_();
-				error_ = error::address;
-				return false;
-			}
+			if(!address_(address << 1)) return false;
 
 			if(!write_(first)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
 
 			if(!write_(src, num)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
@@ -368,25 +475,17 @@ namespace device {
 		//-----------------------------------------------------------------//
 		bool send(uint8_t address, uint8_t first, uint8_t second, const uint8_t* src, uint8_t num) {
 			start_();
-			write_(address << 1, false);
-			if(ack_()) {
-				stop_();
-				error_ = error::address;
-				return false;
-			}
+			if(!address_(address << 1)) return false;
 
 			if(!write_(first)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
 			if(!write_(second)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
 			if(!write_(src, num)) {
-				stop_();
 				error_ = error::send_data;
 				return false;
 			}
@@ -0,0 +1,513 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	IICA(I2C) タイマー RJ 割り込み駆動テンプレートクラス @n
+			・TimerRJ の割り込み（半ビット毎）で、SCL/SDA を１ステップずつ動かす @n
+			・エッジの間は、CPU が空くので、async_xfer() で開始して、@n
+			　他の処理をしながら is_busy() で終了を待てる @n
+			・send/recv/xfer/read/write は iica_io と同じ（終了まで待つ）@n
+			・割り込み１回の処理は、数十サイクル程度なので、F_CLK が 20MHz の @n
+			　場合、100K b.p.s. 以下で使う事を推奨（それ以上では、割り込み処理が @n
+			　間に合わず、転送速度は割り込み処理で決まる）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/iica_io.hpp"
+#include "common/vect.h"
+#include "M120AN/system.hpp"
+#include "M120AN/intr.hpp"
+#include "M120AN/timer_rj.hpp"
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C タイマー RJ 割り込み駆動クラス @n
+				TIMER_RJ_intr から itask() を呼ぶ
+		@param[in]	SDA	SDA ポート定義クラス
+		@param[in]	SCL	SCL ポート定義クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class SDA, class SCL>
+	class iica_trj : public iica_base {
+
+		enum class task : uint8_t {
+			idle,
+			start,		///< スタート・コンディション
+			send,		///< １バイト送信（アドレスを含む）
+			restart,	///< リピーテッド・スタート
+			recv,		///< １バイト受信
+			stop,		///< ストップ・コンディション
+		};
+
+		volatile task	task_;
+		volatile error	error_;
+
+		// 半ビット（割り込み）毎のステップ（偶数：SCL Low、奇数：SCL High、16,17 は ACK）
+		uint8_t			step_;
+		uint8_t			data_;
+		uint8_t			adr_;
+		bool			adr_phase_;
+		bool			rd_;
+
+		uint8_t			head_[2];
+		uint8_t			hnum_;
+		const uint8_t*	src_;
+		uint8_t			snum_;
+		uint8_t*		dst_;
+		uint8_t			rnum_;
+
+		uint16_t		busy_;
+		uint16_t		busy_cnt_;
+		uint16_t		trj_;
+
+		// クロック・ストレッチ（SCL が Low なら待つ）
+		bool stretch_() {
+			SCL::DIR = 0;
+			bool f = SCL::P();
+			SCL::DIR = 1;
+			if(f) {
+				busy_cnt_ = busy_;
+				return true;
+			}
+			if(busy_cnt_ > 0) {
+				--busy_cnt_;
+			} else {
+				error_ = error::bus_open;
+				finish_();
+			}
+			return false;
+		}
+
+
+		void finish_() {
+			TRJCR.TSTART = 0;
+			task_ = task::idle;
+		}
+
+
+		void abort_(error e) {
+			error_ = e;
+			task_ = task::stop;
+			step_ = 0;
+		}
+
+
+		// ACK を受けた後、次の動作を決める
+		void next_() {
+			step_ = 0;
+			if(adr_phase_) {
+				adr_phase_ = false;
+				if(rd_) {
+					task_ = task::recv;
+					return;
+				}
+			}
+			if(hnum_ > 0) {
+				data_ = head_[0];
+				head_[0] = head_[1];
+				--hnum_;
+			} else if(snum_ > 0) {
+				data_ = *src_++;
+				--snum_;
+			} else if(rnum_ > 0) {
+				task_ = task::restart;
+			} else {
+				task_ = task::stop;
+			}
+		}
+
+
+		void send_() {
+			if((step_ & 1) == 0) {
+				SCL::P = 0;
+				if(step_ < 16) {
+					SDA::P = (data_ & 0x80) != 0 ? 1 : 0;
+					data_ <<= 1;
+				} else {
+					SDA::P = 1;
+					SDA::DIR = 0;
+				}
+				++step_;
+			} else {
+				SCL::P = 1;
+				if(step_ == 1 && !stretch_()) return;
+				if(step_ == 17) {
+					bool nack = SDA::P();
+					SDA::DIR = 1;
+					if(nack) abort_(adr_phase_ ? error::address : error::send_data);
+					else next_();
+					return;
+				}
+				++step_;
+			}
+		}
+
+
+		void recv_() {
+			if((step_ & 1) == 0) {
+				SCL::P = 0;
+				if(step_ == 0) {
+					SDA::DIR = 0;
+				} else if(step_ == 16) {
+					SDA::DIR = 1;
+					SDA::P = rnum_ == 1 ? 1 : 0;  // 最後は NACK
+				}
+				++step_;
+			} else {
+				SCL::P = 1;
+				if(step_ == 1 && !stretch_()) return;
+				if(step_ < 16) {
+					data_ <<= 1;
+					if(SDA::P()) data_ |= 1;
+					++step_;
+				} else {
+					*dst_++ = data_;
+					--rnum_;
+					step_ = 0;
+					if(rnum_ == 0) task_ = task::stop;
+				}
+			}
+		}
+
+
+		bool request_(uint8_t address, const uint8_t* src, uint8_t snum, uint8_t* dst, uint8_t rnum) {
+			adr_ = address;
+			src_ = src;
+			snum_ = snum;
+			dst_ = dst;
+			rnum_ = rnum;
+			adr_phase_ = true;
+			rd_ = hnum_ == 0 && snum == 0 && rnum > 0;
+			data_ = (address << 1) | (rd_ ? 1 : 0);
+			step_ = 0;
+			busy_cnt_ = busy_;
+			error_ = error::none;
+			task_ = task::start;
+			di();
+			TRJ = trj_;
+			TRJCR.TSTART = 1;
+			ei();
+			return true;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		iica_trj() : task_(task::idle), error_(error::none), step_(0), data_(0), adr_(0),
+			adr_phase_(false), rd_(false), head_{ 0 }, hnum_(0), src_(nullptr), snum_(0),
+			dst_(nullptr), rnum_(0), busy_(0), busy_cnt_(0), trj_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  初期化
+			@param[in]	bps		転送速度（b.p.s.）
+			@param[in]	ir_lvl	割り込みレベル（1 ～ 7）
+			@return 設定範囲を超えたら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start(uint32_t bps, uint8_t ir_lvl)
+		{
+			uint32_t tn = F_CLK / (bps * 2);
+			if(tn == 0 || tn > 65536 || ir_lvl == 0) {
+				error_ = error::start;
+				return false;
+			}
+			trj_ = tn - 1;
+			set_busy(200);
+
+			SCL::OD = 1;
+			SDA::OD = 1;
+			SCL::DIR = 1;
+			SDA::DIR = 1;
+			SCL::P = 1;
+			SDA::P = 1;
+
+			MSTCR.MSTTRJ = 0;  // モジュールスタンバイ解除
+			TRJCR = 0x00;  // カウンタ停止
+			TRJMR = TRJMR.TCK.b(0) | TRJMR.TMOD.b(0);  // タイマーモード、F_CLK
+			TRJ = trj_;
+			ILVLB.B01 = ir_lvl;
+			TRJIR = TRJIR.TRJIE.b(1);
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  初期化
+			@param[in]	spd		スピード
+			@param[in]	ir_lvl	割り込みレベル（1 ～ 7）
+			@return 成功なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool start(speed spd, uint8_t ir_lvl)
+		{
+			if(spd == speed::standard) {
+				return start(100000, ir_lvl);
+			} else if(spd == speed::fast) {
+				return start(400000, ir_lvl);
+			}
+			error_ = error::start;
+			return false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  スレーブデバイスの「待ち」時間の最大値を設定
+			@param[in]	busy	待ち時間（単位マイクロ秒）
+		*/
+		//-----------------------------------------------------------------//
+		void set_busy(uint16_t busy) {
+			busy_ = static_cast<uint32_t>(busy) * (F_CLK / 1000000) / (trj_ + 1);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	最終エラーの取得
+			@return エラー・タイプ
+		 */
+		//-----------------------------------------------------------------//
+		error get_last_error() const { return error_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	転送中か
+			@return 転送中なら「true」
+		 */
+		//-----------------------------------------------------------------//
+		bool is_busy() const { return TRJCR.TSTART(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	転送の終了を待つ
+			@return 失敗なら「false」が返る
+		 */
+		//-----------------------------------------------------------------//
+		bool sync() const {
+			while(is_busy()) ;
+			return error_ == error::none;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクションの開始（終了を待たない）@n
+					src、dst は、終了まで保持する事
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	src	送信元
+			@param[in]	snum	送信数
+			@param[out]	dst	受信先
+			@param[in]	rnum	受信数
+			@return 転送中なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool async_xfer(uint8_t address, const uint8_t* src, uint8_t snum, uint8_t* dst, uint8_t rnum) {
+			if(is_busy()) return false;
+			hnum_ = 0;
+			return request_(address, src, snum, dst, rnum);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスター読み出しの開始（終了を待たない）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	reg	先頭レジスター
+			@param[out]	dst	先（終了まで保持する事）
+			@param[in]	num	数
+			@return 転送中なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool async_read(uint8_t address, uint8_t reg, uint8_t* dst, uint8_t num) {
+			if(is_busy()) return false;
+			head_[0] = reg;
+			hnum_ = 1;
+			return request_(address, nullptr, 0, dst, num);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクション（送信、リピーテッド・スタート、受信）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	src	送信元
+			@param[in]	snum	送信数
+			@param[out]	dst	受信先
+			@param[in]	rnum	受信数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool xfer(uint8_t address, const uint8_t* src, uint8_t snum, uint8_t* dst, uint8_t rnum) {
+			if(!async_xfer(address, src, snum, dst, rnum)) return false;
+			return sync();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスターの読み出し（バースト・リード）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	reg	先頭レジスター
+			@param[out]	dst	先
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool read(uint8_t address, uint8_t reg, uint8_t* dst, uint8_t num) {
+			if(!async_read(address, reg, dst, num)) return false;
+			return sync();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスターの書き込み（バースト・ライト）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	reg	先頭レジスター
+			@param[in]	src	元
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool write(uint8_t address, uint8_t reg, const uint8_t* src, uint8_t num) {
+			return send(address, reg, src, num);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信（リード）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[out]	dst	先
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool recv(uint8_t address, uint8_t* dst, uint8_t num) {
+			return xfer(address, nullptr, 0, dst, num);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信（ライト）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	src	元
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool send(uint8_t address, const uint8_t* src, uint8_t num) {
+			return xfer(address, src, num, nullptr, 0);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信（ライト）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	first	ファーストデータ
+			@param[in]	src	元
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool send(uint8_t address, uint8_t first, const uint8_t* src, uint8_t num) {
+			if(is_busy()) return false;
+			head_[0] = first;
+			hnum_ = 1;
+			if(!request_(address, src, num, nullptr, 0)) return false;
+			return sync();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信（ライト）
+			@param[in] address スレーブアドレス（７ビット）
+			@param[in]	first	ファースト・データ
+			@param[in]	second	セカンド・データ
+			@param[in]	src	元
+			@param[in]	num	数
+			@return 失敗なら「false」が返る
+		*/
+		//-----------------------------------------------------------------//
+		bool send(uint8_t address, uint8_t first, uint8_t second, const uint8_t* src, uint8_t num) {
+			if(is_busy()) return false;
+			head_[0] = first;
+			head_[1] = second;
+			hnum_ = 2;
+			if(!request_(address, src, num, nullptr, 0)) return false;
+			return sync();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  割り込みタスク（TIMER_RJ_intr から呼ぶ）
+		*/
+		//-----------------------------------------------------------------//
+		void itask() {
+			switch(task_) {
+			case task::start:
+				SDA::P = 0;
+				task_ = task::send;
+				break;
+			case task::send:
+				send_();
+				break;
+			case task::restart:
+				if(step_ == 0) {
+					SCL::P = 0;
+					SDA::P = 1;
+					++step_;
+				} else if(step_ == 1) {
+					SCL::P = 1;
+					++step_;
+				} else {
+					SDA::P = 0;
+					data_ = (adr_ << 1) | 1;
+					adr_phase_ = true;
+					rd_ = true;
+					step_ = 0;
+					task_ = task::send;
+				}
+				break;
+			case task::recv:
+				recv_();
+				break;
+			case task::stop:
+				if(step_ == 0) {
+					SCL::P = 0;
+					SDA::DIR = 1;
+					SDA::P = 0;
+					++step_;
+				} else if(step_ == 1) {
+					SCL::P = 1;
+					++step_;
+				} else {
+					SDA::P = 1;
+					finish_();
+				}
+				break;
+			default:
+				finish_();
+				break;
+			}
+			volatile uint8_t tmp = TRJIR();
+			TRJIR = TRJIR.TRJIE.b(1);
+		}
+	};
+}
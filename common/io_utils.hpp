@@ -14,6 +14,89 @@ namespace device {
 
 	typedef uint16_t address_type;
 
+#ifdef IO_HOST
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ホスト（Linux）でのレジスター・アクセス @n
+				IO_HOST を定義すると、レジスターの読み書きは、ホスト側で @n
+				定義する io_host_wr8、io_host_rd8 を呼ぶ（16/32 ビットは @n
+				リトル・エンディアンで 8 ビットに分ける）@n
+				io_host_wait は、待ちループ（割り込み、周辺の変化を待つ）の @n
+				１回分、io_host_delay は、ソフトウェア・ループの待ち（サイクル）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	void io_host_wr8(address_type adr, uint8_t data);
+	uint8_t io_host_rd8(address_type adr);
+	void io_host_wait();
+	void io_host_delay(uint32_t cycles);
+
+	static inline void io_sleep_() { io_host_wait(); }
+	static inline void io_wait_() { io_host_wait(); }
+	template <class COND>
+	static inline void io_wait_(COND cond) {
+		while(cond()) io_host_wait();
+	}
+
+	static inline void wr8_(address_type adr, uint8_t data) { io_host_wr8(adr, data); }
+	static inline uint8_t rd8_(address_type adr) { return io_host_rd8(adr); }
+	static inline void wr16_(address_type adr, uint16_t data) {
+		io_host_wr8(adr, data & 0xff);
+		io_host_wr8(adr + 1, data >> 8);
+	}
+	static inline uint16_t rd16_(address_type adr) {
+		return io_host_rd8(adr) | (static_cast<uint16_t>(io_host_rd8(adr + 1)) << 8);
+	}
+	static inline void wr32_(address_type adr, uint32_t data) {
+		wr16_(adr, data & 0xffff);
+		wr16_(adr + 2, data >> 16);
+	}
+	static inline uint32_t rd32_(address_type adr) {
+		return rd16_(adr) | (static_cast<uint32_t>(rd16_(adr + 2)) << 16);
+	}
+#else
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  待ちループの１回分（割り込み、周辺の変化を待つ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	static inline void io_sleep_() { asm("nop"); }
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  WAIT 命令（次の割り込みまで、CPU を止める）@n
+				WAIT の後には、NOP を４個置く（R8C/M11A, M12A グループ・@n
+				ハードウェアマニュアル「ウェイトモード」の移行手順、@n
+				WAIT の後の命令は、先読みされ、割り込みの前に実行される事がある）@n
+				※割り込みが無効（I フラグが「0」）だと、戻らない
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	static inline void io_wait_() { asm volatile ("wait\n\tnop\n\tnop\n\tnop\n\tnop" : : : "memory"); }
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  条件が成り立つ間、WAIT 命令で止まる @n
+				条件は、割り込みを止めて（fclr i）調べ、WAIT の直前で許可 @n
+				（fset i; wait）するので、調べた後に、割り込みが条件を変えても、@n
+				その割り込みで WAIT から戻る（起床を取りこぼさない）@n
+				WAIT の後の NOP は、io_wait_() と同じ（先読みされた fclr i が、@n
+				起床の割り込みより先に実行されない様に）@n
+				※戻る時は、割り込みは有効（I フラグが「1」）
+		@param[in]	cond	条件（「true」の間、待つ、割り込みで変わる値を読む）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class COND>
+	static inline void io_wait_(COND cond) {
+		while(1) {
+			asm volatile ("fclr i\n\tnop\n\tnop" : : : "memory");
+			if(!cond()) break;
+			asm volatile ("fset i\n\twait\n\tnop\n\tnop\n\tnop\n\tnop" : : : "memory");
+		}
+		asm volatile ("fset i" : : : "memory");
+	}
+
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief  ８ビット書き込み
@@ -86,6 +169,9 @@ namespace device {
 	}
 
 
+#endif
+
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief  Read/Write 8 bits アクセス・テンプレート
@@ -12,6 +12,43 @@
 
 namespace graphics {
 
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	PLOT のフレームバッファ・レイアウト @n
+				PLOT クラスは、「static const plot_layout LAYOUT」で宣言する @n
+				（宣言が無い場合は NONE） @n
+				また、以下の関数を持つ場合、monograph は点単位の描画の代わりに使う @n
+				　void hspan(int16_t x, int16_t y, int16_t w, bool c) @n
+				　void vspan(int16_t x, int16_t y, int16_t h, bool c) @n
+				　void blit_bits(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h) @n
+				　void blit_pages(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t pages) @n
+				　void line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c)（斜めの線） @n
+				blit_pages は、AFONT が「get_page(code)」（ページ・レイアウトのグリフ）を @n
+				持つ場合に、ASCII 文字の描画に使う
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	enum class plot_layout : uint8_t {
+		NONE,	///< フレームバッファ無し、又は不明（点単位のみ）
+		PAGE,	///< ページ（縦８ドット／バイト、LSB が上、横方向にカラムが並ぶ）
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	PLOT のレイアウトを取得
+		@param[in]	PLOT	プロットクラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class PLOT, class = void>
+	struct plot_layout_of {
+		static const plot_layout value = plot_layout::NONE;
+	};
+
+	template <class PLOT>
+	struct plot_layout_of<PLOT, decltype(static_cast<void>(PLOT::LAYOUT))> {
+		static const plot_layout value = PLOT::LAYOUT;
+	};
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief	ASCII 無効フォント定義
@@ -59,7 +96,80 @@ namespace graphics {
 
 		bool		x2_;
 
+		// PLOT の拡張機能を検出（無い場合は、点単位の描画）
+		template <class P>
+		static auto hspan_(P& p, int16_t x, int16_t y, int16_t w, bool c, int) -> decltype(p.hspan(x, y, w, c), void()) {
+			p.hspan(x, y, w, c);
+		}
+		template <class P>
+		static void hspan_(P& p, int16_t x, int16_t y, int16_t w, bool c, long) {
+			for(int16_t i = 0; i < w; ++i) {
+				p(x + i, y, c);
+			}
+		}
+
+		template <class P>
+		static auto vspan_(P& p, int16_t x, int16_t y, int16_t h, bool c, int) -> decltype(p.vspan(x, y, h, c), void()) {
+			p.vspan(x, y, h, c);
+		}
+		template <class P>
+		static void vspan_(P& p, int16_t x, int16_t y, int16_t h, bool c, long) {
+			for(int16_t i = 0; i < h; ++i) {
+				p(x, y + i, c);
+			}
+		}
+
+		template <class P>
+		static auto fill_(P& p, int16_t x, int16_t y, int16_t w, int16_t h, bool c, int) -> decltype(p.vspan(x, y, h, c), void()) {
+			for(int16_t i = 0; i < w; ++i) {
+				p.vspan(x + i, y, h, c);
+			}
+		}
+		template <class P>
+		static void fill_(P& p, int16_t x, int16_t y, int16_t w, int16_t h, bool c, long) {
+			for(int16_t i = 0; i < h; ++i) {
+				hspan_(p, x, y + i, w, c, 0);
+			}
+		}
+
+		template <class P>
+		static auto blit_(P& p, int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h, int)
+			-> decltype(p.blit_bits(x, y, src, w, h), bool()) {
+			p.blit_bits(x, y, src, w, h);
+			return true;
+		}
+		template <class P>
+		static bool blit_(P& p, int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h, long) {
+			return false;
+		}
+
+		template <class P>
+		static auto line_(P& p, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c, int)
+			-> decltype(p.line(x1, y1, x2, y2, c), bool()) {
+			p.line(x1, y1, x2, y2, c);
+			return true;
+		}
+		template <class P>
+		static bool line_(P& p, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c, long) {
+			return false;
+		}
+
+		template <class P, class F>
+		static auto font_page_(P& p, int16_t x, int16_t y, uint8_t code, int)
+			-> decltype(p.blit_pages(x, y, F::get_page(code), F::WIDTH, F::PAGES), bool()) {
+			auto src = F::get_page(code);
+			if(src == nullptr) return false;
+			p.blit_pages(x, y, src, F::WIDTH, F::PAGES);
+			return true;
+		}
+		template <class P, class F>
+		static bool font_page_(P& p, int16_t x, int16_t y, uint8_t code, long) {
+			return false;
+		}
+
 	public:
+		static const plot_layout LAYOUT = plot_layout_of<PLOT>::value;	///< PLOT のレイアウト
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	コンストラクター
@@ -158,11 +268,8 @@ namespace graphics {
 		//-----------------------------------------------------------------//
 		void fill(typename PLOT::value_type x, typename PLOT::value_type y, typename PLOT::value_type w, typename PLOT::value_type h, bool c)
 		{
-			for(typename PLOT::value_type yy = y; yy < (y + h); ++yy) {
-				for(typename PLOT::value_type xx = x; xx < (x + w); ++xx) {
-					plot_(xx, yy, c);
-				}
-			}
+			if(w <= 0 || h <= 0) return;
+			fill_(plot_, x, y, w, h, c, 0);
 		}
 
 
@@ -218,6 +325,16 @@ namespace graphics {
 			int8_t sy;
 			if(y2 >= y1) { dy = y2 - y1; sy = 1; } else { dy = y1 - y2; sy = -1; }
 
+			// 水平、垂直線は、まとめて描画
+			if(dy == 0) {
+				hspan_(plot_, x1 < x2 ? x1 : x2, y1, dx + 1, c, 0);
+				return;
+			} else if(dx == 0) {
+				vspan_(plot_, x1, y1 < y2 ? y1 : y2, dy + 1, c, 0);
+				return;
+			}
+			if(line_(plot_, x1, y1, x2, y2, c, 0)) return;
+
 			if(dx > dy) {
 				auto m = dy >> 1;
 				for(int16_t i = 0; i <= dx; i++) {
@@ -256,13 +373,12 @@ namespace graphics {
 		//-----------------------------------------------------------------//
 		void frame(int16_t x, int16_t y, int16_t w, int16_t h, bool c) noexcept
 		{
-			for(int16_t i = 0; i < w; ++i) {
-				plot_(x + i, y, c);
-				plot_(x + i, y + h - 1, c);
-			}
-			for(int16_t i = 0; i < h; ++i) {
-				plot_(x, y + i, c);
-				plot_(x + w - 1, y + i, c);
+			if(w <= 0 || h <= 0) return;
+			hspan_(plot_, x, y, w, c, 0);
+			if(h > 1) hspan_(plot_, x, y + h - 1, w, c, 0);
+			if(h > 2) {
+				vspan_(plot_, x, y + 1, h - 2, c, 0);
+				if(w > 1) vspan_(plot_, x + w - 1, y + 1, h - 2, c, 0);
 			}
 		}
 
@@ -282,6 +398,8 @@ namespace graphics {
 			if(img == nullptr) return;
 
 			const uint8_t* p = static_cast<const uint8_t*>(img);
+			if(blit_(plot_, x, y, p, w, h, 0)) return;
+
 			uint8_t k = 1;
 			uint8_t c = *p++;
 			for(uint8_t i = 0; i < h; ++i) {
@@ -402,7 +520,10 @@ namespace graphics {
 ///				if(x2_) {
 ///					draw_image2x(x, y, AFONT::get(code), AFONT::WIDTH, AFONT::HEIGHT);
 ///				} else {
-					draw_image(x, y, AFONT::get(code), AFONT::WIDTH, AFONT::HEIGHT);
+					// ページ・レイアウトのグリフがあれば、カラム単位で転送
+					if(!font_page_<PLOT, AFONT>(plot_, x, y, static_cast<uint8_t>(code), 0)) {
+						draw_image(x, y, AFONT::get(code), AFONT::WIDTH, AFONT::HEIGHT);
+					}
 ///				}
 			} else {
 				if(x <= -KFONT::WIDTH || x >= static_cast<int16_t>(PLOT::WIDTH)) {
@@ -549,4 +670,7 @@ namespace graphics {
 			}
 		}
 	};
+
+	template <class PLOT, class AFONT, class KFONT>
+	const plot_layout monograph<PLOT, AFONT, KFONT>::LAYOUT;
 }
@@ -0,0 +1,270 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	バイナリー・パケット通信 (COBS フレーム + CRC-16) @n
+			・フレーム構成： COBS( ペイロード + CRC16(big endian) ) + 0x00 @n
+			・CRC-16/CCITT (多項式 0x1021、初期値 0xFFFF) @n
+			・受信は、指定バッファ上で直接デコード（コピー無し） @n
+			SIO クラスには、以下の関数が必要 @n
+			　uint16_t length();   受信文字数 @n
+			　char getch();        文字入力 @n
+			　void putch_raw(char ch);  文字出力（CR/LF 変換無し） @n
+			※ホスト側 (Linux) からも利用出来るように、デバイス依存の @n
+			ヘッダーはインクルードしない
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  CRC-16/CCITT クラス（４ビット・テーブル）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct crc16 {
+
+		static const uint16_t INIT = 0xFFFF;	///< 初期値
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  １バイト更新
+			@param[in]	crc	CRC 値
+			@param[in]	d	データ
+			@return 更新された CRC 値
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t update(uint16_t crc, uint8_t d) {
+			static const uint16_t tbl_[16] = {
+				0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+				0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+			};
+			crc = (crc << 4) ^ tbl_[((crc >> 12) ^ (d >> 4)) & 0x0F];
+			crc = (crc << 4) ^ tbl_[((crc >> 12) ^ d) & 0x0F];
+			return crc;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ブロックの CRC を計算
+			@param[in]	src	データ
+			@param[in]	len	長さ
+			@param[in]	crc	初期値
+			@return CRC 値
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t calc(const void* src, uint16_t len, uint16_t crc = INIT) {
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			while(len > 0) {
+				crc = update(crc, *p++);
+				--len;
+			}
+			return crc;
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  パケット I/O クラス
+		@param[in]	SIO	シリアル入出力クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class SIO>
+	class packet_io {
+	public:
+		static const uint8_t DELIMITER = 0x00;	///< フレーム区切り
+		static const uint16_t CRC_SIZE = 2;		///< CRC のバイト数
+
+	private:
+		SIO&		sio_;
+
+		uint8_t*	buff_;
+		uint16_t	size_;
+		uint16_t	pos_;
+		uint16_t	crc_;
+		uint16_t	len_;
+
+		uint8_t		remain_;
+		bool		zero_;
+		bool		error_;
+		bool		done_;
+
+		uint16_t	crc_error_;
+		uint16_t	frame_error_;
+
+		void reset_() {
+			pos_ = 0;
+			crc_ = crc16::INIT;
+			remain_ = 0;
+			zero_ = false;
+			error_ = false;
+		}
+
+		void store_(uint8_t d) {
+			if(pos_ >= size_) {
+				error_ = true;
+				return;
+			}
+			buff_[pos_] = d;
+			++pos_;
+			crc_ = crc16::update(crc_, d);
+		}
+
+		bool end_() {
+			bool ok = false;
+			if(pos_ == 0 && remain_ == 0 && !error_) {  // 空フレームは無視
+			} else if(error_ || remain_ != 0 || pos_ <= CRC_SIZE) {
+				++frame_error_;
+			} else if(crc_ != 0) {
+				++crc_error_;
+			} else {
+				len_ = pos_ - CRC_SIZE;
+				ok = true;
+			}
+			reset_();
+			return ok;
+		}
+
+		void send_byte_(const uint8_t* src, uint16_t len, const uint8_t* crc, uint16_t idx, uint8_t n) {
+			while(n > 0) {
+				uint8_t d = idx < len ? src[idx] : crc[idx - len];
+				sio_.putch_raw(static_cast<char>(d));
+				++idx;
+				--n;
+			}
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+			@param[in]	sio	シリアル入出力
+		*/
+		//-----------------------------------------------------------------//
+		packet_io(SIO& sio) : sio_(sio), buff_(nullptr), size_(0), pos_(0),
+			crc_(crc16::INIT), len_(0), remain_(0), zero_(false), error_(false), done_(false),
+			crc_error_(0), frame_error_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信バッファを設定 @n
+					※ペイロード最大長＋２（CRC）のサイズが必要
+			@param[in]	buff	受信バッファ
+			@param[in]	size	バッファサイズ
+		*/
+		//-----------------------------------------------------------------//
+		void set_buffer(void* buff, uint16_t size) {
+			buff_ = static_cast<uint8_t*>(buff);
+			size_ = size;
+			len_ = 0;
+			done_ = false;
+			reset_();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信サービス @n
+					受信 FIFO に溜まったデータを、受信バッファ上でデコードする @n
+					フレームが揃ったら、以降のデータは読まずに戻る
+			@return 正常なフレームを受信したら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool service() {
+			if(buff_ == nullptr) return false;
+
+			if(done_) {
+				done_ = false;
+				len_ = 0;
+			}
+
+			while(sio_.length() > 0) {
+				uint8_t d = static_cast<uint8_t>(sio_.getch());
+				if(d == DELIMITER) {
+					if(end_()) {
+						done_ = true;
+						return true;
+					}
+				} else if(remain_ == 0) {  // コード・バイト
+					if(zero_) store_(0);
+					remain_ = d - 1;
+					zero_ = d != 0xFF;
+				} else {
+					store_(d);
+					--remain_;
+				}
+			}
+			return false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信したペイロードの長さを取得 @n
+					ペイロードは、受信バッファの先頭に格納されている @n
+					次の「service」呼び出しまで有効
+			@return ペイロードの長さ
+		*/
+		//-----------------------------------------------------------------//
+		uint16_t get_length() const { return len_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  CRC エラー数を取得
+			@return CRC エラー数
+		*/
+		//-----------------------------------------------------------------//
+		uint16_t get_crc_error() const { return crc_error_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレーム・エラー（溢れ、途切れ）数を取得
+			@return フレーム・エラー数
+		*/
+		//-----------------------------------------------------------------//
+		uint16_t get_frame_error() const { return frame_error_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレームを送信
+			@param[in]	src	ペイロード
+			@param[in]	len	ペイロードの長さ
+		*/
+		//-----------------------------------------------------------------//
+		void send(const void* src, uint16_t len) {
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			uint16_t c = crc16::calc(p, len);
+			uint8_t crc[CRC_SIZE];
+			crc[0] = c >> 8;
+			crc[1] = c & 0xff;
+
+			uint16_t total = len + CRC_SIZE;
+			uint16_t idx = 0;
+			while(1) {
+				uint8_t n = 0;
+				while(n < 254 && (idx + n) < total) {
+					uint16_t i = idx + n;
+					uint8_t d = i < len ? p[i] : crc[i - len];
+					if(d == 0) break;
+					++n;
+				}
+				sio_.putch_raw(static_cast<char>(n + 1));
+				send_byte_(p, len, crc, idx, n);
+				idx += n;
+				if(idx >= total) break;
+				if(n < 254) ++idx;  // ゼロを読み飛ばす
+			}
+			sio_.putch_raw(static_cast<char>(DELIMITER));
+		}
+	};
+}
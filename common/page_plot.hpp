@@ -0,0 +1,469 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ページ・レイアウト、フレームバッファ・プロット・クラス @n
+			ST7565、UC1701、SH1106 などの、カラム・バイト（縦８ドット、@n
+			LSB が上）、ページ・アドレスの LCD/OLED と同じ並びを持つ。@n
+			「monograph」は、hspan/vspan/blit_bits/line を検出して、@n
+			点単位ではなく、バイト単位で描画する。@n
+			書き換えた領域を、ページ毎のカラム範囲で記録し、@n
+			「flush」で、変更のあった部分だけを LCD に転送する。@n
+			※点単位（operator()）は、点毎に範囲を記録するので、素の PLOT @n
+			　より遅い（line は、ページ毎にまとめて記録する）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/monograph.hpp"
+
+namespace graphics {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ページ・レイアウト、プロット・クラス
+		@param[in]	W	横幅（最大２５５）
+		@param[in]	H	高さ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <int16_t W, int16_t H>
+	class page_plot {
+
+		static_assert(W > 0 && W <= 255, "W out of range");
+
+	public:
+		typedef int16_t value_type;
+
+		static const int16_t WIDTH  = W;
+		static const int16_t HEIGHT = H;
+		static const uint8_t PAGE_NUM = (H + 7) / 8;	///< ページ数
+		static const plot_layout LAYOUT = plot_layout::PAGE;
+		static const uint8_t LAST_MASK = 0xff >> (PAGE_NUM * 8 - H);	///< 最後のページの有効ビット
+		static const uint8_t SEGMENT_CMD_BYTES = 3;	///< 転送範囲毎のコマンド・バイト数（ページ、カラム上位、下位）
+
+	private:
+		uint8_t		fb_[W * PAGE_NUM];
+
+		uint8_t		dirty_lo_[PAGE_NUM];	///< 変更のあったカラムの先頭
+		uint8_t		dirty_hi_[PAGE_NUM];	///< 変更のあったカラムの終端（lo > hi なら変更無し）
+
+		void mark_(uint8_t pg, uint8_t x0, uint8_t x1) {
+			if(x0 < dirty_lo_[pg]) dirty_lo_[pg] = x0;
+			if(x1 > dirty_hi_[pg]) dirty_hi_[pg] = x1;
+		}
+
+		// line の点（範囲の記録は、ページが変わった時だけ）
+		void dot_(int16_t x, int16_t y, bool c, int16_t& pg, int16_t& xs, int16_t& xe) {
+			if(x < 0 || x >= W || y < 0 || y >= H) return;
+			int16_t p = y >> 3;
+			if(p != pg) {
+				if(pg >= 0) mark_(pg, xs < xe ? xs : xe, xs < xe ? xe : xs);
+				pg = p;
+				xs = x;
+			}
+			xe = x;
+			uint8_t& d = fb_[p * W + x];
+			if(c) d |= 1 << (y & 7);
+			else d &= ~(1 << (y & 7));
+		}
+
+		static void set_(uint8_t* p, int16_t n, uint8_t m, bool c) {
+			if(c) {
+				while(n > 0) { *p++ |= m; --n; }
+			} else {
+				m = ~m;
+				while(n > 0) { *p++ &= m; --n; }
+			}
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター（最初の flush は全体を転送）
+		*/
+		//-----------------------------------------------------------------//
+		page_plot() { set_dirty(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	全体を変更有りにする（LCD 側の内容が不明な場合など）
+		*/
+		//-----------------------------------------------------------------//
+		void set_dirty()
+		{
+			for(uint8_t i = 0; i < PAGE_NUM; ++i) {
+				dirty_lo_[i] = 0;
+				dirty_hi_[i] = W - 1;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	変更の有無を取得
+			@return 変更があれば「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_dirty() const
+		{
+			for(uint8_t i = 0; i < PAGE_NUM; ++i) {
+				if(dirty_lo_[i] <= dirty_hi_[i]) return true;
+			}
+			return false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	変更のあった範囲だけを LCD に転送 @n
+					LCD クラスは、@n
+					「copy_part(const uint8_t* src, uint8_t page, uint8_t col, uint8_t len)」@n
+					を持つ事
+			@param[in]	lcd	LCD クラス
+			@param[in]	ofs	転送先ページのオフセット
+			@return 転送したバイト数（コマンドを含む）
+		*/
+		//-----------------------------------------------------------------//
+		template <class LCD>
+		uint16_t flush(LCD& lcd, uint8_t ofs = 0)
+		{
+			uint16_t n = 0;
+			for(uint8_t pg = 0; pg < PAGE_NUM; ++pg) {
+				uint8_t lo = dirty_lo_[pg];
+				uint8_t hi = dirty_hi_[pg];
+				if(lo > hi) continue;
+				uint8_t len = hi - lo + 1;
+				lcd.copy_part(&fb_[pg * W + lo], pg + ofs, lo, len);
+				n += len + SEGMENT_CMD_BYTES;
+				dirty_lo_[pg] = 0xff;
+				dirty_hi_[pg] = 0;
+			}
+			return n;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	全体をクリア
+			@param[in]	v	書き込む値（ページ・バイト）
+		*/
+		//-----------------------------------------------------------------//
+		void clear(uint8_t v = 0)
+		{
+			for(uint16_t i = 0; i < sizeof(fb_); ++i) {
+				fb_[i] = v;
+			}
+			set_dirty();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	フレームバッファを取得
+			@return フレームバッファ
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t* fb() { return fb_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	フレームバッファを取得
+			@return フレームバッファ
+		*/
+		//-----------------------------------------------------------------//
+		const uint8_t* fb() const { return fb_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	点を取得
+			@param[in]	x	位置 X
+			@param[in]	y	位置 Y
+			@return 点がある場合「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool get(int16_t x, int16_t y) const
+		{
+			if(x < 0 || x >= W) return false;
+			if(y < 0 || y >= H) return false;
+			return fb_[(y >> 3) * W + x] & (1 << (y & 7));
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	点を描画
+			@param[in]	x	位置 X
+			@param[in]	y	位置 Y
+			@param[in]	val	カラー
+		*/
+		//-----------------------------------------------------------------//
+		void operator() (int16_t x, int16_t y, bool val)
+		{
+			if(x < 0 || x >= W) return;
+			if(y < 0 || y >= H) return;
+
+			uint8_t& d = fb_[(y >> 3) * W + x];
+			if(val) d |= 1 << (y & 7);
+			else d &= ~(1 << (y & 7));
+			mark_(y >> 3, x, x);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	水平線を描画（クリップ付き）
+			@param[in]	x	開始位置 X
+			@param[in]	y	位置 Y
+			@param[in]	w	横幅
+			@param[in]	c	カラー
+		*/
+		//-----------------------------------------------------------------//
+		void hspan(int16_t x, int16_t y, int16_t w, bool c)
+		{
+			if(y < 0 || y >= H) return;
+			if(x < 0) { w += x; x = 0; }
+			if((x + w) > W) w = W - x;
+			if(w <= 0) return;
+
+			set_(&fb_[(y >> 3) * W + x], w, 1 << (y & 7), c);
+			mark_(y >> 3, x, x + w - 1);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	垂直線を描画（クリップ付き） @n
+					ページ全体を覆う部分は、バイト単位で書き込む
+			@param[in]	x	位置 X
+			@param[in]	y	開始位置 Y
+			@param[in]	h	高さ
+			@param[in]	c	カラー
+		*/
+		//-----------------------------------------------------------------//
+		void vspan(int16_t x, int16_t y, int16_t h, bool c)
+		{
+			if(x < 0 || x >= W) return;
+			if(y < 0) { h += y; y = 0; }
+			if((y + h) > H) h = H - y;
+			if(h <= 0) return;
+
+			int16_t ye = y + h - 1;
+			uint8_t* p = &fb_[(y >> 3) * W + x];
+			uint8_t m = 0xff << (y & 7);
+			for(int16_t pg = y >> 3; pg <= (ye >> 3); ++pg) {
+				if(pg == (ye >> 3)) m &= 0xff >> (7 - (ye & 7));
+				if(m == 0xff) *p = c ? 0xff : 0x00;
+				else if(c) *p |= m;
+				else *p &= ~m;
+				mark_(pg, x, x);
+				m = 0xff;
+				p += W;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	線を描画（クリップ付き、monograph::line と同じ点） @n
+					変更の範囲は、ページ毎に、まとめて記録する
+			@param[in]	x1	開始点 X
+			@param[in]	y1	開始点 Y
+			@param[in]	x2	終了点 X
+			@param[in]	y2	終了点 Y
+			@param[in]	c	カラー
+		*/
+		//-----------------------------------------------------------------//
+		void line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c)
+		{
+			int16_t dx;
+			int8_t sx;
+			if(x2 >= x1) { dx = x2 - x1; sx = 1; } else { dx = x1 - x2; sx = -1; }
+			int16_t dy;
+			int8_t sy;
+			if(y2 >= y1) { dy = y2 - y1; sy = 1; } else { dy = y1 - y2; sy = -1; }
+
+			// y は単調なので、ページ毎の X は連続（先頭と最後を記録）
+			int16_t pg = -1;
+			int16_t xs = 0;
+			int16_t xe = 0;
+			if(x1 >= 0 && x1 < W && x2 >= 0 && x2 < W && y1 >= 0 && y1 < H && y2 >= 0 && y2 < H) {
+				// 画面内：ポインターとマスクで進め、ページが変わった時に記録
+				uint8_t* p = &fb_[(y1 >> 3) * W + x1];
+				uint8_t mk = 1 << (y1 & 7);
+				pg = y1 >> 3;
+				xs = x1;
+				int16_t n = dx > dy ? dx : dy;
+				auto m = (dx > dy ? dy : dx) >> 1;
+				for(int16_t i = 0; i <= n; ++i) {
+					if(c) *p |= mk;
+					else *p &= ~mk;
+					xe = x1;
+					if(i == n) break;
+					bool sty;
+					if(dx > dy) {
+						m += dy;
+						sty = m >= dx;
+						if(sty) m -= dx;
+						x1 += sx;
+						p += sx;
+					} else {
+						m += dx;
+						if(m >= dy) {
+							m -= dy;
+							x1 += sx;
+							p += sx;
+						}
+						sty = true;
+					}
+					if(!sty) continue;
+					if(sy > 0) {
+						mk <<= 1;
+						if(mk != 0) continue;
+						mk = 0x01;
+						p += W;
+					} else {
+						mk >>= 1;
+						if(mk != 0) continue;
+						mk = 0x80;
+						p -= W;
+					}
+					mark_(pg, xs < xe ? xs : xe, xs < xe ? xe : xs);
+					pg += sy;
+					xs = x1;
+				}
+				mark_(pg, xs < xe ? xs : xe, xs < xe ? xe : xs);
+				return;
+			}
+			if(dx > dy) {
+				auto m = dy >> 1;
+				for(int16_t i = 0; i <= dx; ++i) {
+					dot_(x1, y1, c, pg, xs, xe);
+					m += dy;
+					if(m >= dx) {
+						m -= dx;
+						y1 += sy;
+					}
+					x1 += sx;
+				}
+			} else {
+				auto m = dx >> 1;
+				for(int16_t i = 0; i <= dy; ++i) {
+					dot_(x1, y1, c, pg, xs, xe);
+					m += dx;
+					if(m >= dy) {
+						m -= dy;
+						x1 += sx;
+					}
+					y1 += sy;
+				}
+			}
+			if(pg >= 0) mark_(pg, xs < xe ? xs : xe, xs < xe ? xe : xs);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ビットマップを描画（クリップ付き、「１」のビットのみ） @n
+					ソースは、「monograph::draw_image」と同じ、横方向、@n
+					LSB が左で、行を跨いで連続したビット列
+			@param[in]	x	開始位置 X
+			@param[in]	y	開始位置 Y
+			@param[in]	src	ソース
+			@param[in]	w	ソースの横幅
+			@param[in]	h	ソースの高さ
+		*/
+		//-----------------------------------------------------------------//
+		void blit_bits(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h)
+		{
+			int16_t j0 = 0;
+			if(x < 0) j0 = -x;
+			int16_t j1 = w;
+			if((x + j1) > W) j1 = W - x;
+			if(j0 >= j1) return;
+
+			uint16_t pos = 0;
+			for(uint8_t i = 0; i < h; ++i, ++y, pos += w) {
+				if(y < 0) continue;
+				if(y >= H) break;
+
+				uint16_t b = pos + j0;
+				const uint8_t* s = src + (b >> 3);
+				uint8_t c = *s++ >> (b & 7);
+				uint8_t r = 8 - (b & 7);  // c の残りビット数
+				uint8_t m = 1 << (y & 7);
+				uint8_t* p = &fb_[(y >> 3) * W + x + j0];
+				int16_t n = j1 - j0;
+				mark_(y >> 3, x + j0, x + j1 - 1);
+				while(n > 0) {
+					// 残りのビットが空白なら、まとめて進める
+					if(c == 0) {
+						if(n <= r) break;
+						p += r;
+						n -= r;
+						c = *s++;
+						r = 8;
+						continue;
+					}
+					if(c & 1) *p |= m;
+					c >>= 1;
+					++p;
+					--n;
+					--r;
+				}
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ページ・レイアウトのビットマップを描画（クリップ付き、「１」のビットのみ） @n
+					ソースは、ページ０のカラム（w バイト）、ページ１のカラム ... の順 @n
+					Y がページ境界に無い場合は、シフトして２ページに分けて書き込む
+			@param[in]	x	開始位置 X
+			@param[in]	y	開始位置 Y
+			@param[in]	src	ソース
+			@param[in]	w	ソースの横幅
+			@param[in]	pages	ソースのページ数
+		*/
+		//-----------------------------------------------------------------//
+		void blit_pages(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t pages)
+		{
+			int16_t j0 = 0;
+			if(x < 0) j0 = -x;
+			int16_t j1 = w;
+			if((x + j1) > W) j1 = W - x;
+			if(j0 >= j1) return;
+
+			uint8_t sh = y & 7;
+			int16_t pg = y >> 3;  // 負の場合も、切り捨て
+			for(uint8_t i = 0; i < pages; ++i, ++pg, src += w) {
+				// 下位側（pg）、上位側（pg + 1）の書き込み可否
+				bool lo = pg >= 0 && pg < PAGE_NUM;
+				bool hi = sh != 0 && (pg + 1) >= 0 && (pg + 1) < PAGE_NUM;
+				if(!lo && !hi) continue;
+				uint8_t mlo = pg == (PAGE_NUM - 1) ? LAST_MASK : 0xff;
+				uint8_t mhi = (pg + 1) == (PAGE_NUM - 1) ? LAST_MASK : 0xff;
+				int16_t o = pg * W + x;
+				for(int16_t j = j0; j < j1; ++j) {
+					uint8_t d = src[j];
+					if(d == 0) continue;
+					if(lo) fb_[o + j] |= (d << sh) & mlo;
+					if(hi) fb_[o + W + j] |= (d >> (8 - sh)) & mhi;
+				}
+				if(lo) mark_(pg, x + j0, x + j1 - 1);
+				if(hi) mark_(pg + 1, x + j0, x + j1 - 1);
+			}
+		}
+	};
+
+	template <int16_t W, int16_t H> const int16_t page_plot<W, H>::WIDTH;
+	template <int16_t W, int16_t H> const int16_t page_plot<W, H>::HEIGHT;
+	template <int16_t W, int16_t H> const uint8_t page_plot<W, H>::PAGE_NUM;
+	template <int16_t W, int16_t H> const plot_layout page_plot<W, H>::LAYOUT;
+	template <int16_t W, int16_t H> const uint8_t page_plot<W, H>::LAST_MASK;
+	template <int16_t W, int16_t H> const uint8_t page_plot<W, H>::SEGMENT_CMD_BYTES;
+}
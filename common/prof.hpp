@@ -0,0 +1,258 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	区間のサイクル計測（プロファイラー） @n
+			・PROF_SCOPE(id) から、スコープの終わりまでを、タイマー RB の @n
+			　カウンター（trb_io::get_timer）で計り、id 毎に、回数、最小、@n
+			　最大、合計を、固定の表に積算する @n
+			・dump で、表を UART（uart_io）に出す（prof_dump で読める）@n
+			・PROF_ENABLE が無ければ、何も生成しない（表も無く、PROF_SCOPE は空、@n
+			　prof の関数は空のインライン）@n
+			PROF_SCOPE は、アプリケーションが定義する「PROF」（prof の型）を使う @n
+			@verbatim
+			typedef device::trb_io<utils::null_task, uint8_t> TIMER_B;
+			TIMER_B timer_b_;
+			typedef utils::prof<TIMER_B, 4> PROF;
+
+			void TIMER_RB_intr() { PROF_SCOPE(0); timer_b_.itask(); }
+
+			timer_b_.start(60, 1);
+			PROF::start(timer_b_);
+			...
+			PROF::dump(uart_);
+			@endverbatim
+			※区間は、タイマーの１周期より短い事（長い場合は、周期の余りになる）@n
+			※区間の時間は、その間の割り込みを含む @n
+			※同じ id を、割り込みとメインの両方で使わない事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+
+/// F_CLK は、ダンプ（時間の換算）で必要で、設定が無いとエラーにします。
+#ifndef F_CLK
+#  error "prof.hpp requires F_CLK to be defined"
+#endif
+
+namespace utils {
+
+#ifdef PROF_ENABLE
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  プロファイラー・クラス
+		@param[in]	TIMER	タイマー（trb_io）
+		@param[in]	NUM		id の数
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class TIMER, uint8_t NUM>
+	class prof {
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  積算（タイマーのカウント単位）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct entry_t {
+			uint16_t	count;	///< 回数（0xFFFF で止める）
+			uint16_t	min;
+			uint16_t	max;
+			uint32_t	sum;
+		};
+
+	private:
+		static const TIMER*	timer_;
+		static uint16_t		ovh_;
+		static entry_t		tab_[NUM];
+
+		static uint16_t elapsed_(uint16_t t) {
+			uint16_t n = timer_->get_timer();
+			// ダウン・カウント、リロードを跨いだら、周期を足す
+			if(t >= n) return t - n;
+			return t + timer_->get_limit() + 1 - n;
+		}
+
+		template <class UART>
+		static void put_hex_(UART& uart, uint32_t v) {
+			char tmp[8];
+			uint8_t n = 0;
+			do {
+				uint8_t d = v & 15;
+				tmp[n++] = d < 10 ? ('0' + d) : ('A' - 10 + d);
+				v >>= 4;
+			} while(v != 0);
+			uart.putch(' ');
+			while(n > 0) uart.putch(tmp[--n]);
+		}
+
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  区間（PROF_SCOPE）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class scope {
+			uint8_t		id_;
+			uint16_t	t_;
+		public:
+			scope(uint8_t id) : id_(id), t_(begin()) { }
+			~scope() { end(id_, t_); }
+		};
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  開始（タイマーは、start 済みである事）@n
+					空の区間を計って、計測自体の時間（オーバーヘッド）を求める
+			@param[in]	timer	タイマー
+		*/
+		//-----------------------------------------------------------------//
+		static void start(const TIMER& timer) {
+			timer_ = &timer;
+			clear();
+			uint16_t m = 0xFFFF;
+			for(uint8_t i = 0; i < 4; ++i) {
+				uint16_t t = begin();
+				uint16_t n = elapsed_(t);
+				if(n < m) m = n;
+			}
+			ovh_ = m;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  表を消去
+		*/
+		//-----------------------------------------------------------------//
+		static void clear() {
+			for(uint8_t i = 0; i < NUM; ++i) {
+				tab_[i].count = 0;
+				tab_[i].min = 0;
+				tab_[i].max = 0;
+				tab_[i].sum = 0;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  区間の開始
+			@return タイマーのカウント
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t begin() { return timer_->get_timer(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  区間の終了（積算）
+			@param[in]	id	id
+			@param[in]	t	begin のカウント
+		*/
+		//-----------------------------------------------------------------//
+		static void end(uint8_t id, uint16_t t) {
+			uint16_t n = elapsed_(t);
+			n = n > ovh_ ? n - ovh_ : 0;
+			if(id >= NUM) return;
+			auto& e = tab_[id];
+			if(e.count == 0xFFFF) return;  // 平均が変わらないように止める
+			if(e.count == 0 || n < e.min) e.min = n;
+			if(n > e.max) e.max = n;
+			e.sum += n;
+			++e.count;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  積算の取得
+			@param[in]	id	id
+			@return 積算
+		*/
+		//-----------------------------------------------------------------//
+		static const entry_t& get(uint8_t id) { return tab_[id < NUM ? id : 0]; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  計測自体の時間（カウント）の取得
+			@return オーバーヘッド
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t get_overhead() { return ovh_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  表を出力（１６進）@n
+					「PROF F_CLK shift overhead NUM」、「P id count min max sum」@n
+					（NUM 行）、「END」
+			@param[in]	uart	出力先（putch を持つクラス）
+		*/
+		//-----------------------------------------------------------------//
+		template <class UART>
+		static void dump(UART& uart) {
+			if(timer_ == nullptr) return;
+			uart.putch('\n');
+			uart.putch('P');
+			uart.putch('R');
+			uart.putch('O');
+			uart.putch('F');
+			put_hex_(uart, F_CLK);
+			put_hex_(uart, timer_->get_shift());
+			put_hex_(uart, ovh_);
+			put_hex_(uart, NUM);
+			uart.putch('\n');
+			for(uint8_t i = 0; i < NUM; ++i) {
+				entry_t e = tab_[i];  // 割り込みで変わっても、行の中は揃える
+				uart.putch('P');
+				put_hex_(uart, i);
+				put_hex_(uart, e.count);
+				put_hex_(uart, e.min);
+				put_hex_(uart, e.max);
+				put_hex_(uart, e.sum);
+				uart.putch('\n');
+			}
+			uart.putch('E');
+			uart.putch('N');
+			uart.putch('D');
+			uart.putch('\n');
+		}
+	};
+
+	// スタティック実態定義
+	template <class TIMER, uint8_t NUM>
+	const TIMER* prof<TIMER, NUM>::timer_ = nullptr;
+
+	template <class TIMER, uint8_t NUM>
+	uint16_t prof<TIMER, NUM>::ovh_ = 0;
+
+	template <class TIMER, uint8_t NUM>
+	typename prof<TIMER, NUM>::entry_t prof<TIMER, NUM>::tab_[NUM];
+#else
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  プロファイラー・クラス（無効、何も生成しない）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class TIMER, uint8_t NUM>
+	class prof {
+	public:
+		static void start(const TIMER& timer) { }
+		static void clear() { }
+		template <class UART>
+		static void dump(UART& uart) { }
+	};
+#endif
+}
+
+#ifdef PROF_ENABLE
+#define PROF_CAT2_(a, b) a##b
+#define PROF_CAT_(a, b) PROF_CAT2_(a, b)
+#define PROF_SCOPE(id) PROF::scope PROF_CAT_(prof_scope_, __LINE__)(id)
+#else
+#define PROF_SCOPE(id) do { } while(0)
+#endif
@@ -5,14 +5,15 @@
 			ファミコン内蔵音源と同じような機能を持った波形生成 @n
 			波形をレンダリングして波形バッファに生成する。 @n
 			生成した波形メモリを PWM 変調などで出力する事を前提にしている。 @n
-			分解能は８ビット
+			分解能は８ビット @n
+			ノイズ（LFSR）、DPCM サンプルの周期は、NES と同じテーブルを使う
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2021 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/R8C/blob/master/LICENSE
 */
 //=====================================================================//
-#include "renesas.hpp"
+#include <cstdint>
 
 extern "C" {
 	void sci_putch(char ch);
@@ -37,7 +38,9 @@ namespace utils {
 			SQ50,	///< 矩形波 Duty50%
 			SQ75,	///< 矩形波 Duty75%
 			TRI,	///< 三角波
-			NOISE,	///< ノイズ（現在未サポート）
+			NOISE,	///< ノイズ（長周期）
+			NOISE_S,	///< ノイズ（短周期）
+			DPCM,	///< DPCM サンプル
 		};
 
 
@@ -214,6 +217,9 @@ namespace utils {
 			ATTACK,		///< (2) 音のアタック, gain(0 ~ 255)
 			RELEASE,	///< (3) 音のリリース, release_frame(n), gain(0 ~ 255)
 			CHOUT,		///< (2) 文字出力, char（楽譜のデバッグ用に文字を出力）
+			NOISE,		///< (1) 波形 NOISE（キーの下位４ビットが周期番号、０が最も高い）
+			NOISE_S,	///< (1) 波形 NOISE_S（キーの下位４ビットが周期番号、０が最も高い）
+			DPCM,		///< (2) 波形 DPCM, num(0 ~ 3)（キーの下位４ビットが再生レート番号、０が最も低い）
 		};
 
 
@@ -223,7 +229,10 @@ namespace utils {
 					・KEY, len @n
 					・TR, num @n
 					・TEMPO, num @n
-					・FOR, num
+					・FOR, num @n
+					・パック・ノート（１バイト、0x80 〜 0xFF）: 1LLL SSSS @n
+					　L: 音長（pack_len）、S: 前のキーからの差分 + 7（0 〜 14）、@n
+					　15 は休符（PACK_REST）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 		struct SCORE {
@@ -236,6 +245,45 @@ namespace utils {
 			constexpr SCORE(CTRL c) noexcept : ctrl(c) { }
 			constexpr SCORE(uint8_t l) noexcept : len(l) { }
 		};
+
+		static constexpr uint8_t PACK = 0x80;		///< パック・ノートの先頭ビット
+		static constexpr uint8_t PACK_REST = 15;	///< パック・ノートの休符
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  パック・ノートの音長
+			@param[in]	idx		音長番号（0 〜 7）
+			@return 音長（4, 6, 8, 12, 16, 24, 32, 48）
+		*/
+		//-----------------------------------------------------------------//
+		static constexpr uint8_t pack_len(uint8_t idx) noexcept
+		{
+			return ((idx & 1) != 0 ? 3 : 2) << ((idx >> 1) + 1);
+		}
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  DPCM サンプル構造 @n
+					・１ビット：ビット毎に、「１」で +2、「０」で -2 @n
+					・４ビット：ニブル毎に、デルタ・テーブルの値を加算 @n
+					バイトの LSB 側から再生し、出力は 0 〜 127（64 が中心）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct DPCM {
+			const uint8_t*	src;	///< データ
+			uint16_t		len;	///< バイト数
+			uint8_t			init;	///< 出力の初期値（0 〜 127）
+			bool			bit4;	///< ４ビット・デルタの場合「true」
+		};
+
+	protected:
+		// 周波数から、サンプル毎の位相の増分を求める（１サンプルに１回が上限）
+		static constexpr uint16_t rate_(double hz, uint16_t sample) noexcept
+		{
+			return (hz * 65536.0 / sample) >= 65535.0 ? 65535 : static_cast<uint16_t>(hz * 65536.0 / sample);
+		}
 	};
 
 
@@ -245,7 +293,7 @@ namespace utils {
 		@param[in]	SAMPLE	サンプリング周期
 		@param[in]	TICK	演奏tick（通常１００Ｈｚ）
 		@param[in]	BSIZE	バッファサイズ（通常５１２）
-		@param[in]	CNUM	チャネル数（通常４）
+		@param[in]	CNUM	チャネル数（通常４、最大８）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	template <uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
@@ -268,18 +316,70 @@ namespace utils {
 			static_cast<uint16_t>((3520 * 65536.0 * 1.887748625) / SAMPLE),  ///< G#
 		};
 
+		// NES のノイズ周期（CPU クロック 1.789773MHz 換算）
+		static constexpr uint16_t noise_tbl_[16] = {
+			rate_(1789773.0 /    4, SAMPLE), rate_(1789773.0 /    8, SAMPLE),
+			rate_(1789773.0 /   16, SAMPLE), rate_(1789773.0 /   32, SAMPLE),
+			rate_(1789773.0 /   64, SAMPLE), rate_(1789773.0 /   96, SAMPLE),
+			rate_(1789773.0 /  128, SAMPLE), rate_(1789773.0 /  160, SAMPLE),
+			rate_(1789773.0 /  202, SAMPLE), rate_(1789773.0 /  254, SAMPLE),
+			rate_(1789773.0 /  380, SAMPLE), rate_(1789773.0 /  508, SAMPLE),
+			rate_(1789773.0 /  762, SAMPLE), rate_(1789773.0 / 1016, SAMPLE),
+			rate_(1789773.0 / 2034, SAMPLE), rate_(1789773.0 / 4068, SAMPLE),
+		};
+
+		// NES の DPCM 再生レート（CPU クロック 1.789773MHz 換算）
+		static constexpr uint16_t dpcm_tbl_[16] = {
+			rate_(1789773.0 / 428, SAMPLE), rate_(1789773.0 / 380, SAMPLE),
+			rate_(1789773.0 / 340, SAMPLE), rate_(1789773.0 / 320, SAMPLE),
+			rate_(1789773.0 / 286, SAMPLE), rate_(1789773.0 / 254, SAMPLE),
+			rate_(1789773.0 / 226, SAMPLE), rate_(1789773.0 / 214, SAMPLE),
+			rate_(1789773.0 / 190, SAMPLE), rate_(1789773.0 / 160, SAMPLE),
+			rate_(1789773.0 / 142, SAMPLE), rate_(1789773.0 / 128, SAMPLE),
+			rate_(1789773.0 / 106, SAMPLE), rate_(1789773.0 /  84, SAMPLE),
+			rate_(1789773.0 /  72, SAMPLE), rate_(1789773.0 /  54, SAMPLE),
+		};
+
+		// ４ビット DPCM のデルタ（ニブルを符号付きとして扱う）
+		static constexpr int8_t dpcm4_tbl_[16] = {
+			0, 1, 2, 4, 6, 9, 13, 18, -24, -18, -13, -9, -6, -4, -2, -1
+		};
+
 		static constexpr uint8_t	SUB_SCORE_NUM = 8;  // サブスコア最大数
+		static constexpr uint8_t	DPCM_NUM = 4;  // DPCM サンプル最大数
 		static constexpr uint8_t	STACK_DEPTH = 4;  // 4 レベル
 		static constexpr uint8_t	ENV_CYCLE = SAMPLE / TICK;
+		static constexpr uint8_t	MIX_BLOCK = 16;  // レンダリングのブロック（スタック上の合成バッファ）
+
+		static_assert(CNUM <= 8, "CNUM must be 8 or less");
+
+		// 合成値を「有効チャネル数＋１」で割る代わりに掛ける逆数（ceil(65536 / n)） @n
+		// 合成値の絶対値は 112 * 8 以下なので、除算と同じ結果になる @n
+		// n = 1 は、有効チャネルが無い場合で、合成値は常に０
+		static constexpr uint16_t gain_tbl_[10] = {
+			0, 0,
+			65535 / 2 + 1, 65535 / 3 + 1, 65535 / 4 + 1, 65535 / 5 + 1,
+			65535 / 6 + 1, 65535 / 7 + 1, 65535 / 8 + 1, 65535 / 9 + 1
+		};
+
+		static int16_t scale_(int16_t sum, uint16_t gain) noexcept
+		{
+			if(sum < 0) {
+				return -static_cast<int16_t>((static_cast<uint32_t>(static_cast<uint16_t>(-sum)) * gain) >> 16);
+			} else {
+				return (static_cast<uint32_t>(static_cast<uint16_t>(sum)) * gain) >> 16;
+			}
+		}
 
 		uint16_t	wav_pos_;
 		uint8_t		wav_[BSIZE];
 
 		struct share_t {
 			const SCORE*	sub_score_[SUB_SCORE_NUM];
+			const DPCM*		dpcm_[DPCM_NUM];
 			bool			pause_;
 			share_t() noexcept :
-				sub_score_{ nullptr }, pause_(false)
+				sub_score_{ nullptr }, dpcm_{ nullptr }, pause_(false)
 			{ }
 		};
 		share_t		share_;
@@ -290,7 +390,7 @@ namespace utils {
 		};
 
 		struct channel {
-			share_t&	share_;
+			share_t*	share_;
 			uint8_t		volume_;
 			uint8_t		fade_;
 			uint8_t		fade_spd_;
@@ -314,14 +414,22 @@ namespace utils {
 			stack_t		stack_[STACK_DEPTH];
 			uint8_t		stack_pos_;
 			uint16_t	total_count_;
-			channel(share_t& share) noexcept : share_(share), volume_(0), fade_(0), fade_spd_(0), fade_cnt_(0),
+			uint16_t	lfsr_;
+			const DPCM*	dpcm_;
+			uint16_t	dpcm_pos_;
+			uint8_t		dpcm_bit_;
+			uint8_t		dpcm_val_;
+			uint8_t		last_key_;  // パック・ノートの基準
+			channel() noexcept : share_(nullptr), volume_(0), fade_(0), fade_spd_(0), fade_cnt_(0),
 				wtype_(WTYPE::SQ50), acc_(0), spd_(0),
 				score_org_(nullptr), score_pos_(0),
 				tempo_(0), count_(0),
 				tr_(0), loop_org_(0), loop_cnt_(0),
 				env_(0), env_cycle_(0), attack_(0), rel_frame_(0), release_(0), rel_count_(0),
 				stack_{ }, stack_pos_(0),
-				total_count_(0)
+				total_count_(0),
+				lfsr_(1), dpcm_(nullptr), dpcm_pos_(0), dpcm_bit_(0), dpcm_val_(64),
+				last_key_(0)
 			{ }
 
 			void init() noexcept
@@ -339,66 +447,147 @@ namespace utils {
 				rel_frame_ = 6; // リリース TICK 標準
 			}
 
-			void update() noexcept
+			// エンベロープ（ENV_CYCLE サンプル毎）
+			void envelope_() noexcept
+			{
+				if(rel_count_ > 0) {
+					rel_count_--;
+					// +エンベロープ
+					env_ += static_cast<uint16_t>((volume_ - env_) * attack_) >> 8;
+				} else {
+					// -エンベロープ
+					uint8_t n = static_cast<uint16_t>(env_ * release_) >> 8;
+					if(n > 0) env_ -= n;
+					else {
+						if(env_ > 0) --env_;
+					}
+				}
+			}
+
+			void square_(int16_t* dst, uint8_t len, uint16_t th) noexcept
 			{
-				acc_ += spd_;
+				// 矩形波は、三角波に比べて、音圧が高いので、バランスを取る為少し弱める。
+				int8_t on = env_ - (env_ >> 3);
+				int8_t off = -on;
+				for(uint8_t i = 0; i < len; ++i) {
+					acc_ += spd_;
+					dst[i] += (acc_ & 0xc000) >= th ? on : off;
+				}
 			}
 
-			int8_t get() noexcept
+			void triangle_(int16_t* dst, uint8_t len) noexcept
 			{
-				if(spd_ == 0) return 0;
-
-				bool on = false;
-				int8_t w = 0;
-				switch(wtype_) {
-				case WTYPE::SQ25:
-					if((acc_ & 0xc000) >= 0xc000) on = true;
-					// 矩形波は、三角波に比べて、音圧が高いので、バランスを取る為少し弱める。
-					w = env_ - (env_ >> 3);
-					break;
-				case WTYPE::SQ50:
-					if((acc_ & 0xc000) >= 0x8000) on = true;
-					// 矩形波は、三角波に比べて、音圧が高いので、バランスを取る為少し弱める。
-					w = env_ - (env_ >> 3);
-					break;
-				case WTYPE::SQ75:
-					if((acc_ & 0xc000) >= 0x4000) on = true;
-					// 矩形波は、三角波に比べて、音圧が高いので、バランスを取る為少し弱める。
-					w = env_ - (env_ >> 3);
-					break;
-				case WTYPE::TRI:
-					{
-						w = (acc_ >> 11) & 0b111;
-						if((acc_ & 0x4000) != 0) w ^= 0b111;
-						w *= env_ >> 3;
-						if((acc_ & 0x8000) != 0) {
-							on = true;
-						}
+				uint8_t g = env_ >> 3;
+				for(uint8_t i = 0; i < len; ++i) {
+					acc_ += spd_;
+					int8_t w = (acc_ >> 11) & 0b111;
+					if((acc_ & 0x4000) != 0) w ^= 0b111;
+					w *= g;
+					if((acc_ & 0x8000) == 0) w = -w;
+					dst[i] += w;
+				}
+			}
+
+			// ノイズ（１５ビット LFSR、位相が一周する毎に１回シフト）
+			void noise_(int16_t* dst, uint8_t len) noexcept
+			{
+				int8_t on = env_ - (env_ >> 3);
+				int8_t off = -on;
+				uint8_t tap = wtype_ == WTYPE::NOISE_S ? 6 : 1;
+				for(uint8_t i = 0; i < len; ++i) {
+					uint16_t a = acc_ + spd_;
+					if(a < acc_) {
+						uint16_t fb = (lfsr_ ^ (lfsr_ >> tap)) & 1;
+						lfsr_ = (lfsr_ >> 1) | (fb << 14);
 					}
-					break;
-				case WTYPE::NOISE:
-					w = 0;
-					break;
+					acc_ = a;
+					dst[i] += (lfsr_ & 1) != 0 ? off : on;
 				}
-				if(!on) { w = -w; }
+			}
 
-				++env_cycle_;
-				if(env_cycle_ >= ENV_CYCLE) {
-					env_cycle_ = 0;
-					if(rel_count_ > 0) {
-						rel_count_--;
-						// +エンベロープ
-						env_ += static_cast<uint16_t>((volume_ - env_) * attack_) >> 8;
-					} else {
-						// -エンベロープ
-						uint8_t n = static_cast<uint16_t>(env_ * release_) >> 8;
-						if(n > 0) env_ -= n;
-						else {
-							if(env_ > 0) --env_;
+			// DPCM を１ステップ進める（終端なら「false」）
+			bool dpcm_step_() noexcept
+			{
+				if(dpcm_pos_ >= dpcm_->len) return false;
+
+				uint8_t d = dpcm_->src[dpcm_pos_] >> dpcm_bit_;
+				int16_t v = dpcm_val_;
+				if(dpcm_->bit4) {
+					v += dpcm4_tbl_[d & 15];
+					dpcm_bit_ += 4;
+				} else {
+					if(d & 1) v += 2;
+					else v -= 2;
+					++dpcm_bit_;
+				}
+				if(v < 0) v = 0;
+				else if(v > 127) v = 127;
+				dpcm_val_ = v;
+				if(dpcm_bit_ >= 8) {
+					dpcm_bit_ = 0;
+					++dpcm_pos_;
+				}
+				return true;
+			}
+
+			// DPCM はエンベロープを使わず、ボリュームだけを掛ける
+			void dpcm_mix_(int16_t* dst, uint8_t len) noexcept
+			{
+				int8_t w = (static_cast<int16_t>(dpcm_val_ - 64) * volume_) >> 7;
+				for(uint8_t i = 0; i < len; ++i) {
+					uint16_t a = acc_ + spd_;
+					if(a < acc_) {
+						if(dpcm_step_()) {
+							w = (static_cast<int16_t>(dpcm_val_ - 64) * volume_) >> 7;
+						} else {
+							spd_ = 0;
+							w = 0;
 						}
 					}
+					acc_ = a;
+					dst[i] += w;
+				}
+			}
+
+			// ブロック単位で波形を合成して、dst に加算する @n
+			// エンベロープが変化しない区間毎に、波形の分岐をまとめる
+			void mix(int16_t* dst, uint8_t len) noexcept
+			{
+				// 音程が無い場合、波形は「０」で、エンベロープも進まない
+				if(spd_ == 0) return;
+
+				while(len > 0) {
+					uint8_t n = ENV_CYCLE - env_cycle_;
+					if(n > len) n = len;
+					switch(wtype_) {
+					case WTYPE::SQ25:
+						square_(dst, n, 0xc000);
+						break;
+					case WTYPE::SQ50:
+						square_(dst, n, 0x8000);
+						break;
+					case WTYPE::SQ75:
+						square_(dst, n, 0x4000);
+						break;
+					case WTYPE::TRI:
+						triangle_(dst, n);
+						break;
+					case WTYPE::NOISE:
+					case WTYPE::NOISE_S:
+						noise_(dst, n);
+						break;
+					case WTYPE::DPCM:
+						dpcm_mix_(dst, n);
+						break;
+					}
+					dst += n;
+					len -= n;
+					env_cycle_ += n;
+					if(env_cycle_ >= ENV_CYCLE) {
+						env_cycle_ = 0;
+						envelope_();
+					}
 				}
-				return w;
 			}
 
 			void set_freq(uint16_t frq) noexcept { spd_ = (static_cast<uint32_t>(frq) << 16) / SAMPLE; }
@@ -419,7 +608,7 @@ namespace utils {
 					}
 				}
 
-				if(share_.pause_) return true;
+				if(share_->pause_) return true;
 
 				if(count_ >= tempo_) {
 					count_ -= tempo_;
@@ -428,29 +617,51 @@ namespace utils {
 
 				auto v = score_org_[score_pos_];
 				++score_pos_;
-				if(v.len < 88) {
-					v.len += tr_;
-					if(v.len >= 0x80) v.len = 0;
-					else if(v.len >= 88) v.len = 87;
-					auto o = v.len / 12;
-					auto k = v.len % 12;
-					spd_ = key_tbl_[k] >> (7 - o);
+				uint8_t key = v.len;
+				uint8_t len = 0;
+				if(v.len >= PACK) {  // パック・ノート
+					len = pack_len((v.len >> 4) & 7);
+					if((v.len & 15) == PACK_REST) key = 88;
+					else key = last_key_ + (v.len & 15) - 7;
+				} else if(v.len <= 88) {
+					len = score_org_[score_pos_].len;
+					++score_pos_;
+				}
+				if(key < 88) {
+					last_key_ = key;
+					key += tr_;
+					if(key >= 0x80) key = 0;
+					else if(key >= 88) key = 87;
+					if(wtype_ == WTYPE::NOISE || wtype_ == WTYPE::NOISE_S) {
+						spd_ = noise_tbl_[key & 15];
+					} else if(wtype_ == WTYPE::DPCM) {
+						if(dpcm_ != nullptr) {
+							spd_ = dpcm_tbl_[key & 15];
+							dpcm_pos_ = 0;
+							dpcm_bit_ = 0;
+							dpcm_val_ = dpcm_->init;
+						} else {
+							spd_ = 0;
+						}
+					} else {
+						auto o = key / 12;
+						auto k = key % 12;
+						spd_ = key_tbl_[k] >> (7 - o);
+					}
 					acc_ = 0;
 					env_ = 0;
-					total_count_ += score_org_[score_pos_].len;
-					count_ += static_cast<uint16_t>(score_org_[score_pos_].len) << 8;
-					++score_pos_;
+					total_count_ += len;
+					count_ += static_cast<uint16_t>(len) << 8;
 					// リリースポイント計算
 					rel_count_ = (count_ / tempo_) - rel_frame_;
 					env_cycle_ = 0;
 					return true;
-				} else if(v.len == 88) {  // 休符
+				} else if(key == 88) {  // 休符
 					spd_ = 0;
 					acc_ = 0;
 					env_ = 0;
-					total_count_ += score_org_[score_pos_].len;
-					count_ += score_org_[score_pos_].len << 8;
-					++score_pos_;
+					total_count_ += len;
+					count_ += static_cast<uint16_t>(len) << 8;
 					return true;
 				} else {
 					switch(v.ctrl) {
@@ -516,7 +727,7 @@ namespace utils {
 							stack_[stack_pos_].org_ = score_org_;
 							stack_[stack_pos_].pos_ = score_pos_;
 							++stack_pos_;
-							score_org_ = share_.sub_score_[v.len - static_cast<uint8_t>(CTRL::CALL0)];
+							score_org_ = share_->sub_score_[v.len - static_cast<uint8_t>(CTRL::CALL0)];
 							score_pos_ = 0;
 						}
 						break;
@@ -545,6 +756,17 @@ namespace utils {
 						sci_putch(static_cast<char>(score_org_[score_pos_].len));
 						++score_pos_;
 						break;
+					case CTRL::NOISE:
+						wtype_ = WTYPE::NOISE;
+						break;
+					case CTRL::NOISE_S:
+						wtype_ = WTYPE::NOISE_S;
+						break;
+					case CTRL::DPCM:
+						wtype_ = WTYPE::DPCM;
+						dpcm_ = share_->dpcm_[score_org_[score_pos_].len & (DPCM_NUM - 1)];
+						++score_pos_;
+						break;
 					default:
 						break;
 					}
@@ -563,8 +785,12 @@ namespace utils {
 		//-----------------------------------------------------------------//
 		psg_mng() noexcept : wav_pos_(0), wav_{ 0x80 },
 			share_(),
-			channel_{ share_, share_, share_ }
-		{ }
+			channel_{ }
+		{
+			for(uint8_t i = 0; i < CNUM; ++i) {
+				channel_[i].share_ = &share_;
+			}
+		}
 
 
 		//-----------------------------------------------------------------//
@@ -629,27 +855,49 @@ namespace utils {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  レンダリング
+			@brief  合成値の正規化（「sum / n」と同じ結果）
+			@param[in]	sum		合成値
+			@param[in]	n		有効チャネル数＋１（2 to CNUM + 1）
+			@return 正規化した値
+		*/
+		//-----------------------------------------------------------------//
+		static int16_t scale(int16_t sum, uint8_t n) noexcept { return scale_(sum, gain_tbl_[n]); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レンダリング @n
+					MIX_BLOCK サンプル毎に、チャネル単位で合成して、@n
+					有効チャネル数で正規化する
 			@param[in]	count	波形数
 		*/
 		//-----------------------------------------------------------------//
 		void render(uint16_t count) noexcept
 		{
-			for(uint16_t i = 0; i < count; ++i) {
-				int16_t sum = 0;
-				// int8_t n = 0;
-				int8_t n = 1;  // 理由がイマイチ判らないが、フルスケールで合成するとノイズが乗るので、とりあえず、全体のゲインを下げる。
-				// ノイズが乗る原因は、そもそも PWM 変調に問題があるのかもしれない・・
+			// int8_t n = 0;
+			int8_t n = 1;  // 理由がイマイチ判らないが、フルスケールで合成するとノイズが乗るので、とりあえず、全体のゲインを下げる。
+			// ノイズが乗る原因は、そもそも PWM 変調に問題があるのかもしれない・・
+			// 有効なチャネルは、service でのみ変化するので、ゲインは一度だけ求める
+			for(uint8_t j = 0; j < CNUM; ++j) {
+				if(channel_[j].score_org_ != nullptr) ++n;
+			}
+			uint16_t gain = gain_tbl_[n];
+
+			int16_t mix[MIX_BLOCK];
+			while(count > 0) {
+				uint8_t len = count > MIX_BLOCK ? MIX_BLOCK : count;
+				for(uint8_t i = 0; i < len; ++i) mix[i] = 0;
 				for(uint8_t j = 0; j < CNUM; ++j) {
 					if(channel_[j].score_org_ != nullptr) {
-						channel_[j].update();
-						sum += static_cast<int16_t>(channel_[j].get());
-						++n;
+						channel_[j].mix(mix, len);
 					}
 				}
-				wav_[wav_pos_] = (sum / n) + 0x80;
-				++wav_pos_;
-				if(wav_pos_ >= BSIZE) wav_pos_ = 0;
+				for(uint8_t i = 0; i < len; ++i) {
+					wav_[wav_pos_] = scale_(mix[i], gain) + 0x80;
+					++wav_pos_;
+					if(wav_pos_ >= BSIZE) wav_pos_ = 0;
+				}
+				count -= len;
 			}
 		}
 
@@ -696,6 +944,45 @@ namespace utils {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  DPCM サンプルの設定（スコアの「CTRL::DPCM, idx」で選択）
+			@param[in]	idx		インデックス
+			@param[in]	dpcm	DPCM サンプル
+		*/
+		//-----------------------------------------------------------------//
+		void set_dpcm(uint8_t idx, const DPCM* dpcm) noexcept
+		{
+			if(idx >= DPCM_NUM) return;
+
+			share_.dpcm_[idx] = dpcm;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  チャネル毎の演奏サービス
+			@param[in]	ch	チャネル
+			@return 読み込んだスコア・コマンド数
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t service(uint8_t ch) noexcept
+		{
+			if(ch >= CNUM) return 0;
+
+			auto& c = channel_[ch];
+			uint8_t n = 0;
+			for(;;) {
+				auto org = c.score_org_;
+				auto pos = c.score_pos_;
+				bool f = c.service();
+				if(org != c.score_org_ || pos != c.score_pos_) ++n;
+				if(f) break;
+			}
+			return n;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  演奏サービス
@@ -704,11 +991,7 @@ namespace utils {
 		void service() noexcept
 		{
 			for(uint8_t i = 0; i < CNUM; ++i) {
-				for(;;) {
-					if(channel_[i].service()) {
-						break;
-					}
-				}
+				service(i);
 			}
 		}
 
@@ -722,6 +1005,57 @@ namespace utils {
 		void pause(bool ena = true) noexcept { share_.pause_ = ena; }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  波形タイプの取得
+			@param[in]	ch	チャネル
+			@return 波形タイプ
+		*/
+		//-----------------------------------------------------------------//
+		WTYPE get_wtype(uint8_t ch) const noexcept
+		{
+			if(ch < CNUM) {
+				return channel_[ch].wtype_;
+			} else {
+				return WTYPE::SQ50;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  発音中か検査（休符、演奏終了では「false」）
+			@param[in]	ch	チャネル
+			@return 発音中なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_sound(uint8_t ch) const noexcept
+		{
+			if(ch < CNUM) {
+				return channel_[ch].score_org_ != nullptr && channel_[ch].spd_ != 0;
+			} else {
+				return false;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  演奏終了か検査
+			@param[in]	ch	チャネル
+			@return スコアが無い、又は終了していれば「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_end(uint8_t ch) const noexcept
+		{
+			if(ch < CNUM) {
+				return channel_[ch].score_org_ == nullptr;
+			} else {
+				return true;
+			}
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  合計音長を得る
@@ -740,4 +1074,16 @@ namespace utils {
 
 	template<uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
 		constexpr uint16_t psg_mng<SAMPLE, TICK, BSIZE, CNUM>::key_tbl_[12];
+
+	template<uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
+		constexpr uint16_t psg_mng<SAMPLE, TICK, BSIZE, CNUM>::gain_tbl_[10];
+
+	template<uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
+		constexpr uint16_t psg_mng<SAMPLE, TICK, BSIZE, CNUM>::noise_tbl_[16];
+
+	template<uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
+		constexpr uint16_t psg_mng<SAMPLE, TICK, BSIZE, CNUM>::dpcm_tbl_[16];
+
+	template<uint16_t SAMPLE, uint16_t TICK, uint16_t BSIZE, uint16_t CNUM>
+		constexpr int8_t psg_mng<SAMPLE, TICK, BSIZE, CNUM>::dpcm4_tbl_[16];
 }
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	RAM、スタックの使用量（ハイ・ウォーター・マーク）@n
+			・start.s で、bss の後ろから、割り込みスタックの上（_isp_init）@n
+			　までを、PAINT で埋めておき、書き換わった所までを、使った量とする @n
+			・ユーザースタックは、bss の後ろ（__bssend）〜 _usp_init、@n
+			　割り込みスタックは、_usp_init 〜 _isp_init（m120an.ld） @n
+			・ユーザースタックの空きが、RAM の空き（静的な変数と、スタックの @n
+			　間）になる @n
+			@verbatim
+			utils::format("USP: %d / %d, ISP: %d / %d, free: %d\n")
+				% utils::ram_info::usp_used() % utils::ram_info::usp_size()
+				% utils::ram_info::isp_used() % utils::ram_info::isp_size()
+				% utils::ram_info::free_ram();
+			@endverbatim
+			※used は、領域を下から読むので、空きの大きさに比例した時間がかかる @n
+			※スタックに、PAINT と同じ値が積まれた場合、その分、少なく見える @n
+			※IO_HOST では、リンカーのシンボルが無いので、used、paint だけ
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+
+#ifndef IO_HOST
+extern "C" {
+	// リンカー・スクリプト（m120an.ld）のシンボル（アドレスだけを使う）
+	extern uint16_t _datastart;
+	extern uint16_t _bssend;
+	extern uint16_t usp_init;
+	extern uint16_t isp_init;
+};
+#endif
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  RAM、スタックの使用量
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct ram_info {
+
+		/// スタックを埋める値（start.s と同じ）
+		static constexpr uint16_t PAINT = 0x5AA5;
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  領域を PAINT で埋める
+			@param[in]	bottom	領域の下（小さいアドレス）
+			@param[in]	top		領域の上（含まない）
+		*/
+		//-----------------------------------------------------------------//
+		static void paint(uint16_t* bottom, uint16_t* top) {
+			while(bottom < top) {
+				*bottom++ = PAINT;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  スタック領域の使った量（下から、書き換わった所を探す）
+			@param[in]	bottom	領域の下（小さいアドレス）
+			@param[in]	top		領域の上（スタックの初期値）
+			@return 使った量（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t used(const uint16_t* bottom, const uint16_t* top) {
+			const volatile uint16_t* p = bottom;
+			while(p < top && *p == PAINT) ++p;
+			return static_cast<uint16_t>(reinterpret_cast<const uint8_t*>(top)
+				- reinterpret_cast<const volatile uint8_t*>(p));
+		}
+
+#ifndef IO_HOST
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  静的な変数（data、bss）の大きさ
+			@return 大きさ（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t static_size() {
+			return reinterpret_cast<uintptr_t>(&_bssend) - reinterpret_cast<uintptr_t>(&_datastart);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ユーザースタック領域の大きさ（bss の後ろ 〜 _usp_init）
+			@return 大きさ（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t usp_size() {
+			return reinterpret_cast<uintptr_t>(&usp_init) - reinterpret_cast<uintptr_t>(&_bssend);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ユーザースタックの最大の使用量
+			@return 使用量（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t usp_used() { return used(&_bssend, &usp_init); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  割り込みスタック領域の大きさ（_usp_init 〜 _isp_init）
+			@return 大きさ（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t isp_size() {
+			return reinterpret_cast<uintptr_t>(&isp_init) - reinterpret_cast<uintptr_t>(&usp_init);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  割り込みスタックの最大の使用量 @n
+					大きさと同じなら、溢れて、ユーザースタックを壊している
+			@return 使用量（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t isp_used() { return used(&usp_init, &isp_init); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  RAM の空き（静的な変数と、ユーザースタックの最大の間）
+			@return 空き（バイト）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t free_ram() { return usp_size() - usp_used(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ユーザースタックの最大を、今の位置に戻す（処理毎に計る場合）@n
+					関数を呼ぶと、そのフレームを埋めてしまうので、sp の読み出しと、@n
+					埋める処理（sstr.w）を、１つの asm で行う（start.s と同じ）
+		*/
+		//-----------------------------------------------------------------//
+		static void reset_usp() {
+			asm volatile (
+				"stc sp,r3\n\t"
+				"mov.w #__bssend,a1\n\t"
+				"sub.w a1,r3\n\t"
+				"shl.w #-1,r3\n\t"
+				"mov.w %0,r0\n\t"
+				"sstr.w"
+				: : "r" (PAINT) : "r0", "r3", "a1", "memory");
+		}
+#endif
+	};
+}
@@ -0,0 +1,278 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	協調型スケジューラー @n
+			・タスク（id 毎の関数）を、周期（位相付き）、１回（期限）、@n
+			　割り込みからのイベント（post）で呼ぶ @n
+			・ティックは、タイマーの割り込みで進める（tick_task を trb_io の @n
+			　TASK にするか、割り込みで itick を呼ぶ）@n
+			・イベントは、割り込み側が書き、メイン側が読むだけのキューなので、@n
+			　割り込みを止めない、イベントは、周期のタスクより先に呼ぶ @n
+			・する事が無い場合、WAIT 命令で、次の割り込みまで止まる @n
+			・RAM は、タスク毎に 6 バイトと、EVENTS + 5 バイト @n
+			@verbatim
+			typedef utils::sched<4, 8> SCHED;
+			typedef device::trb_io<SCHED::tick_task, uint8_t> TIMER_B;
+
+			void UART0_RX_intr() { uart_.irecv(); SCHED::post(1); }
+
+			SCHED::set_periodic(0, led_task_, 60, 20);  // 60 ティック毎、20 ティック後から
+			SCHED::set_event(1, uart_task_);
+			SCHED::run();
+			@endverbatim
+			※post は、割り込み（多重にしない）からだけ呼ぶ事 @n
+			※周期、期限は、32767 ティックまで
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include "common/io_utils.hpp"
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  協調型スケジューラー・クラス
+		@param[in]	TASKS	タスクの数（最大 8）
+		@param[in]	EVENTS	イベント・キューの大きさ（２のべき乗、最大 128）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint8_t TASKS, uint8_t EVENTS = 8>
+	class sched {
+
+		static_assert(TASKS > 0 && TASKS <= 8, "sched: TASKS must be 1 to 8");
+		static_assert(EVENTS >= 2 && EVENTS <= 128 && (EVENTS & (EVENTS - 1)) == 0,
+			"sched: EVENTS must be a power of 2");
+
+	public:
+		typedef void (*func_type)();
+
+	private:
+		struct task_t {
+			func_type	func;
+			uint16_t	period;	///< 周期（0 なら１回）
+			uint16_t	next;	///< 次のティック
+		};
+
+		static task_t				task_[TASKS];
+		static uint8_t				armed_;		///< 時間で呼ぶタスク（ビット）
+		static volatile uint16_t	tick_;
+		static uint8_t				queue_[EVENTS];
+		static volatile uint8_t		put_;
+		static volatile uint8_t		get_;
+
+		static bool due_(const task_t& t, uint16_t tick) {
+			return static_cast<int16_t>(tick - t.next) >= 0;
+		}
+
+		static void call_(uint8_t id) {
+			auto f = task_[id].func;
+			if(f != nullptr) (*f)();
+		}
+
+		static bool drain_() {
+			bool ret = false;
+			while(get_ != put_) {
+				uint8_t g = get_;
+				uint8_t id = queue_[g];
+				get_ = (g + 1) & (EVENTS - 1);
+				if(id < TASKS) call_(id);
+				ret = true;
+			}
+			return ret;
+		}
+
+		// イベントも、時間の来たタスクも無い
+		static bool nothing_() {
+			if(get_ != put_) return false;
+			uint16_t tick = tick_;
+			for(uint8_t i = 0; i < TASKS; ++i) {
+				if((armed_ & (1 << i)) != 0 && due_(task_[i], tick)) return false;
+			}
+			return true;
+		}
+
+		static void arm_(uint8_t id, func_type f, uint16_t period, uint16_t delay) {
+			auto& t = task_[id];
+			t.func = f;
+			t.period = period;
+			t.next = tick_ + delay;
+			armed_ |= 1 << id;
+		}
+
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  ティックを進めるタスク（trb_io の TASK 用）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class tick_task {
+		public:
+			void operator() () { sched::itick(); }
+		};
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックを進める（タイマーの割り込みから呼ぶ）
+		*/
+		//-----------------------------------------------------------------//
+		static void itick() { ++tick_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックの取得
+			@return ティック
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t get_tick() { return tick_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  イベントで呼ぶタスクを設定（時間では呼ばない）
+			@param[in]	id		タスク id
+			@param[in]	f		関数
+		*/
+		//-----------------------------------------------------------------//
+		static void set_event(uint8_t id, func_type f) {
+			if(id >= TASKS) return;
+			armed_ &= ~(1 << id);
+			task_[id].func = f;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  周期で呼ぶタスクを設定
+			@param[in]	id		タスク id
+			@param[in]	f		関数
+			@param[in]	period	周期（ティック、1 〜 32767）
+			@param[in]	phase	最初に呼ぶまでのティック（位相）
+		*/
+		//-----------------------------------------------------------------//
+		static void set_periodic(uint8_t id, func_type f, uint16_t period, uint16_t phase = 0) {
+			if(id >= TASKS || period == 0) return;
+			arm_(id, f, period, phase);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  １回だけ呼ぶタスクを設定（タスクの中から、再設定しても良い）
+			@param[in]	id		タスク id
+			@param[in]	f		関数
+			@param[in]	delay	呼ぶまでのティック（期限）
+		*/
+		//-----------------------------------------------------------------//
+		static void set_oneshot(uint8_t id, func_type f, uint16_t delay) {
+			if(id >= TASKS) return;
+			arm_(id, f, 0, delay);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  時間で呼ぶのを止める（イベントでは呼ぶ）
+			@param[in]	id		タスク id
+		*/
+		//-----------------------------------------------------------------//
+		static void cancel(uint8_t id) {
+			if(id >= TASKS) return;
+			armed_ &= ~(1 << id);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  イベントを置く（割り込みから呼ぶ）
+			@param[in]	id		タスク id
+			@return キューが一杯なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		static bool post(uint8_t id) {
+			uint8_t p = put_;
+			uint8_t n = (p + 1) & (EVENTS - 1);
+			if(n == get_) return false;
+			queue_[p] = id;
+			put_ = n;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  呼ぶべきタスクを呼ぶ（イベント、時間の来たタスク）@n
+					周期のタスクが遅れた場合、遅れた分は、まとめて１回にする
+			@return 何か呼んだ場合「true」
+		*/
+		//-----------------------------------------------------------------//
+		static bool service() {
+			bool ret = drain_();
+			for(uint8_t i = 0; i < TASKS; ++i) {
+				if((armed_ & (1 << i)) == 0) continue;
+				auto& t = task_[i];
+				uint16_t tick = tick_;
+				if(!due_(t, tick)) continue;
+				if(t.period != 0) {
+					do {
+						t.next += t.period;
+					} while(due_(t, tick));
+				} else {
+					armed_ &= ~(1 << i);
+				}
+				call_(i);
+				ret = true;
+				drain_();  // 周期のタスクの間でも、イベントを先に呼ぶ
+			}
+			return ret;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  呼ぶべきタスクが無い間、止まる（WAIT） @n
+					確認は割り込みを止めて行うので、その間の post、ティックも、@n
+					WAIT を起こす（io_wait_）
+		*/
+		//-----------------------------------------------------------------//
+		static void idle() {
+			device::io_wait_(nothing_);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  スケジューラーのループ（戻らない）
+		*/
+		//-----------------------------------------------------------------//
+		[[noreturn]] static void run() {
+			while(1) {
+				if(!service()) idle();
+			}
+		}
+	};
+
+	// スタティック実態定義
+	template <uint8_t TASKS, uint8_t EVENTS>
+	typename sched<TASKS, EVENTS>::task_t sched<TASKS, EVENTS>::task_[TASKS];
+
+	template <uint8_t TASKS, uint8_t EVENTS>
+	uint8_t sched<TASKS, EVENTS>::armed_ = 0;
+
+	template <uint8_t TASKS, uint8_t EVENTS>
+	volatile uint16_t sched<TASKS, EVENTS>::tick_ = 0;
+
+	template <uint8_t TASKS, uint8_t EVENTS>
+	uint8_t sched<TASKS, EVENTS>::queue_[EVENTS];
+
+	template <uint8_t TASKS, uint8_t EVENTS>
+	volatile uint8_t sched<TASKS, EVENTS>::put_ = 0;
+
+	template <uint8_t TASKS, uint8_t EVENTS>
+	volatile uint8_t sched<TASKS, EVENTS>::get_ = 0;
+}
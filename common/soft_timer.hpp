@@ -0,0 +1,265 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ソフトウェア・タイマー（ティックの仮想タイマーと、タイムアウト）@n
+			・タイマー RB の割り込みで、ティックを進める（tick_task を trb_io @n
+			　の TASK にする、sched と一緒に使う場合は、TASK に sched の @n
+			　tick_task を渡す）@n
+			・deadline、has_elapsed で、ティックの期限を作って、比べる @n
+			・仮想タイマー（最大 16）は、期限が来たら、service（メイン側）で、@n
+			　コールバックを呼ぶ（周期を設定すると、繰り返す）@n
+			・timeout は、ドライバーのタイムアウト（ミリ秒）用、pause は、@n
+			　ティックより長い場合、WAIT 命令で、次の割り込みまで止まる @n
+			@verbatim
+			typedef utils::soft_timer<1000, 8> TIMER;
+			typedef device::trb_io<TIMER::tick_task, uint8_t> TIMER_B;
+
+			timer_b_.start(1000, 1);
+			TIMER::start(0, TIMER::msec(250), blink_, TIMER::msec(250));
+			auto t = TIMER::deadline(TIMER::msec(20));
+			while(!TIMER::has_elapsed(t)) { ... }
+			while(1) { TIMER::service(); ... }
+			@endverbatim
+			※期限は、32767 ティックまで
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include "common/io_utils.hpp"
+#include "common/intr_utils.hpp"
+#include "common/delay.hpp"
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ソフトウェア・タイマー・クラス
+		@param[in]	FREQ	ティックの周波数（タイマーの start と同じ）
+		@param[in]	NUM		仮想タイマーの数（最大 16）
+		@param[in]	TASK	ティック毎に、一緒に呼ぶタスク
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint16_t FREQ, uint8_t NUM, class TASK = null_task>
+	class soft_timer {
+
+		static_assert(FREQ > 0 && FREQ <= 10000, "soft_timer: FREQ must be 1 to 10000 Hz");
+		static_assert(NUM > 0 && NUM <= 16, "soft_timer: NUM must be 1 to 16");
+
+	public:
+		typedef void (*func_type)();
+
+	private:
+		struct timer_t {
+			func_type	func;
+			uint16_t	period;	///< 周期（0 なら１回）
+			uint16_t	next;
+		};
+
+		static timer_t				timer_[NUM];
+		static uint16_t				active_;	///< 動いているタイマー（ビット）
+		static volatile uint16_t	tick_;
+
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  ティックを進めるタスク（trb_io の TASK 用）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class tick_task {
+		public:
+			void operator() () {
+				soft_timer::itick();
+				TASK()();
+			}
+		};
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ミリ秒を、ティックに変換（切り上げ）
+			@param[in]	ms	ミリ秒
+			@return ティック
+		*/
+		//-----------------------------------------------------------------//
+		static constexpr uint16_t msec(uint16_t ms) {
+			return static_cast<uint16_t>((static_cast<uint32_t>(ms) * FREQ + 999) / 1000);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックを進める（タイマーの割り込みから呼ぶ）
+		*/
+		//-----------------------------------------------------------------//
+		static void itick() { ++tick_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックの取得
+			@return ティック
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t get_tick() { return tick_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  期限を作る
+			@param[in]	ticks	今からのティック
+			@return 期限
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t deadline(uint16_t ticks) { return tick_ + ticks; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  期限が過ぎたか
+			@param[in]	t	期限（deadline）
+			@return 過ぎたら「true」
+		*/
+		//-----------------------------------------------------------------//
+		static bool has_elapsed(uint16_t t) {
+			return static_cast<int16_t>(tick_ - t) >= 0;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックの待ち（WAIT 命令で止まる）
+			@param[in]	ticks	ティック
+		*/
+		//-----------------------------------------------------------------//
+		static void sleep(uint16_t ticks) {
+			auto t = deadline(ticks);
+			device::io_wait_([=] { return !has_elapsed(t); });
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  仮想タイマーの開始（動いている場合は、やり直す）
+			@param[in]	id		タイマー id
+			@param[in]	ticks	最初の期限までのティック
+			@param[in]	f		コールバック（nullptr なら、is_active で見る）
+			@param[in]	period	周期（0 なら１回）
+		*/
+		//-----------------------------------------------------------------//
+		static void start(uint8_t id, uint16_t ticks, func_type f = nullptr, uint16_t period = 0) {
+			if(id >= NUM) return;
+			auto& t = timer_[id];
+			t.func = f;
+			t.period = period;
+			t.next = tick_ + ticks;
+			active_ |= 1 << id;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  仮想タイマーの停止
+			@param[in]	id		タイマー id
+		*/
+		//-----------------------------------------------------------------//
+		static void stop(uint8_t id) {
+			if(id >= NUM) return;
+			active_ &= ~(1 << id);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  仮想タイマーが動いているか（１回のタイマーは、期限の後の @n
+					service で止まる）
+			@param[in]	id		タイマー id
+			@return 動いていれば「true」
+		*/
+		//-----------------------------------------------------------------//
+		static bool is_active(uint8_t id) {
+			if(id >= NUM) return false;
+			return (active_ & (1 << id)) != 0;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  期限の来た仮想タイマーの、コールバックを呼ぶ（メイン側）@n
+					周期のタイマーが遅れた場合、遅れた分は、まとめて１回にする
+			@return 呼んだ数
+		*/
+		//-----------------------------------------------------------------//
+		static uint8_t service() {
+			uint8_t n = 0;
+			for(uint8_t i = 0; i < NUM; ++i) {
+				if((active_ & (1 << i)) == 0) continue;
+				auto& t = timer_[i];
+				if(!has_elapsed(t.next)) continue;
+				if(t.period != 0) {
+					do {
+						t.next += t.period;
+					} while(has_elapsed(t.next));
+				} else {
+					active_ &= ~(1 << i);
+				}
+				if(t.func != nullptr) {
+					(*t.func)();
+					++n;
+				}
+			}
+			return n;
+		}
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  タイムアウト（ドライバーの TIMEOUT 用、delay_timeout と同じ形）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class timeout {
+			uint16_t	t_;
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief  コンストラクター（開始）
+				@param[in]	ms	タイムアウト（ミリ秒）
+			*/
+			//-------------------------------------------------------------//
+			explicit timeout(uint16_t ms) : t_(deadline(msec(ms))) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief  時間が過ぎたか
+				@return 過ぎたら「true」
+			*/
+			//-------------------------------------------------------------//
+			bool expired() const { return has_elapsed(t_); }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief  次に調べるまでの待ち
+				@param[in]	us	待ち（マイクロ秒）
+			*/
+			//-------------------------------------------------------------//
+			void pause(uint16_t us) {
+				if(static_cast<uint32_t>(us) * FREQ >= 1000000) device::io_wait_();
+				else delay::micro_second(us);
+			}
+		};
+	};
+
+	// スタティック実態定義
+	template <uint16_t FREQ, uint8_t NUM, class TASK>
+	typename soft_timer<FREQ, NUM, TASK>::timer_t soft_timer<FREQ, NUM, TASK>::timer_[NUM];
+
+	template <uint16_t FREQ, uint8_t NUM, class TASK>
+	uint16_t soft_timer<FREQ, NUM, TASK>::active_ = 0;
+
+	template <uint16_t FREQ, uint8_t NUM, class TASK>
+	volatile uint16_t soft_timer<FREQ, NUM, TASK>::tick_ = 0;
+}
@@ -109,7 +109,7 @@ namespace device {
 			MOSI::DIR = 1;
 			SPCK::DIR = 1;
 
-			uint32_t n = F_CLK / speed;
+			uint32_t n = speed != 0 ? F_CLK / speed : 0;  // 0 なら最大
 			if(n > 511) n = 511;
 			delay_ = n / 2;
 
@@ -120,7 +120,7 @@ namespace device {
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  開始
-			@param[in]	speed	通信速度
+			@param[in]	speed	通信速度（0 なら最大）
 			@return エラー（速度設定範囲外）なら「false」
 		*/
 		//-----------------------------------------------------------------//
@@ -138,7 +138,7 @@ namespace device {
 			}
 			SPCK::P = 0;
 
-			uint32_t n = F_CLK / speed;
+			uint32_t n = speed != 0 ? F_CLK / speed : 0;  // 0 なら最大
 			if(n > 511) n = 511;
 			delay_ = n / 2;
 
@@ -0,0 +1,273 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	UART0 クロック同期形 SPI I/O 制御 @n
+			・spi_io（ソフト SPI）と同じ xchg、send、recv を、UART0 の @n
+			　クロック同期形シリアル I/O モードで行う @n
+			・SPCK は CLK0（P1_6）、MOSI は TXD0（P1_4、P4_2、P4_6）、@n
+			　MISO は RXD0（P1_4、P1_5、P4_6）に限られる @n
+			・spi_select で、ピン配置が合えば spi_uart_io、合わなければ @n
+			　spi_io を選ぶ @n
+			・UART0 を使うので、uart_io（UART0）とは同時に使えない
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "M120AN/system.hpp"
+#include "M120AN/uart.hpp"
+#include "common/port_map.hpp"
+#include "common/spi_io.hpp"
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  UART0 のピン配置
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct spi_uart_map {
+
+		static constexpr bool is_null(uint8_t no) { return no == 0xff; }
+
+		static constexpr bool is_clk(uint8_t no, uint8_t bit) {
+			return no == 1 && bit == 6;
+		}
+
+		static constexpr bool is_txd(uint8_t no, uint8_t bit) {
+			return (no == 1 && bit == 4) || (no == 4 && bit == 2) || (no == 4 && bit == 6);
+		}
+
+		static constexpr bool is_rxd(uint8_t no, uint8_t bit) {
+			return is_null(no) || (no == 1 && bit == 4) || (no == 1 && bit == 5) || (no == 4 && bit == 6);
+		}
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  UART0 に割り当てられるか
+			@param[in]	MISO	MISO ポート（NULL_PORT なら送信のみ）
+			@param[in]	MOSI	MOSI ポート
+			@param[in]	SPCK	SPCK ポート
+			@return 割り当てられるなら「true」
+		*/
+		//-----------------------------------------------------------------//
+		template <class MISO, class MOSI, class SPCK>
+		static constexpr bool probe() {
+			return is_clk(SPCK::port_no, SPCK::port_bit)
+				&& is_txd(MOSI::port_no, MOSI::port_bit)
+				&& is_rxd(MISO::port_no, MISO::port_bit)
+				&& (MISO::port_no != MOSI::port_no || MISO::port_bit != MOSI::port_bit);
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  UART0 クロック同期形 SPI 制御クラス @n
+				転送クロックは、F_CLK / 2 ～ F_CLK / 16384 @n
+				CKPOL = 0（立下りで送信、立ち上がりで受信、待機時 High）で、@n
+				spi_io の波形（SPI モード３）と同じ
+		@param[in]	MISO	Master In Slave Out（RXD0 又は NULL_PORT）
+		@param[in]	MOSI	Master Out Slave In（TXD0）
+		@param[in]	SPCK	Clock（CLK0）
+		@param[in]	MODE	soft_spi_mode（spi_io と同じく、波形は共通）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class MISO, class MOSI, class SPCK, soft_spi_mode MODE>
+	class spi_uart_io {
+
+		static_assert(spi_uart_map::probe<MISO, MOSI, SPCK>(),
+			"spi_uart_io: SPCK must be P1_6, MOSI: P1_4/P4_2/P4_6, MISO: P1_4/P1_5/P4_6");
+
+		typedef UART0 UART;
+
+		void map_() {
+			utils::PORT_MAP(utils::port_map::P16::CLK0);
+			if(MOSI::port_no == 1) {
+				utils::PORT_MAP(utils::port_map::P14::TXD0);
+			} else if(MOSI::port_bit == 2) {
+				utils::PORT_MAP(utils::port_map::P42::TXD0);
+			} else {
+				utils::PORT_MAP(utils::port_map::P46::TXD0);
+			}
+			if(MISO::port_no == 1) {
+				if(MISO::port_bit == 4) utils::PORT_MAP(utils::port_map::P14::RXD0);
+				else utils::PORT_MAP(utils::port_map::P15::RXD0);
+			} else if(MISO::port_no == 4) {
+				utils::PORT_MAP(utils::port_map::P46::RXD0);
+			}
+		}
+
+		// 送信の終了を待って、受信を有効にする
+		void flush_() {
+			while(UART::UC0.TXEPT() == 0) ;
+			if(UART::UC1.RI()) {
+				volatile uint16_t tmp = UART::URB();
+			}
+			UART::UC1 = UART::UC1.TE.b() | UART::UC1.RE.b();
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		spi_uart_io() { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  設定可能な最大速度を返す
+			@return 速度
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_max_speed() const { return F_CLK / 2; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  開始
+			@param[in]	speed	通信速度（0 なら最大、設定できる最も近い遅い速度になる）
+			@return エラー（速度設定範囲外）なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start(uint32_t speed)
+		{
+			// 転送クロック：f1、f8、f32 / (2 * (UBRG + 1))
+			static const uint8_t shift_[] = { 0, 3, 5 };
+			uint8_t cks = 0;
+			uint32_t brr = 0;
+			if(speed != 0) {
+				for(cks = 0; cks < 3; ++cks) {
+					uint32_t fj = F_CLK >> shift_[cks];
+					brr = (fj + speed * 2 - 1) / (speed * 2);
+					if(brr <= 256) break;
+				}
+				if(cks >= 3) {
+					cks = 2;
+					brr = 256;
+				}
+				if(brr) --brr;
+			}
+
+			MSTCR.MSTUART = 0;  // モジュールスタンバイ解除
+			UART::UC1 = 0x00;
+			UART::UIR = 0x00;
+			map_();
+			MISO::PU = 1;
+			// クロック同期形、内部クロック
+			UART::UMR = UART::UMR.SMD.b(0b001) | UART::UMR.CKDIR.b(0);
+			// MSB ファースト、CKPOL = 0
+			UART::UC0 = UART::UC0.CLK.b(cks) | UART::UC0.UFORM.b();
+			UART::UBRG = static_cast<uint8_t>(brr);
+			UART::UC1 = UART::UC1.TE.b() | UART::UC1.RE.b();
+
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ＳＤカード用設定を有効にする
+			@param[in]	speed	通信速度
+			@return エラー（速度設定範囲外）なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start_sdc(uint32_t speed) { return start(speed); }
+
+
+		//----------------------------------------------------------------//
+		/*!
+			@brief	リード・ライト
+			@param[in]	data	書き込みデータ
+			@return 読み出しデータ
+		*/
+		//----------------------------------------------------------------//
+		uint8_t xchg(uint8_t data = 0xff)
+		{
+			UART::UTBL = data;
+			while(UART::UC1.RI() == 0) ;
+			return UART::URB.URBL();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  シリアル送信 @n
+					受信を止めて、送信バッファが空く度に書く（バイト間の隙間が無い）
+			@param[in]	src	送信ソース
+			@param[in]	cnt	送信サイズ
+		*/
+		//-----------------------------------------------------------------//
+		void send(const void* src, uint32_t size)
+		{
+			auto ptr = static_cast<const uint8_t*>(src);
+			auto end = ptr + size;
+			UART::UC1 = UART::UC1.TE.b();
+			while(ptr < end) {
+				while(UART::UC1.TI() == 0) ;
+				UART::UTBL = *ptr;
+				++ptr;
+			}
+			flush_();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  シリアル受信 @n
+					ダミー（0xFF）を送って受信する
+			@param[out]	dst	受信先
+			@param[in]	cnt	受信サイズ
+		*/
+		//-----------------------------------------------------------------//
+		void recv(void* dst, uint32_t size)
+		{
+			uint8_t* ptr = static_cast<uint8_t*>(dst);
+			uint32_t pos = 0;
+			while(pos < size) {
+				*ptr = xchg();
+				++ptr;
+				++pos;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  UART0 を無効にして、パワーダウンする
+			@param[in]	power パワーダウンをしない場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		void destroy(bool power = true)
+		{
+			UART::UC1 = 0x00;
+			utils::PORT_MAP(utils::port_map::P16::PORT);
+			MISO::PU = 0;
+			if(power) MSTCR.MSTUART = 1;
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  SPI 制御クラスの選択 @n
+				ピン配置が UART0 に合えば spi_uart_io、合わなければ spi_io
+		@param[in]	MISO	Master In Slave Out
+		@param[in]	MOSI	Master Out Slave In
+		@param[in]	SPCK	Clock
+		@param[in]	MODE	soft_spi_mode
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class MISO, class MOSI, class SPCK, soft_spi_mode MODE, bool HARD = spi_uart_map::probe<MISO, MOSI, SPCK>()>
+	struct spi_select {
+		typedef spi_io<MISO, MOSI, SPCK, MODE> type;
+	};
+
+	template <class MISO, class MOSI, class SPCK, soft_spi_mode MODE>
+	struct spi_select<MISO, MOSI, SPCK, MODE, true> {
+		typedef spi_uart_io<MISO, MOSI, SPCK, MODE> type;
+	};
+}
@@ -21,6 +21,16 @@ _start:
 	fset u
 	ldc #_usp_init,sp
 
+	/* スタックのペイント（bss の後ろから、割り込みスタックの上まで） */
+	/* ※ ram_info.hpp の PAINT と同じ値にする事 */
+	.extern __bssend
+	mov.w #0x5AA5,r0
+	mov.w #__bssend,a1
+	mov.w #_isp_init,r3
+	sub.w a1,r3
+	shl.w #-1,r3
+	sstr.w
+
 	/* 可変ベクターテーブルアドレス設定 */
 	.extern _variable_vectors_
 	ldc #_variable_vectors_,intbl
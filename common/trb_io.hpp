@@ -61,16 +61,13 @@ namespace device {
 		}
 
 		uint16_t	limit_;
+		uint8_t		shift_;
 
 	private:
 
 		// ※同期が必要なら、実装する
 		void sleep_() const {
-			asm("nop");
-		}
-
-		CNT get_timer_() const {
-			return TRBPRE() | (TRBPR() << 8);
+			io_sleep_();
 		}
 
 	public:
@@ -80,7 +77,7 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 ///		__attribute__ ((section (".text"))) 
-		trb_io() : limit_(0) { }
+		trb_io() : limit_(0), shift_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -110,6 +107,7 @@ namespace device {
 			}
 			if(tn) --tn;
 			if(tn == 0) return false;
+			shift_ = div < 4 ? div : div + 1;
 
 			static const uint8_t tbl[8] = {
 				0b000, 0b011, 0b100, 0b001, 0b101, 0b110, 0b111
@@ -149,13 +147,14 @@ namespace device {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  タイマー同期
+			@brief  タイマー同期 @n
+					割り込みを使う場合、WAIT 命令で、次の割り込みまで止まる
 		*/
 		//-----------------------------------------------------------------//
 		void sync() const {
 			if(TRBIR.TRBIE()) {
-				volatile CNT n = count_;
-				while(n == count_) sleep_();
+				CNT n = count_;
+				io_wait_([=] { return n == count_; });
 			} else {
 				while(TRBIR.TRBIF() == 0) sleep_();
 				TRBIR.TRBIF = 0;
@@ -182,6 +181,15 @@ namespace device {
 		uint16_t get_limit() const { return limit_; }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウント・クロックの分周の取得（F_CLK >> shift）
+			@return 分周（シフト数）
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_shift() const { return shift_; }
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  タイマー値の取得（クロック毎にダウンカウントされる値）
@@ -189,12 +197,16 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		uint16_t get_timer() const {
-			uint16_t n = get_timer_();
-			// 桁上がりを考慮して、連続して同じ値が読まれるまでループする。
-			while(n != get_timer_()) {
-				n = get_timer_();
+			// 上位が、下位を読む前後で同じになるまでループする（桁下がりを考慮）
+			uint8_t h = TRBPR();
+			uint8_t l;
+			while(1) {
+				l = TRBPRE();
+				uint8_t n = TRBPR();
+				if(n == h) break;
+				h = n;
 			}
-			return n;
+			return l | (h << 8);
 		}
 	};
 
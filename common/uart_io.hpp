@@ -104,7 +104,7 @@ namespace device {
 private:
 		// ※同期が必要なら、実装する
 		void sleep_() const {
-			asm("nop");
+			io_sleep_();
 		}
 
 		void send_restart_() {
@@ -260,6 +260,16 @@ private:
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	UART 文字出力（CRLF 変換無し） @n
+					※バイナリー・データ送信用
+			@param[in]	ch	文字コード
+		 */
+		//-----------------------------------------------------------------//
+		void putch_raw(char ch) { putch_(ch); }
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	UART 文字列出力
@@ -10,7 +10,11 @@
 //=====================================================================//
 #include <unistd.h>
 
+#ifdef IO_HOST
+#define INTERRUPT_FUNC
+#else
 #define INTERRUPT_FUNC __attribute__ ((interrupt))
+#endif
 
 #ifdef __cplusplus
 extern "C" {
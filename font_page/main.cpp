@@ -0,0 +1,70 @@
+//=====================================================================//
+/*!	@file
+	@brief	ページ・レイアウト用フォント変換ツール @n
+			font6x12 の ASCII（0x20 〜 0x7F）を、縦８ドット／バイト（LSB が上）@n
+			のカラム並びに変換して、「common/font6x12_page.cpp」を出力する @n
+			グリフ毎に、ページ０のカラム（WIDTH バイト）、ページ１のカラム ...
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include "common/font6x12_page.hpp"
+#include "common/font6x12.cpp"
+
+namespace {
+
+	typedef graphics::font6x12 FONT;
+	typedef graphics::font6x12_page PFONT;
+
+	bool get_bit_(const uint8_t* src, uint16_t idx)
+	{
+		return (src[idx >> 3] >> (idx & 7)) & 1;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::printf("//=====================================================================//\n");
+	std::printf("/*!\t@file\n");
+	std::printf("\t@brief\t６×１２フォント、ページ・レイアウト（font_page で生成）\n");
+	std::printf("    @author 平松邦仁 (hira@rvf-rc45.net)\n");
+	std::printf("\t@copyright\tCopyright (C) 2026 Kunihito Hiramatsu @n\n");
+	std::printf("\t\t\t\tReleased under the MIT license @n\n");
+	std::printf("\t\t\t\thttps://github.com/hirakuni45/R8C/blob/master/LICENSE\n");
+	std::printf("*/\n");
+	std::printf("//=====================================================================//\n");
+	std::printf("#include \"common/font6x12_page.hpp\"\n");
+	std::printf("\n");
+	std::printf("namespace graphics {\n");
+	std::printf("\n");
+	std::printf("\tconst uint8_t font6x12_page::page_bitmap_[] = {\n");
+
+	for(uint16_t code = PFONT::FIRST; code <= PFONT::LAST; ++code) {
+		const uint8_t* src = FONT::get(code);
+		std::printf("\t\t");
+		for(uint8_t pg = 0; pg < PFONT::PAGES; ++pg) {
+			for(uint8_t x = 0; x < FONT::WIDTH; ++x) {
+				uint8_t d = 0;
+				for(uint8_t b = 0; b < 8; ++b) {
+					uint8_t y = pg * 8 + b;
+					if(y >= FONT::HEIGHT) break;
+					if(get_bit_(src, y * FONT::WIDTH + x)) d |= 1 << b;
+				}
+				std::printf("0x%02X,", d);
+			}
+		}
+		if(code >= 0x21 && code < 0x7F) {
+			std::printf("  // '%c'\n", static_cast<char>(code));
+		} else {
+			std::printf("  // 0x%02X\n", code);
+		}
+	}
+
+	std::printf("\t};\n");
+	std::printf("}\n");
+	return 0;
+}
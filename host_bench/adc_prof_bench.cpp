@@ -0,0 +1,74 @@
+//=====================================================================//
+/*!	@file
+	@brief	prof（PROF_SCOPE）を、ホスト・シミュレーター（host_io）で検査 @n
+			・ADC_sample/main.cpp を、PROF_ENABLE でコンパイルしてリンク（Makefile）@n
+			・「?」を送って、UART に出た表（PROF 〜 END）を読み、回数と、@n
+			　A/D 変換と表示の区間（id 3）の時間が、UART の送信時間と合うかを検査
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include "host_io.hpp"
+
+int sample_main(int argc, char* argv[]);
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+
+	io.adc.set(0, 512);
+	io.adc.set(1, 1023);
+	io.at(io.msec(1050), [&]() { io.uart.input("?"); });
+
+	bool stop = io.run([]() { sample_main(0, nullptr); }, io.msec(1200));
+
+	const auto& s = io.uart.get_send();
+	static const char* name[] = { "TIMER_RB_intr", "UART0_TX_intr", "UART0_RX_intr", "A/D, format" };
+	uint32_t clk = 0, shift = 0, ovh = 0, num = 0;
+	uint32_t tab[4][5];
+	uint32_t lines = 0;
+	auto pos = s.find("PROF ");
+	if(pos != std::string::npos) {
+		const char* p = s.c_str() + pos;
+		if(std::sscanf(p, "PROF %x %x %x %x", &clk, &shift, &ovh, &num) == 4) {
+			while((p = std::strchr(p, '\n')) != nullptr && lines < 4) {
+				++p;
+				auto* t = tab[lines];
+				if(std::sscanf(p, "P %x %x %x %x %x", &t[0], &t[1], &t[2], &t[3], &t[4]) != 5) break;
+				++lines;
+			}
+		}
+	}
+
+	bool ok = stop && clk == F_CLK && shift == 3 && num == 4 && lines == 4
+		&& s.find("END", pos) != std::string::npos;
+	std::printf("ADC_sample (PROF_ENABLE)  %.1f s\n", static_cast<double>(io.now()) / F_CLK);
+	if(ok) {
+		std::printf("  tick %u cycles, overhead %u cycles\n", 1 << shift, ovh << shift);
+		for(uint32_t i = 0; i < lines; ++i) {
+			auto* t = tab[i];
+			double avg = t[1] ? static_cast<double>(t[4]) / t[1] : 0.0;
+			std::printf("  %u %-14s %5u  min %7u, avg %9.1f, max %7u cycles\n",
+				t[0], name[i], t[1], t[2] << shift, avg * (1 << shift), t[3] << shift);
+			if(t[0] != i || (t[1] != 0 && (t[2] > t[3] || t[4] < t[2] * t[1] || t[4] > t[3] * t[1]))) {
+				ok = false;
+			}
+		}
+		// タイマー（60Hz）は 1.05 秒で 63 回、「?」の受信が 1 回、表示は 0.5 秒毎に 2 回
+		if(tab[0][1] < 62 || tab[0][1] > 64 || tab[2][1] != 1 || tab[3][1] != 2 || tab[1][1] == 0) {
+			ok = false;
+		}
+		// ２行（55 文字）の表示は、送信バッファ（16）を超えた分の送信を待つ
+		uint32_t frame = io.uart.frame();
+		uint32_t lo = (55 - 16 - 1) * frame;
+		uint32_t hi = 55 * frame + io.usec(200);
+		std::printf("  id 3 expect %u .. %u cycles\n", lo, hi);
+		if((tab[3][2] << shift) < lo || (tab[3][3] << shift) > hi) ok = false;
+	}
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+//=====================================================================//
+/*!	@file
+	@brief	ADC_sample を、ホスト・シミュレーター（host_io）で動かす @n
+			・ADC_sample/main.cpp を、変更無しでリンクする（Makefile）@n
+			・AN0、AN1 に値を与え、タイマー RB（60Hz）の 30 フレーム毎の @n
+			　A/D 変換（繰り返し掃引）の表示と、UART のエコーを検査
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <chrono>
+#include "host_io.hpp"
+
+int sample_main(int argc, char* argv[]);
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+
+	io.adc.set(0, 512);
+	io.adc.set(1, 1023);
+	io.at(io.msec(700), [&]() { io.adc.set(0, 100); });
+	io.at(io.msec(200), [&]() { io.uart.input("R8C"); });
+
+	auto st = std::chrono::steady_clock::now();
+	bool stop = io.run([]() { sample_main(0, nullptr); }, io.msec(1100));
+	auto et = std::chrono::steady_clock::now();
+	double host = std::chrono::duration<double>(et - st).count();
+	double sim = static_cast<double>(io.now()) / F_CLK;
+
+	const auto& s = io.uart.get_send();
+	static const char* expect[] = {
+		"Start R8C ADC sample\r\n",
+		"(    0) CH0: 1.65[V], 512\r\n",
+		"        CH1: 3.30[V], 1023\r\n",
+		"R8C",
+		"(    1) CH0: 0.32[V], 100\r\n",
+	};
+	bool ok = stop;
+	for(auto e : expect) {
+		if(s.find(e) == std::string::npos) ok = false;
+	}
+
+	std::printf("ADC_sample  %.1f s, host %.3f s (x%.0f)\n", sim, host, sim / host);
+	std::printf("  | ");
+	for(char ch : s) {
+		if(ch == '\n') std::printf("\n  | ");
+		else if(ch != '\r') std::putchar(ch);
+	}
+	std::printf("\n  A/D %u sweeps, %.2f us/sweep\n", io.adc.count,
+		static_cast<double>(device::host_adc::CONV * 2) * 1e6 / F_CLK);
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+//=====================================================================//
+/*!	@file
+	@brief	basic_arith::analize と arith_code::run の比較ベンチマーク @n
+			・変数を含む数式を、毎回テキストから解析する場合と、@n
+			　一度コンパイルしたコードを評価する場合の処理時間
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include "common/basic_arith.hpp"
+#include "common/arith_code.hpp"
+
+namespace {
+
+	typedef utils::basic_arith<int32_t> ARITH;
+	typedef utils::arith_code<int32_t> CODE;
+
+	struct formula_t {
+		const char*	code;	///< arith_code 用（変数 x）
+		const char*	text;	///< analize 用（x を %d で置換）
+	};
+
+	const formula_t formula_[] = {
+		{ "x*3/4+12",            "%d*3/4+12" },
+		{ "(x - 512) * 25 // 7", "(%d - 512) * 25 // 7" },
+		{ "-x + (x << 2) & 255", "-%d + (%d << 2) & 255" },
+	};
+
+	const char* const sym_[] = { "x" };
+
+	const int32_t loop_ = 1000000;
+}
+
+
+int main(int argc, char* argv[])
+{
+	int ret = 0;
+	for(const auto& f : formula_) {
+		CODE code;
+		if(!code.compile(f.code, sym_, 1)) {
+			std::printf("Compile error: '%s' (%04X)\n", f.code, code.get_error()());
+			return 1;
+		}
+
+		ARITH arith;
+		char tmp[64];
+		int32_t sum0 = 0;
+		auto t0 = std::chrono::steady_clock::now();
+		for(int32_t x = 0; x < loop_; ++x) {
+			std::snprintf(tmp, sizeof(tmp), f.text, x & 1023, x & 1023);
+			arith.analize(tmp);
+			sum0 += arith.get();
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		for(int32_t x = 0; x < loop_; ++x) {
+			std::snprintf(tmp, sizeof(tmp), f.text, x & 1023, x & 1023);
+		}
+		auto t2 = std::chrono::steady_clock::now();
+		int32_t sum1 = 0;
+		for(int32_t x = 0; x < loop_; ++x) {
+			int32_t var = x & 1023;
+			int32_t ans;
+			code.run(&var, ans);
+			sum1 += ans;
+		}
+		auto t3 = std::chrono::steady_clock::now();
+
+		// 結果の一致を確認
+		int32_t mismatch = 0;
+		for(int32_t x = 0; x < 1024; ++x) {
+			std::snprintf(tmp, sizeof(tmp), f.text, x, x);
+			arith.analize(tmp);
+			int32_t ans;
+			code.run(&x, ans);
+			if(ans != arith.get()) ++mismatch;
+		}
+
+		auto ns = [](std::chrono::steady_clock::duration d) {
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) / loop_;
+		};
+		double an = ns(t1 - t0) - ns(t2 - t1);
+		double rn = ns(t3 - t2);
+		std::printf("'%s': code %u bytes, %u const\n", f.code, code.get_code_size(), code.get_const_num());
+		std::printf("  analize: %7.1f ns/eval, run: %6.1f ns/eval, x%.1f, mismatch: %d%s\n",
+			an, rn, rn > 0.0 ? an / rn : 0.0, mismatch, sum0 == sum1 ? "" : " (sum error)");
+		if(mismatch != 0 || sum0 != sum1) ret = 1;
+	}
+	return ret;
+}
@@ -0,0 +1,284 @@
+//=====================================================================//
+/*!	@file
+	@brief	I2C EEPROM 書き込み（chip::EEPROM、chip::EEPROM_ASYNC）のベンチマーク @n
+			・I2C EEPROM（24LC512 相当、64K バイト、128 バイト・ページ）を、@n
+			　トランザクション単位でモデル化（400 kHz、tWR 中はアドレスに NACK）@n
+			・１ms 毎のメインループで、ログ（16 バイト／100 ms）と、設定値の @n
+			　更新（数バイト）を行い、ループ１回の最大停止時間、ページ書き込み @n
+			　回数を、従来の write() + sync_write() と比べる @n
+			・ランダムな書き込み、読み出しを、シャドウ・メモリと比べて確認 @n
+			　（不一致があれば終了コード１）@n
+			「-t us」で、tWR を指定
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "chip/EEPROM.hpp"
+#include "chip/EEPROM_ASYNC.hpp"
+
+namespace {
+
+	double twr_us_ = 5000.0;	///< 書き込みサイクル時間
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C EEPROM モデル（iica_io と同じ send/recv）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class sim_i2c {
+		static const uint32_t SIZE = 65536;
+		static const uint32_t PAGE = 128;
+		static constexpr double BYTE_US = 9.0 * 1e6 / 400000.0;	///< 400 kHz の１バイト（ACK 含む）
+
+		uint8_t		mem_[SIZE];
+		uint16_t	ptr_;
+		double		ready_;
+
+		bool addr_(uint8_t address) {
+			now += BYTE_US * 2;  // スタート、アドレス、ストップ
+			if((address & 0x78) != 0x50) return false;
+			if(now < ready_) {
+				++nack;
+				now += nack_us;
+				return false;
+			}
+			return true;
+		}
+
+		void data_(const uint8_t* src, uint8_t num) {
+			if(num == 0) return;  // ACK ポーリング
+			// ページ内で折り返す
+			uint16_t top = ptr_ & ~(PAGE - 1);
+			for(uint8_t i = 0; i < num; ++i) {
+				mem_[top + ((ptr_ + i) & (PAGE - 1))] = src[i];
+			}
+			now += BYTE_US * num;
+			ready_ = now + twr_us_;
+			++pages;
+		}
+
+	public:
+		double		now;		///< 時間（us）
+		double		nack_us;	///< NACK 毎の追加時間（sync_write の待ち）
+		uint32_t	pages;		///< ページ書き込み回数
+		uint32_t	nack;
+
+		sim_i2c() : ptr_(0), ready_(0.0), now(0.0), nack_us(0.0), pages(0), nack(0) {
+			std::memset(mem_, 0xFF, SIZE);
+		}
+
+		uint8_t peek(uint16_t adr) const { return mem_[adr]; }
+
+		bool recv(uint8_t address, uint8_t* dst, uint8_t num) {
+			if(!addr_(address)) return false;
+			for(uint8_t i = 0; i < num; ++i) dst[i] = mem_[ptr_++];
+			now += BYTE_US * num;
+			return true;
+		}
+
+		bool send(uint8_t address, const uint8_t* src, uint8_t num) {
+			if(!addr_(address)) return false;
+			if(num < 2) return true;  // アドレスが無い
+			ptr_ = (src[0] << 8) | src[1];
+			now += BYTE_US * 2;
+			data_(src + 2, num - 2);
+			return true;
+		}
+
+		bool send(uint8_t address, uint8_t first, const uint8_t* src, uint8_t num) {
+			if(!addr_(address) || num < 1) return false;
+			ptr_ = (first << 8) | src[0];
+			now += BYTE_US * 2;
+			data_(src + 1, num - 1);
+			return true;
+		}
+
+		bool send(uint8_t address, uint8_t first, uint8_t second, const uint8_t* src, uint8_t num) {
+			if(!addr_(address)) return false;
+			ptr_ = (first << 8) | second;
+			now += BYTE_US * 2;
+			data_(src, num);
+			return true;
+		}
+	};
+
+	typedef chip::EEPROM<sim_i2c> EEPROM;
+	typedef chip::EEPROM_ASYNC<EEPROM, 16, 4> EEPROM_ASYNC;
+
+	uint32_t rand_ = 1;
+	uint32_t rand_next_() {
+		rand_ = rand_ * 1103515245 + 12345;
+		return rand_ >> 8;
+	}
+
+	static const uint32_t TICKS = 10000;		///< メインループ（1 ms）の回数
+	static const uint16_t LOG_ORG = 0x1000;
+	static const uint16_t SET_ORG = 0x0100;	///< 設定値（64 バイト）
+
+	struct result_t {
+		double		stall;	///< ループ１回の最大停止（us）
+		double		busy;	///< EEPROM 処理の合計（us）
+		uint32_t	pages;
+	};
+
+
+	// ログと設定値の更新（blocking: 従来の write + sync_write）
+	bool workload_(bool async, uint8_t hold, result_t& res, uint8_t* shadow)
+	{
+		sim_i2c i2c;
+		EEPROM eeprom(i2c);
+		eeprom.start(EEPROM::M64KB::ID0, 128);
+		EEPROM_ASYNC ew(eeprom);
+		ew.set_hold(hold);
+		if(!async) i2c.nack_us = 10.0;  // sync_write の delay
+
+		res = result_t();
+		rand_ = 3;
+		uint16_t log = LOG_ORG;
+		double t = 0.0;
+		bool ok = true;
+		for(uint32_t tick = 0; tick < TICKS; ++tick) {
+			t = tick * 1000.0;
+			if(i2c.now < t) i2c.now = t;
+			double start = i2c.now;
+			if(async) ok = ok && ew.service();
+
+			uint8_t rec[16];
+			uint16_t radr = 0;
+			uint16_t rlen = 0;
+			if((tick % 100) == 0) {  // ログ
+				for(uint8_t i = 0; i < sizeof(rec); ++i) rec[i] = rand_next_();
+				radr = log;
+				rlen = sizeof(rec);
+				log += sizeof(rec);
+			} else if((tick % 10) == 5) {  // 設定値（カウンター等）
+				for(uint8_t i = 0; i < 4; ++i) rec[i] = rand_next_();
+				radr = SET_ORG + (rand_next_() % 8) * 4;
+				rlen = 2 + rand_next_() % 3;
+			}
+			if(rlen > 0) {
+				std::memcpy(&shadow[radr], rec, rlen);
+				if(async) {
+					uint16_t n = ew.write(radr, rec, rlen);
+					while(n < rlen) {  // 空きが無い
+						ok = ok && ew.service();
+						n += ew.write(radr + n, rec + n, rlen - n);
+					}
+				} else {
+					ok = ok && eeprom.write(radr, rec, rlen);
+					ok = ok && eeprom.sync_write(radr);
+				}
+			}
+			double d = i2c.now - start;
+			res.busy += d;
+			if(d > res.stall) res.stall = d;
+		}
+		if(async) {
+			ew.flush();
+			while(!ew.is_idle()) {
+				i2c.now += 1000.0;
+				ok = ok && ew.service();
+			}
+		}
+		res.pages = i2c.pages;
+		for(uint32_t a = 0; a < 65536; ++a) {
+			if(i2c.peek(a) != shadow[a]) {
+				std::printf("  mismatch at %04X\n", a);
+				return false;
+			}
+		}
+		return ok;
+	}
+
+
+	// ランダムな書き込みと読み出し（書き込み待ちのデータを読めるか）
+	bool random_(uint32_t num)
+	{
+		sim_i2c i2c;
+		EEPROM eeprom(i2c);
+		eeprom.start(EEPROM::M64KB::ID0, 128);
+		EEPROM_ASYNC ew(eeprom);
+		ew.set_hold(3);
+		static uint8_t shadow[65536];
+		std::memset(shadow, 0xFF, sizeof(shadow));
+		rand_ = 11;
+		uint32_t hits = 0;
+		uint32_t retry = 0;
+		for(uint32_t n = 0; n < num; ++n) {
+			i2c.now += 100.0 + (rand_next_() % 2000);
+			if(!ew.service()) return false;
+			uint16_t adr = 0x0200 + rand_next_() % 256;
+			uint8_t len = 1 + rand_next_() % 24;
+			if(rand_next_() & 1) {
+				uint8_t tmp[24];
+				for(uint8_t i = 0; i < len; ++i) tmp[i] = rand_next_();
+				std::memcpy(&shadow[adr], tmp, len);
+				uint16_t w = ew.write(adr, tmp, len);
+				while(w < len) {
+					i2c.now += 500.0;
+					if(!ew.service()) return false;
+					w += ew.write(adr + w, tmp + w, len - w);
+				}
+			} else {
+				uint8_t tmp[24];
+				uint32_t pages = i2c.pages;
+				double t = i2c.now;
+				while(!ew.read(adr, tmp, len)) {
+					i2c.now += 500.0;
+					++retry;
+				}
+				if(i2c.now == t && i2c.pages == pages) ++hits;
+				if(std::memcmp(tmp, &shadow[adr], len) != 0) {
+					std::printf("  read mismatch at %04X (%u)\n", adr, len);
+					return false;
+				}
+			}
+		}
+		std::printf("random: %u ops, %u page writes, %u reads from cache only, %u read retries\n",
+			num, i2c.pages, hits, retry);
+		return true;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-t" && (i + 1) < argc) twr_us_ = std::atof(argv[++i]);
+		else {
+			std::printf("usage: %s [-t tWR_us]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	std::printf("I2C 400 kHz, tWR %.0f us, %u loops of 1 ms: log 16 bytes / 100 ms, settings 2-4 bytes / 10 ms\n\n",
+		twr_us_, TICKS);
+	std::printf("%-24s %12s %12s %8s\n", "", "max stall", "busy", "pages");
+	bool ok = true;
+	static uint8_t shadow[65536];
+	struct test_t { const char* name; bool async; uint8_t hold; };
+	static const test_t test[] = {
+		{ "write + sync_write",  false, 0 },
+		{ "EEPROM_ASYNC hold 0", true,  0 },
+		{ "EEPROM_ASYNC hold 20", true, 20 },
+		{ "EEPROM_ASYNC hold 100", true, 100 },
+	};
+	for(const auto& t : test) {
+		std::memset(shadow, 0xFF, sizeof(shadow));
+		result_t res;
+		bool f = workload_(t.async, t.hold, res, shadow);
+		std::printf("%-24s %9.1f us %9.1f ms %8u %s\n", t.name, res.stall, res.busy / 1000.0, res.pages,
+			f ? "" : "FAIL");
+		ok = ok && f;
+	}
+	std::printf("\n");
+	ok = ok && random_(20000);
+	return ok ? 0 : 1;
+}
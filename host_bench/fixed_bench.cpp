@@ -0,0 +1,116 @@
+//=====================================================================//
+/*!	@file
+	@brief	float と fixed_point (Q16.16) の数式評価、表示ベンチマーク @n
+			・arith_code による数式評価のスループット @n
+			・sformat による「%.4f」「%.4y」表示のスループット @n
+			※ホストはハードウェアー浮動小数点なので、R8C のソフト浮動小数点 @n
+			　との差は、ここでの比率より大きくなる
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cmath>
+#include <chrono>
+#include "common/fixed_point.hpp"
+#include "common/arith_code.hpp"
+#include "common/format.hpp"
+
+namespace {
+
+	typedef utils::q16_16 FIXED;
+	typedef utils::arith_code<float> FCODE;
+	typedef utils::arith_code<FIXED> QCODE;
+
+	const char* formula_[] = {
+		"x*3/4+12.5",
+		"(x - 512) * 0.125 + 3.75",
+		"x / 3.3 * 1.8 + 32",
+	};
+
+	const char* const sym_[] = { "x" };
+
+	const int32_t loop_ = 1000000;
+
+	typedef std::chrono::steady_clock CLOCK;
+
+	double ns_(CLOCK::duration d) {
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) / loop_;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	int ret = 0;
+	for(auto f : formula_) {
+		FCODE fc;
+		QCODE qc;
+		if(!fc.compile(f, sym_, 1) || !qc.compile(f, sym_, 1)) {
+			std::printf("Compile error: '%s'\n", f);
+			return 1;
+		}
+
+		auto t0 = CLOCK::now();
+		volatile float fsum = 0.0f;
+		for(int32_t i = 0; i < loop_; ++i) {
+			float x = static_cast<float>(i & 1023);
+			float ans = 0.0f;
+			fc.run(&x, ans);
+			fsum += ans;
+		}
+		auto t1 = CLOCK::now();
+		volatile int32_t qsum = 0;
+		for(int32_t i = 0; i < loop_; ++i) {
+			FIXED x(i & 1023);
+			FIXED ans;
+			qc.run(&x, ans);
+			qsum += ans.get_raw();
+		}
+		auto t2 = CLOCK::now();
+
+		// 誤差の確認
+		double err = 0.0;
+		for(int32_t i = 0; i < 1024; ++i) {
+			float x = static_cast<float>(i);
+			FIXED q(i);
+			float fa = 0.0f;
+			FIXED qa;
+			fc.run(&x, fa);
+			qc.run(&q, qa);
+			double d = std::fabs(static_cast<double>(qa.get_raw()) / 65536.0 - fa);
+			if(d > err) err = d;
+		}
+
+		std::printf("'%s'\n", f);
+		std::printf("  float: %5.1f ns/eval, fixed: %5.1f ns/eval, max error: %.6f\n",
+			ns_(t1 - t0), ns_(t2 - t1), err);
+		if(err > 0.01) ret = 1;
+	}
+
+	// 表示
+	{
+		char tmp[32];
+		auto t0 = CLOCK::now();
+		for(int32_t i = 0; i < loop_; ++i) {
+			float v = static_cast<float>(i & 1023) * 0.37f;
+			utils::sformat("%.4f", tmp, sizeof(tmp)) % v;
+		}
+		auto t1 = CLOCK::now();
+		for(int32_t i = 0; i < loop_; ++i) {
+			FIXED v = FIXED(i & 1023) * FIXED::from_decimal(0, 37, 100);
+			utils::sformat("%.4y", tmp, sizeof(tmp)) % v;
+		}
+		auto t2 = CLOCK::now();
+		std::printf("format '%%.4f' float: %5.1f ns, '%%.4y' fixed: %5.1f ns\n", ns_(t1 - t0), ns_(t2 - t1));
+
+		utils::sformat("%.4y", tmp, sizeof(tmp)) % FIXED::from_decimal(3, 14159, 100000);
+		std::printf("3.14159 -> '%s'\n", tmp);
+		utils::sformat("%.4y", tmp, sizeof(tmp)) % -FIXED::from_decimal(2, 5, 10);
+		std::printf("-2.5 -> '%s'\n", tmp);
+	}
+
+	return ret;
+}
@@ -0,0 +1,307 @@
+//=====================================================================//
+/*!	@file
+	@brief	flash_io（データ・フラッシュ書き換え）のレジスター・モデル・ベンチマーク @n
+			・IO_HOST で、flash_io のレジスター・アクセスをモデルに繋ぐ @n
+			・データ・フラッシュのシーケンサー（プログラム、ブロック消去、@n
+			　ステータス、バンク保護）と、CPU サイクルの時間をモデル化 @n
+			・スループットと、割り込み禁止区間の最大（最悪の割り込み遅延）を、@n
+			　従来の手順（バイト毎、又は全体を割り込み禁止）と比べる @n
+			「-p us」で、１バイトの書き込み時間、「-e ms」で、消去時間を指定
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#define IO_HOST
+#pragma GCC diagnostic ignored "-Wunused-variable"  // レジスター定義（サンプルの Makefile と同じ）
+#include "common/flash_io.hpp"
+
+namespace {
+
+	static const uint32_t F_CPU = F_CLK;
+	static const uint32_t ACCESS = 3;	///< レジスター・アクセスのサイクル（命令を含む）
+	static const uint32_t DI_EI = 4;	///< fclr/fset i + nop x 2
+
+	uint32_t prog_us_ = 75;
+	uint32_t erase_ms_ = 300;
+
+	// データ・フラッシュ・シーケンサー
+	struct flash_model {
+		uint8_t		mem[0x0800];
+		uint8_t		fmr0;
+		uint8_t		fmr1;
+		uint8_t		fst;
+		uint8_t		state;		// 0: 待機, 1: プログラム, 2: 消去
+		uint64_t	busy;		// 終了するサイクル
+		uint32_t	error;		// 手順の違反
+
+		flash_model() : fmr0(0), fmr1(0xC0), fst(0x80), state(0), busy(0), error(0) {
+			std::memset(mem, 0xFF, sizeof(mem));
+		}
+	};
+
+	flash_model flash_;
+
+	uint64_t now_ = 0;		///< サイクル
+	bool ie_ = true;
+	uint64_t di_at_ = 0;
+	uint64_t di_max_ = 0;
+
+	bool ready_() { return now_ >= flash_.busy; }
+
+	bool writable_(uint16_t ofs) {
+		if((flash_.fmr0 & 0x02) == 0) return false;
+		return ofs < 0x0400 ? (flash_.fmr1 & 0x40) == 0 : (flash_.fmr1 & 0x80) == 0;
+	}
+
+	void flash_cmd_(uint16_t ofs, uint8_t data)
+	{
+		if(!ready_()) {
+			++flash_.error;
+			return;
+		}
+		switch(flash_.state) {
+		case 1:  // プログラム
+			flash_.state = 0;
+			if(!writable_(ofs)) {
+				flash_.fst |= 0x10;
+				return;
+			}
+			if(flash_.mem[ofs] != 0xFF) ++flash_.error;
+			flash_.mem[ofs] &= data;
+			flash_.busy = now_ + static_cast<uint64_t>(prog_us_) * F_CPU / 1000000;
+			return;
+		case 2:  // ブロック消去
+			flash_.state = 0;
+			if(data != 0xd0 || !writable_(ofs)) {
+				flash_.fst |= 0x20;
+				return;
+			}
+			std::memset(&flash_.mem[ofs & 0x0400], 0xFF, 0x0400);
+			flash_.busy = now_ + static_cast<uint64_t>(erase_ms_) * F_CPU / 1000;
+			return;
+		default:
+			break;
+		}
+		if(data == 0x40) flash_.state = 1;
+		else if(data == 0x20) flash_.state = 2;
+		else if(data == 0x50) flash_.fst &= ~0x30;
+	}
+}
+
+
+extern "C" {
+	void di(void) {
+		now_ += DI_EI;
+		if(ie_) {
+			ie_ = false;
+			di_at_ = now_;
+		}
+	}
+
+	void ei(void) {
+		now_ += DI_EI;
+		if(!ie_) {
+			ie_ = true;
+			uint64_t t = now_ - di_at_;
+			if(t > di_max_) di_max_ = t;
+		}
+	}
+}
+
+
+namespace device {
+
+	void io_host_wr8(address_type adr, uint8_t data)
+	{
+		now_ += ACCESS;
+		if(adr >= 0x3000 && adr < 0x3800) flash_cmd_(adr - 0x3000, data);
+		else if(adr == 0x01AA) flash_.fmr0 = data;
+		else if(adr == 0x01AB) flash_.fmr1 = data;
+	}
+
+
+	uint8_t io_host_rd8(address_type adr)
+	{
+		now_ += ACCESS;
+		if(adr >= 0x3000 && adr < 0x3800) {
+			if(!ready_()) ++flash_.error;
+			return flash_.mem[adr - 0x3000];
+		} else if(adr == 0x01A9) {
+			return ready_() ? (flash_.fst | 0x80) : (flash_.fst & 0x7F);
+		} else if(adr == 0x01AA) {
+			return flash_.fmr0;
+		} else if(adr == 0x01AB) {
+			return flash_.fmr1;
+		}
+		return 0;
+	}
+
+
+	void io_host_wait() { now_ += 1; }  // nop
+
+	void io_host_delay(uint32_t cycles) { now_ += cycles; }
+}
+
+
+namespace {
+
+	using namespace device;
+
+	// 従来の flash_io::write(src, ofs, len)（全体を割り込み禁止）
+	bool legacy_write_(const uint8_t* src, uint16_t ofs, uint16_t len)
+	{
+		di();
+		FMR0.FMR01 = 0;
+		FMR0.FMR01 = 1;
+		FMR0.FMR02 = 0;
+		FMR0.FMR02 = 1;
+		if(ofs < 0x0400) {
+			FMR1.FMR16 = 1;
+			FMR1.FMR16 = 0;
+		} else {
+			FMR1.FMR17 = 1;
+			FMR1.FMR17 = 0;
+		}
+		bool ret = true;
+		for(uint16_t i = 0; i < len; ++i) {
+			wr8_(0x3000 + ofs + i, 0x40);
+			wr8_(0x3000 + ofs + i, src[i]);
+			while(FST.FST7() == 0) asm("nop");
+			if(FST.FST4()) {
+				wr8_(0x3000, 0x50);
+				ret = false;
+				break;
+			}
+		}
+		wr8_(0x3000, 0xff);
+		if(ofs < 0x0400) FMR1.FMR16 = 1;
+		else FMR1.FMR17 = 1;
+		FMR0.FMR01 = 0;
+		ei();
+		return ret;
+	}
+
+
+	// 従来の flash_io::erase
+	bool legacy_erase_(uint16_t ofs)
+	{
+		di();
+		FMR0.FMR01 = 0;
+		FMR0.FMR01 = 1;
+		FMR0.FMR02 = 0;
+		FMR0.FMR02 = 1;
+		if(ofs < 0x0400) {
+			FMR1.FMR16 = 1;
+			FMR1.FMR16 = 0;
+		} else {
+			FMR1.FMR17 = 1;
+			FMR1.FMR17 = 0;
+		}
+		wr8_(0x3000, 0x20);
+		wr8_(0x3000 + ofs, 0xd0);
+		while(FST.FST7() == 0) asm("nop");
+		bool ret = !FST.FST5();
+		wr8_(0x3000, 0xff);
+		if(ofs < 0x0400) FMR1.FMR16 = 1;
+		else FMR1.FMR17 = 1;
+		FMR0.FMR01 = 0;
+		ei();
+		return ret;
+	}
+
+
+	enum class TEST : uint8_t {
+		LEGACY_BYTE,	///< 従来の write(ofs, data) をバイト毎に呼ぶ
+		LEGACY_BULK,	///< 従来の write(src, ofs, len)
+		FLASH_IO,		///< flash_io::write(src, ofs, len)
+		FLASH_IO_CROSS,	///< バンクの境界をまたぐ flash_io::write（従来はエラー）
+		LEGACY_ERASE,
+		FLASH_IO_ERASE,
+	};
+
+	bool run_(const char* name, TEST t, uint16_t len)
+	{
+		flash_ = flash_model();
+		uint8_t src[0x0800];
+		for(uint16_t i = 0; i < len; ++i) src[i] = i * 7 + 3;
+		uint16_t ofs = t == TEST::FLASH_IO_CROSS ? (0x0400 - len / 2) : 0x0100;
+		if(t == TEST::LEGACY_ERASE || t == TEST::FLASH_IO_ERASE) {
+			ofs = 0;
+			std::memset(flash_.mem, 0x00, sizeof(flash_.mem));
+		}
+
+		flash_io fio;
+		now_ = 0;
+		di_max_ = 0;
+		bool ok = true;
+		switch(t) {
+		case TEST::LEGACY_BYTE:
+			for(uint16_t i = 0; i < len; ++i) {
+				ok = ok && legacy_write_(&src[i], ofs + i, 1);
+			}
+			break;
+		case TEST::LEGACY_BULK:
+			ok = legacy_write_(src, ofs, len);
+			break;
+		case TEST::FLASH_IO:
+		case TEST::FLASH_IO_CROSS:
+			ok = fio.write(src, ofs, len);
+			break;
+		case TEST::LEGACY_ERASE:
+			ok = legacy_erase_(0x0000);
+			break;
+		case TEST::FLASH_IO_ERASE:
+			ok = fio.erase(flash_io::DATA_AREA::BANK0);
+			break;
+		}
+		// 内容の確認
+		if(t == TEST::LEGACY_ERASE || t == TEST::FLASH_IO_ERASE) {
+			for(uint16_t i = 0; i < 0x0400; ++i) ok = ok && flash_.mem[i] == 0xFF;
+		} else {
+			ok = ok && std::memcmp(&flash_.mem[ofs], src, len) == 0;
+		}
+		ok = ok && flash_.error == 0 && ie_;
+
+		double us = static_cast<double>(now_) * 1e6 / F_CPU;
+		double di_us = static_cast<double>(di_max_) * 1e6 / F_CPU;
+		// UART 57600 bps の受信（１文字 173.6 us）、11025 Hz の PWM 更新（90.7 us）
+		const char* uart = di_us > (10.0 * 1e6 / 57600) ? "overrun" : "ok";
+		const char* pwm  = di_us > (1e6 / 11025) ? "late" : "ok";
+		std::printf("%-22s %5u %12.1f %9.2f %12.2f  %-8s %-5s %s\n", name, len, us / 1000.0,
+			len > 0 ? len / us * 1e6 / 1024.0 : 0.0, di_us, uart, pwm, ok ? "" : "FAIL");
+		return ok;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-p" && (i + 1) < argc) prog_us_ = std::atoi(argv[++i]);
+		else if(p == "-e" && (i + 1) < argc) erase_ms_ = std::atoi(argv[++i]);
+		else {
+			std::printf("usage: %s [-p program_us] [-e erase_ms]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	std::printf("F_CLK: %u Hz, program: %u us/byte, erase: %u ms\n\n", F_CPU, prog_us_, erase_ms_);
+	std::printf("%-22s %5s %12s %9s %12s  %-8s %-5s\n", "", "bytes", "ms", "KB/s", "max di(us)", "UART57k6", "PWM");
+	bool ok = true;
+	for(uint16_t len : { 16, 256 }) {
+		ok &= run_("legacy write(ofs, d)", TEST::LEGACY_BYTE, len);
+		ok &= run_("legacy write(src, len)", TEST::LEGACY_BULK, len);
+		ok &= run_("flash_io write", TEST::FLASH_IO, len);
+	}
+	ok &= run_("flash_io write (0/1)", TEST::FLASH_IO_CROSS, 256);
+	ok &= run_("legacy erase", TEST::LEGACY_ERASE, 0);
+	ok &= run_("flash_io erase", TEST::FLASH_IO_ERASE, 0);
+	return ok ? 0 : 1;
+}
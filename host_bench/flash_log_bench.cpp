@@ -0,0 +1,220 @@
+//=====================================================================//
+/*!	@file
+	@brief	flash_log（データ・フラッシュのキー／値ストア）のベンチマーク @n
+			・設定値の更新を、バンクの消去＋全体の書き直しと比べて、@n
+			　消去回数、書き込み量（増幅率）を表示 @n
+			・全ての操作位置で電源断を起こし、再起動後に、各キーが、@n
+			　更新前か更新後の値である事を確認（失敗があれば終了コード１）@n
+			・GC（collect）の各書き込みを失敗させ、全てのキーが旧い値で読め、@n
+			　再度の書き込みと再起動後も正しい事を確認
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include "host_flash.hpp"
+#include "common/flash_log.hpp"
+
+namespace {
+
+	static const uint8_t KEYS = 8;
+	typedef utils::flash_log<device::host_flash, KEYS> LOG;
+
+	static const uint32_t ENDURANCE = 10000;	///< データ・フラッシュの書き換え回数
+
+	uint32_t rand_ = 1;
+	uint32_t rand_next_() {
+		rand_ = rand_ * 1103515245 + 12345;
+		return rand_ >> 8;
+	}
+
+	struct value_t {
+		uint8_t	len;
+		uint8_t	data[32];
+	};
+
+	void make_value_(value_t& v, uint8_t max, bool del)
+	{
+		v.len = del ? 0 : (1 + rand_next_() % max);
+		for(uint8_t i = 0; i < v.len; ++i) v.data[i] = rand_next_();
+	}
+
+
+	bool same_(const LOG& log, uint8_t key, const value_t& v)
+	{
+		uint8_t tmp[LOG::LEN_MAX];
+		uint8_t len = log.read(key, tmp, sizeof(tmp));
+		return len == v.len && std::memcmp(tmp, v.data, len) == 0;
+	}
+
+
+	// 設定値の更新を、バンクの消去＋全体の書き直しと比べる
+	void amplification_(uint8_t max, uint32_t num)
+	{
+		device::host_flash flash;
+		LOG log(flash);
+		log.start();
+		flash.clear();
+
+		rand_ = 1;
+		uint32_t payload = 0;
+		// 従来：更新毎に、１バンクを消去して、全てのキーの現在値を書き直す
+		uint8_t cur[KEYS] = { 0 };
+		uint32_t old_bytes = 0;
+		for(uint32_t n = 0; n < num; ++n) {
+			value_t v;
+			make_value_(v, max, false);
+			uint8_t key = rand_next_() % KEYS;
+			log.write(key, v.data, v.len);
+			payload += v.len;
+			cur[key] = v.len;
+			for(uint8_t i = 0; i < KEYS; ++i) old_bytes += cur[i];
+		}
+		const auto& st = flash.get_stat();
+		uint32_t erase = st.erase[0] + st.erase[1];
+		uint32_t peak = st.erase[0] > st.erase[1] ? st.erase[0] : st.erase[1];
+		std::printf("%2u keys x %2u bytes: %6u updates\n", KEYS, max, num);
+		std::printf("  erase+rewrite : %6u erases, %8u bytes (x%.1f), %8u updates to wear out\n",
+			num, old_bytes, static_cast<double>(old_bytes) / payload, ENDURANCE);
+		std::printf("  flash_log     : %6u erases, %8u bytes (x%.1f), %8u updates to wear out\n",
+			erase, st.bytes, static_cast<double>(st.bytes) / payload,
+			peak > 0 ? static_cast<uint32_t>(static_cast<uint64_t>(ENDURANCE) * num / peak) : 0);
+	}
+
+
+	// 電源断のテスト（１回）
+	bool power_cut_(uint32_t cut, uint32_t num, uint32_t& ops, bool& done)
+	{
+		device::host_flash flash;
+		value_t cur[KEYS];
+		for(uint8_t i = 0; i < KEYS; ++i) cur[i].len = 0;
+		value_t next;
+		int16_t pend = -1;
+
+		flash.set_cut(cut);
+		rand_ = 7;
+		{
+			LOG log(flash);
+			log.start();
+			for(uint32_t n = 0; n < num && !flash.is_down(); ++n) {
+				uint8_t key = rand_next_() % KEYS;
+				make_value_(next, 24, (rand_next_() % 16) == 0);
+				pend = key;
+				log.write(key, next.data, next.len);
+				if(!flash.is_down()) {
+					cur[key] = next;
+					pend = -1;
+				}
+			}
+		}
+		ops = flash.get_ops();
+		done = !flash.is_down();
+
+		// 再起動
+		flash.set_cut(0xFFFFFFFF);
+		LOG log(flash);
+		if(!log.start()) return false;
+		for(uint8_t key = 0; key < KEYS; ++key) {
+			if(same_(log, key, cur[key])) continue;
+			if(key == pend && same_(log, key, next)) {
+				cur[key] = next;
+				continue;
+			}
+			std::printf("  cut %u: key %u broken\n", cut, key);
+			return false;
+		}
+		// 再起動後も書けて、次の再起動で残る事
+		for(uint8_t key = 0; key < KEYS; ++key) {
+			make_value_(cur[key], 24, false);
+			if(!log.write(key, cur[key].data, cur[key].len)) return false;
+		}
+		LOG chk(flash);
+		if(!chk.start()) return false;
+		for(uint8_t key = 0; key < KEYS; ++key) {
+			if(!same_(chk, key, cur[key])) {
+				std::printf("  cut %u: key %u lost after reboot\n", cut, key);
+				return false;
+			}
+		}
+		return flash.get_stat().rewrite == 0;
+	}
+
+
+	// GC の n 回目の書き込みを失敗させる（GC の書き込みが n 回以下なら done）
+	bool collect_fail_(uint32_t n, bool& done)
+	{
+		device::host_flash flash;
+		value_t cur[KEYS];
+		for(uint8_t i = 0; i < KEYS; ++i) cur[i].len = 0;
+		value_t next;
+
+		rand_ = 11;
+		LOG log(flash);
+		log.start();
+		uint8_t key;
+		for(;;) {
+			key = rand_next_() % KEYS;
+			make_value_(next, 24, false);
+			if(log.get_free() < (LOG::REC_EXTRA + next.len)) break;  // 次は GC
+			log.write(key, next.data, next.len);
+			cur[key] = next;
+		}
+		flash.set_fail(n);
+		done = log.write(key, next.data, next.len);
+		flash.set_fail(0xFFFFFFFF);
+		if(done) cur[key] = next;
+		for(uint8_t i = 0; i < KEYS; ++i) {
+			if(!same_(log, i, cur[i])) {
+				std::printf("  fail %u: key %u broken\n", n, i);
+				return false;
+			}
+		}
+		if(!done) {
+			if(!log.write(key, next.data, next.len)) return false;
+			cur[key] = next;
+		}
+		LOG chk(flash);
+		if(!chk.start()) return false;
+		for(uint8_t i = 0; i < KEYS; ++i) {
+			if(!same_(chk, i, cur[i])) {
+				std::printf("  fail %u: key %u lost after reboot\n", n, i);
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	amplification_(2, 20000);
+	amplification_(8, 20000);
+	amplification_(24, 20000);
+
+	static const uint32_t num = 400;  // 数回の GC を含む
+	uint32_t fail = 0;
+	uint32_t cut = 0;
+	for(;;) {
+		uint32_t ops;
+		bool done;
+		if(!power_cut_(cut, num, ops, done)) ++fail;
+		if(done) break;
+		++cut;
+	}
+	std::printf("power cut: %u points, %u failures\n", cut, fail);
+
+	uint32_t wfail = 0;
+	uint32_t wn = 0;
+	for(;;) {
+		bool done;
+		if(!collect_fail_(wn, done)) ++wfail;
+		if(done) break;
+		++wn;
+	}
+	std::printf("collect write fail: %u points, %u failures\n", wn, wfail);
+	return (fail + wfail) != 0;
+}
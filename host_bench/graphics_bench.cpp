@@ -0,0 +1,253 @@
+//=====================================================================//
+/*!	@file
+	@brief	monograph グラフィックス・ベンチマーク、ゴールデン・イメージ比較 @n
+			・128x64、128x32 で、line、frame、fill、draw_image、@n
+			　draw_font_utf16、全画面描画の処理時間を計測 @n
+			・page_plot（高速パス）と、host_plot（点単位の基準）の結果を比較 @n
+			・golden ディレクトリーの PBM と比較して、描画結果の変化を検出 @n
+			　「--update」で、ゴールデン・イメージを基準から作り直す @n
+			　「--png」で、各シーンを PNG で書き出す
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "common/page_plot.hpp"
+#include "common/font6x12_page.hpp"
+#include "common/font6x12.cpp"
+#include "common/font6x12_page.cpp"
+#include "host_plot.hpp"
+
+namespace {
+
+	typedef std::chrono::steady_clock CLOCK;
+
+	bool update_ = false;
+	bool png_ = false;
+
+	graphics::kfont_null kfont_;
+
+	// 16x16 のモーション・オブジェクトと、13x10 のイメージ（draw_image 形式）
+	std::vector<uint8_t> mobj_;
+	std::vector<uint8_t> bits_;
+
+	void make_image_(std::vector<uint8_t>& out, uint8_t w, uint8_t h, bool (*func)(int, int))
+	{
+		out.assign((w * h + 7) / 8, 0);
+		for(int y = 0; y < h; ++y) {
+			for(int x = 0; x < w; ++x) {
+				int i = y * w + x;
+				if(func(x, y)) out[i >> 3] |= 1 << (i & 7);
+			}
+		}
+	}
+
+	void init_images_()
+	{
+		make_image_(mobj_, 16, 16, [](int x, int y) {
+			int dx = x * 2 - 15;
+			int dy = y * 2 - 15;
+			int r = dx * dx + dy * dy;
+			if(r >= 169 && r <= 225) return true;  // 輪郭
+			if((x == 5 || x == 10) && y >= 4 && y <= 6) return true;  // 目
+			return y == 11 && x >= 4 && x <= 11;  // 口
+		});
+		mobj_.insert(mobj_.begin(), { 16, 16 });
+		make_image_(bits_, 13, 10, [](int x, int y) { return ((x * y + x) % 3) == 0; });
+	}
+
+	template <class MONO>
+	void line_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		for(int16_t x = 0; x < w; x += 8) {
+			m.line(w / 2, h / 2, x, 0, 1);
+			m.line(w / 2, h / 2, w - 1 - x, h - 1, 1);
+		}
+		for(int16_t i = 0; i < 8; ++i) {
+			m.line(-20 + i * 5, h + 10, w + 10, -20 + i * 7, (i & 1) == 0);
+			m.line(i * 3, i * 4, i * 3, h - 1 - i * 4, 1);
+			m.line(w - 1 - i * 2, i, i * 5, i, 1);
+		}
+	}
+
+	template <class MONO>
+	void frame_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		for(int16_t i = 0; (i * 2) < h; i += 3) {
+			m.frame(i, i, w - i * 2, h - i * 2, 1);
+		}
+		m.frame(-5, -5, 20, 20, 1);
+		m.frame(w - 10, h - 10, 30, 30, 1);
+		m.frame(40, 3, 1, 9, 1);
+		m.frame(50, 3, 9, 1, 1);
+	}
+
+	template <class MONO>
+	void fill_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		m.fill(0, 0, w, h / 2, 1);
+		for(int16_t y = -3; y < h; y += 7) {
+			for(int16_t x = -5; x < w; x += 11) {
+				m.fill(x, y, 9, 5, ((x + y) & 4) != 0);
+			}
+		}
+		m.fill(w - 3, h - 3, 10, 10, 1);
+	}
+
+	template <class MONO>
+	void image_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		for(int16_t y = -8; y < h; y += 13) {
+			for(int16_t x = -9; x < w; x += 19) {
+				m.draw_mobj(x, y, &mobj_[0]);
+				m.draw_image(x + 3, y + 7, &bits_[0], 13, 10);
+			}
+		}
+	}
+
+	template <class MONO>
+	void font_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		uint16_t code = 0x20;
+		for(int16_t y = -5; y < h; y += 11) {
+			for(int16_t x = -3; x < w; x += 6) {
+				m.draw_font_utf16(x, y, code);
+				++code;
+				if(code >= 0x80) code = 0x20;
+			}
+		}
+		m.fill(0, h - 12, w, 12, 0);
+		m.draw_text(1, h - 12, "Volt: 12.34V ilj|!", true);
+	}
+
+	// USB_CHECKER 風の全画面
+	template <class MONO>
+	void screen_(MONO& m)
+	{
+		int16_t w = m.get_width();
+		int16_t h = m.get_height();
+		m.clear(0);
+		m.frame(0, 0, w, h, 1);
+		m.draw_text(2, 2, "5.02V 0.48A");
+		m.draw_text(2, 14, "00:12:34 2.41W", true);
+		m.draw_holizontal_level(70, 3, 54, 8, 30);
+		int16_t y0 = h - 2;
+		for(int16_t x = 2; x < (w - 2); ++x) {
+			int16_t y1 = h - 2 - ((x * 7) % (h / 2));
+			m.line(x - 1, y0, x, y1, 1);
+			y0 = y1;
+		}
+	}
+
+
+	template <int16_t W, int16_t H>
+	class suite {
+		typedef graphics::monograph<graphics::host_plot<W, H>, graphics::font6x12> REF;
+		typedef graphics::monograph<graphics::page_plot<W, H>, graphics::font6x12_page> FAST;
+
+		REF		ref_;
+		FAST	fast_;
+
+		template <class MONO>
+		static double time_(MONO& m, void (*func)(MONO&)) {
+			static const int32_t loop = 2000;
+			auto t0 = CLOCK::now();
+			for(int32_t i = 0; i < loop; ++i) func(m);
+			return std::chrono::duration<double, std::micro>(CLOCK::now() - t0).count() / loop;
+		}
+
+	public:
+		suite() : ref_(kfont_), fast_(kfont_) { }
+
+		int run(const char* name, void (*rf)(REF&), void (*ff)(FAST&))
+		{
+			double tr = time_(ref_, rf);
+			double tf = time_(fast_, ff);
+			const auto& rp = ref_.at_plot();
+			const auto& fp = fast_.at_plot();
+			uint32_t diff = graphics::compare_plot(rp, fp);
+
+			std::string file = std::string(name) + "_" + std::to_string(W) + "x" + std::to_string(H);
+			std::string golden = "golden/" + file + ".pbm";
+			std::string res;
+			int ret = diff == 0 ? 0 : 1;
+			if(update_) {
+				graphics::write_pbm(golden.c_str(), rp);
+				res = "updated";
+			} else {
+				uint32_t gd = 0;
+				if(!graphics::compare_pbm(golden.c_str(), fp, gd)) {
+					res = "no golden";
+					ret = 1;
+				} else if(gd != 0) {
+					res = "golden diff " + std::to_string(gd);
+					ret = 1;
+				} else {
+					res = "ok";
+				}
+			}
+			if(png_) {
+				graphics::write_png((file + ".png").c_str(), fp);
+			}
+			std::printf("%-7s %3dx%-3d ref: %7.2f us, fast: %7.2f us, x%5.1f, diff: %u, %s\n",
+				name, W, H, tr, tf, tf > 0.0 ? tr / tf : 0.0, diff, res.c_str());
+			return ret;
+		}
+
+		int run_all()
+		{
+			int ret = 0;
+			ret |= run("line",   line_<REF>,   line_<FAST>);
+			ret |= run("frame",  frame_<REF>,  frame_<FAST>);
+			ret |= run("fill",   fill_<REF>,   fill_<FAST>);
+			ret |= run("image",  image_<REF>,  image_<FAST>);
+			ret |= run("font",   font_<REF>,   font_<FAST>);
+			ret |= run("screen", screen_<REF>, screen_<FAST>);
+			return ret;
+		}
+	};
+
+	suite<128, 64>	suite64_;
+	suite<128, 32>	suite32_;
+}
+
+
+int main(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "--update") update_ = true;
+		else if(p == "--png") png_ = true;
+		else {
+			std::printf("usage: %s [--update] [--png]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	init_images_();
+
+	int ret = 0;
+	ret |= suite64_.run_all();
+	ret |= suite32_.run_all();
+	return ret;
+}
@@ -0,0 +1,613 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト用 Petit FatFs ディスク（SPI の SD カード）と、FAT イメージ生成 @n
+			・host_disk は、メモリー上のイメージを持つ SD カードを、SPI の @n
+			　バイト単位（xchg）で真似て、pfatfs::mmc_io をそのまま動かす @n
+			　（CMD17/CMD18/CMD12 の判定は、mmc_io のコードを使う） @n
+			・コマンド数、SPI のバイト数、読み捨てたデータのバイト数と、@n
+			　時間の見積もりを数える @n
+			・イメージは、ファイルから読み込み、書き戻せる（load、save） @n
+			・fat_image は、FAT12/16/32 のイメージ（SFD 形式）を作る
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <vector>
+#include "pfatfs/mmc_io.hpp"
+
+namespace pfatfs {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ホスト用ディスク・クラス（SPI の SD カード、SDHC） @n
+				mmc_io の SPI として使う（start、xchg、send、recv）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_disk {
+	public:
+		struct stat_t {
+			uint32_t	cmd;	///< 受け取ったコマンド数
+			uint32_t	bytes;	///< SPI のバイト数
+			uint32_t	skip;	///< 読み捨てたデータ・ブロックのバイト数（部分読み出しの残り、@n
+								///< CRC、CMD12 のスタッフ・バイトと、CMD12 までに送った分）
+			double		us;		///< 時間の見積もり
+		};
+
+	private:
+		enum class state : uint8_t {
+			IDLE,		///< コマンド待ち
+			CMD,		///< コマンドの受信中
+			WTOKEN,		///< 書き込みのデータ・トークン待ち
+			WDATA,		///< 書き込みデータの受信中
+		};
+
+		std::vector<uint8_t>&	img_;
+		double		cmd_us_;
+		double		fast_us_;	///< start(0) の１バイトの時間
+		double		byte_us_;
+		stat_t		stat_;
+
+		bool		sel_;
+		state		state_;
+		uint8_t		cmd_[6];
+		uint8_t		cmdn_;
+		bool		idle_;
+		bool		app_;		///< CMD55 の次
+		bool		stream_;	///< CMD18 の転送中
+		uint32_t	sec_;		///< CMD18 の次のセクター
+		uint32_t	wsec_;
+		uint32_t	wn_;
+		uint8_t		wbuf_[514];	///< データ、CRC
+
+		static const uint16_t DATA = 0x100;	///< out_ の、データ・ブロックの印
+
+		std::deque<uint16_t>	out_;
+
+		uint32_t sectors_() const { return img_.size() / 512; }
+
+		void resp_(uint8_t r1) {
+			out_.push_back(0xFF);  // NCR
+			out_.push_back(r1);
+		}
+
+		// データ・トークン待ち、データ・トークン、データ、CRC
+		void block_(uint32_t sec) {
+			out_.push_back(0xFF);
+			out_.push_back(0xFE);
+			for(uint32_t i = 0; i < 512; ++i) out_.push_back(img_[sec * 512 + i] | DATA);
+			out_.push_back(0xFF | DATA);
+			out_.push_back(0xFF | DATA);
+		}
+
+		void command_()
+		{
+			uint8_t cmd = cmd_[0] & 0x3F;
+			uint32_t arg = (static_cast<uint32_t>(cmd_[1]) << 24) | (static_cast<uint32_t>(cmd_[2]) << 16)
+				| (static_cast<uint32_t>(cmd_[3]) << 8) | cmd_[4];
+			bool app = app_;
+			app_ = false;
+			++stat_.cmd;
+			out_.clear();
+			uint8_t r1 = idle_ ? 0x01 : 0x00;
+			switch(cmd) {
+			case 0:   // GO_IDLE_STATE
+				idle_ = true;
+				stream_ = false;
+				resp_(0x01);
+				break;
+			case 8:   // SEND_IF_COND
+				resp_(r1);
+				out_.push_back(0x00);
+				out_.push_back(0x00);
+				out_.push_back(arg >> 8);
+				out_.push_back(arg);
+				break;
+			case 12:  // STOP_TRANSMISSION（スタッフ・バイトの後に応答）
+				stream_ = false;
+				out_.push_back(0xFF | DATA);
+				out_.push_back(r1);
+				break;
+			case 16:  // SET_BLOCKLEN
+				resp_(r1);
+				break;
+			case 17:  // READ_SINGLE_BLOCK
+			case 18:  // READ_MULTIPLE_BLOCK
+				if(idle_ || arg >= sectors_()) {
+					resp_(r1 | 0x40);
+					break;
+				}
+				resp_(0x00);
+				stat_.us += cmd_us_;  // データ・トークンまでの待ち
+				block_(arg);
+				if(cmd == 18) {
+					stream_ = true;
+					sec_ = arg + 1;
+				}
+				break;
+			case 24:  // WRITE_BLOCK
+				if(idle_ || arg >= sectors_()) {
+					resp_(r1 | 0x40);
+					break;
+				}
+				resp_(0x00);
+				wsec_ = arg;
+				state_ = state::WTOKEN;
+				break;
+			case 41:  // SD_SEND_OP_COND（ACMD41）
+				if(app) {
+					idle_ = false;
+					resp_(0x00);
+				} else {
+					resp_(r1 | 0x04);
+				}
+				break;
+			case 55:  // APP_CMD
+				app_ = true;
+				resp_(r1);
+				break;
+			case 58:  // READ_OCR（電源投入済み、CCS = 1）
+				resp_(r1);
+				out_.push_back(0xC0);
+				out_.push_back(0xFF);
+				out_.push_back(0x80);
+				out_.push_back(0x00);
+				break;
+			default:  // 不正なコマンド
+				resp_(r1 | 0x04);
+				break;
+			}
+		}
+
+		void input_(uint8_t d)
+		{
+			switch(state_) {
+			case state::IDLE:
+				if((d & 0xC0) == 0x40) {
+					cmd_[0] = d;
+					cmdn_ = 1;
+					state_ = state::CMD;
+				}
+				break;
+			case state::CMD:
+				cmd_[cmdn_++] = d;
+				if(cmdn_ >= sizeof(cmd_)) {
+					state_ = state::IDLE;
+					command_();
+				}
+				break;
+			case state::WTOKEN:
+				if(d == 0xFE) {
+					wn_ = 0;
+					state_ = state::WDATA;
+				}
+				break;
+			case state::WDATA:
+				wbuf_[wn_++] = d;
+				if(wn_ >= sizeof(wbuf_)) {
+					std::memcpy(&img_[wsec_ * 512], wbuf_, 512);
+					out_.push_back(0xE5);  // データ応答（受理）
+					out_.push_back(0x00);  // 書き込みビジー
+					stat_.us += cmd_us_;
+					state_ = state::IDLE;
+				}
+				break;
+			}
+		}
+
+	public:
+		//-------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+			@param[in]	img		イメージ（５１２バイト単位）
+		*/
+		//-------------------------------------------------------------//
+		host_disk(std::vector<uint8_t>& img) : img_(img),
+			cmd_us_(0.0), fast_us_(0.0), byte_us_(0.0), stat_(), sel_(false), state_(state::IDLE),
+			cmd_(), cmdn_(0), idle_(true), app_(false), stream_(false), sec_(0), wsec_(0), wn_(0),
+			wbuf_(), out_() { }
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	カードのモデル
+			@param[in]	cmd_us	読み出しのデータ・トークン、書き込みビジーの待ち時間
+			@param[in]	kbps	SPI のビット・レート（start(0) の速度）
+		*/
+		//-------------------------------------------------------------//
+		void set_latency(double cmd_us, double kbps)
+		{
+			cmd_us_ = cmd_us;
+			fast_us_ = kbps > 0.0 ? 8000.0 / kbps : 0.0;
+			byte_us_ = fast_us_;
+		}
+
+
+		void clear() { stat_ = stat_t(); }
+
+		const stat_t& get_stat() const { return stat_; }
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	mmc_io が受け取ったデータ（disk_readp の count）を、@n
+					読み捨てから除く
+			@param[in]	count	バイト数
+		*/
+		//-------------------------------------------------------------//
+		void take(uint32_t count) { stat_.skip -= count; }
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	カードの選択（SEL::P = 0 で選択）
+			@param[in]	ena	選択なら「true」
+		*/
+		//-------------------------------------------------------------//
+		void select(bool ena)
+		{
+			if(sel_ && !ena) {
+				out_.clear();
+				state_ = state::IDLE;
+			}
+			sel_ = ena;
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	SPI の開始
+			@param[in]	speed	通信速度（0 なら set_latency の速度）
+			@return 常に「true」
+		*/
+		//-------------------------------------------------------------//
+		bool start(uint32_t speed)
+		{
+			byte_us_ = speed != 0 ? 8000000.0 / speed : fast_us_;
+			return true;
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	リード・ライト
+			@param[in]	data	書き込みデータ
+			@return 読み出しデータ
+		*/
+		//-------------------------------------------------------------//
+		uint8_t xchg(uint8_t data = 0xff)
+		{
+			++stat_.bytes;
+			stat_.us += byte_us_;
+			if(!sel_) return 0xFF;
+
+			if(out_.empty() && stream_ && sec_ < sectors_()) {
+				block_(sec_);
+				++sec_;
+			}
+			uint8_t r = 0xFF;
+			if(!out_.empty()) {
+				uint16_t d = out_.front();
+				out_.pop_front();
+				if(d & DATA) ++stat_.skip;  // 受け取った分は take で除く
+				r = d;
+			}
+			input_(data);
+			return r;
+		}
+
+
+		void send(const void* src, uint32_t size)
+		{
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			while(size > 0) {
+				xchg(*p++);
+				--size;
+			}
+		}
+
+
+		void recv(void* dst, uint32_t size)
+		{
+			uint8_t* p = static_cast<uint8_t*>(dst);
+			while(size > 0) {
+				*p++ = xchg();
+				--size;
+			}
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	イメージ・ファイルの読み込み（５１２バイトに満たない分は捨てる）
+			@param[in]	path	ファイル・パス
+			@param[out]	img		イメージ
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		static bool load(const char* path, std::vector<uint8_t>& img)
+		{
+			FILE* fp = std::fopen(path, "rb");
+			if(fp == nullptr) return false;
+			std::fseek(fp, 0, SEEK_END);
+			long size = std::ftell(fp);
+			std::fseek(fp, 0, SEEK_SET);
+			if(size < 512) {
+				std::fclose(fp);
+				return false;
+			}
+			img.resize(size / 512 * 512);
+			bool ok = std::fread(&img[0], 1, img.size(), fp) == img.size();
+			std::fclose(fp);
+			return ok;
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	イメージ・ファイルの書き出し
+			@param[in]	path	ファイル・パス
+			@param[in]	img		イメージ
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		static bool save(const char* path, const std::vector<uint8_t>& img)
+		{
+			FILE* fp = std::fopen(path, "wb");
+			if(fp == nullptr) return false;
+			bool ok = std::fwrite(&img[0], 1, img.size(), fp) == img.size();
+			ok = std::fclose(fp) == 0 && ok;
+			return ok;
+		}
+	};
+
+	host_disk* host_disk_ = nullptr;  ///< 選択信号の接続先
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	mmc_io の SEL（P = 0 で、host_disk_ を選択）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct host_sel {
+		struct port_t {
+			void operator = (bool v) {
+				if(host_disk_ != nullptr) host_disk_->select(!v);
+			}
+		};
+		struct dir_t {
+			void operator = (bool v) { }
+		};
+		static port_t	P;
+		static dir_t	DIR;
+	};
+	host_sel::port_t host_sel::P;
+	host_sel::dir_t host_sel::DIR;
+
+	typedef mmc_io<host_disk, host_sel> host_mmc;
+	host_mmc* host_mmc_ = nullptr;  ///< diskio の接続先
+}
+
+extern "C" {
+
+	DSTATUS disk_initialize(void)
+	{
+		if(pfatfs::host_mmc_ == nullptr) return STA_NOINIT;
+		return pfatfs::host_mmc_->disk_initialize();
+	}
+
+	DRESULT disk_readp(BYTE* buff, DWORD sector, UINT offset, UINT count)
+	{
+		if(pfatfs::host_mmc_ == nullptr) return RES_NOTRDY;
+		DRESULT res = pfatfs::host_mmc_->disk_readp(buff, sector, offset, count);
+		if(res == RES_OK && pfatfs::host_disk_ != nullptr) pfatfs::host_disk_->take(count);
+		return res;
+	}
+
+	DRESULT disk_writep(const BYTE* buff, DWORD sc)
+	{
+		if(pfatfs::host_mmc_ == nullptr) return RES_NOTRDY;
+		return pfatfs::host_mmc_->disk_writep(buff, sc);
+	}
+}
+
+
+namespace pfatfs {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	FAT イメージ生成クラス（ルート・ディレクトリーのみ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class fat_image {
+		std::vector<uint8_t>&	img_;
+		uint8_t		type_;		// 12, 16, 32
+		uint8_t		spc_;
+		uint32_t	fatbase_;
+		uint32_t	fatsz_;
+		uint32_t	rootbase_;	// FAT12/16 のルート・セクター
+		uint32_t	nroot_;		// ルート・エントリー数
+		uint32_t	database_;
+		uint32_t	nclst_;		// クラスター数 + 2
+		uint32_t	next_;		// 次の空きクラスター
+		uint32_t	nent_;		// 使ったエントリー数
+		uint32_t	root_clst_;	// FAT32 のルート先頭クラスター
+
+		static const uint32_t FAT32_ROOT = 4;  // FAT32 のルートのクラスター数
+
+		void put16_(uint32_t ofs, uint16_t v) {
+			img_[ofs] = v;
+			img_[ofs + 1] = v >> 8;
+		}
+
+		void put32_(uint32_t ofs, uint32_t v) {
+			put16_(ofs, v);
+			put16_(ofs + 2, v >> 16);
+		}
+
+		void set_fat_(uint32_t clst, uint32_t v)
+		{
+			for(uint32_t n = 0; n < 2; ++n) {
+				uint32_t base = (fatbase_ + fatsz_ * n) * 512;
+				if(type_ == 12) {
+					uint32_t ofs = base + clst + clst / 2;
+					uint16_t w = img_[ofs] | (img_[ofs + 1] << 8);
+					if(clst & 1) w = (w & 0x000F) | (v << 4);
+					else w = (w & 0xF000) | (v & 0xFFF);
+					put16_(ofs, w);
+				} else if(type_ == 16) {
+					put16_(base + clst * 2, v);
+				} else {
+					put32_(base + clst * 4, v & 0x0FFFFFFF);
+				}
+			}
+		}
+
+		uint32_t eoc_() const { return type_ == 12 ? 0xFFF : (type_ == 16 ? 0xFFFF : 0x0FFFFFFF); }
+
+		uint32_t clust_pos_(uint32_t clst) const { return (database_ + (clst - 2) * spc_) * 512; }
+
+	public:
+		//-------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター（フォーマット）
+			@param[out]	img		イメージ
+			@param[in]	type	FAT タイプ（12, 16, 32）
+			@param[in]	tsect	総セクター数
+			@param[in]	spc		クラスター当たりのセクター数
+		*/
+		//-------------------------------------------------------------//
+		fat_image(std::vector<uint8_t>& img, uint8_t type, uint32_t tsect, uint8_t spc) :
+			img_(img), type_(type), spc_(spc), fatbase_(0), fatsz_(0), rootbase_(0), nroot_(0),
+			database_(0), nclst_(0), next_(2), nent_(0), root_clst_(0)
+		{
+			img_.assign(tsect * 512, 0);
+			uint32_t rsvd = type == 32 ? 32 : 1;
+			nroot_ = type == 32 ? 0 : 512;
+			uint32_t rootsec = nroot_ / 16;
+			// FAT のサイズを、クラスター数と合わせて決める
+			fatsz_ = 1;
+			for(int i = 0; i < 8; ++i) {
+				uint32_t ncl = (tsect - rsvd - fatsz_ * 2 - rootsec) / spc + 2;
+				uint32_t bytes = type == 12 ? (ncl * 3 + 1) / 2 : ncl * (type / 8);
+				fatsz_ = (bytes + 511) / 512;
+			}
+			fatbase_ = rsvd;
+			rootbase_ = rsvd + fatsz_ * 2;
+			database_ = rootbase_ + rootsec;
+			nclst_ = (tsect - rsvd - fatsz_ * 2 - rootsec) / spc + 2;
+
+			img_[0] = 0xEB;
+			img_[1] = 0x3C;
+			img_[2] = 0x90;
+			std::memcpy(&img_[3], "R8C     ", 8);
+			put16_(11, 512);
+			img_[13] = spc;
+			put16_(14, rsvd);
+			img_[16] = 2;
+			put16_(17, nroot_);
+			if(tsect < 0x10000 && type != 32) put16_(19, tsect);
+			else put32_(32, tsect);
+			img_[21] = 0xF8;
+			if(type == 32) {
+				put32_(36, fatsz_);
+				put32_(44, 2);  // ルート・クラスター
+				img_[66] = 0x29;
+				std::memcpy(&img_[71], "NO NAME    FAT32   ", 19);
+			} else {
+				put16_(22, fatsz_);
+				img_[38] = 0x29;
+				std::memcpy(&img_[43], "NO NAME    FAT1    ", 19);
+				img_[58] = type == 12 ? '2' : '6';
+			}
+			put16_(510, 0xAA55);
+
+			set_fat_(0, 0xFFFFFF8);
+			set_fat_(1, eoc_());
+			if(type == 32) {  // ルートは連続した FAT32_ROOT クラスター
+				root_clst_ = 2;
+				for(uint32_t i = 0; i < FAT32_ROOT; ++i) {
+					set_fat_(2 + i, i < (FAT32_ROOT - 1) ? (3 + i) : eoc_());
+				}
+				next_ = 2 + FAT32_ROOT;
+			}
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	FAT タイプの取得（12, 16, 32）
+		*/
+		//-------------------------------------------------------------//
+		uint8_t get_type() const { return type_; }
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	クラスター数の取得
+		*/
+		//-------------------------------------------------------------//
+		uint32_t get_clusters() const { return nclst_ - 2; }
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	ファイルを追加
+			@param[in]	name	８．３形式のファイル名（例：「SEQ.BIN」）
+			@param[in]	size	サイズ
+			@param[in]	run		連続するクラスター数（0 なら全て連続）
+			@param[in]	gap		run 毎に空けるクラスター数
+			@param[in]	data	オフセットからデータを作る関数
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		bool add_file(const char* name, uint32_t size, uint32_t run, uint32_t gap, uint8_t (*data)(uint32_t))
+		{
+			uint32_t max = type_ == 32 ? (FAT32_ROOT * spc_ * 16) : nroot_;
+			if(nent_ >= max) return false;
+
+			uint32_t ent;
+			if(type_ == 32) {
+				ent = clust_pos_(root_clst_) + nent_ * 32;
+			} else {
+				ent = rootbase_ * 512 + nent_ * 32;
+			}
+			std::memset(&img_[ent], ' ', 11);
+			const char* p = name;
+			for(uint32_t i = 0; *p != 0 && *p != '.' && i < 8; ++i) img_[ent + i] = *p++;
+			if(*p == '.') {
+				++p;
+				for(uint32_t i = 8; *p != 0 && i < 11; ++i) img_[ent + i] = *p++;
+			}
+			img_[ent + 11] = 0x20;  // アーカイブ
+			put32_(ent + 28, size);
+
+			uint32_t bcs = spc_ * 512;
+			uint32_t ncl = (size + bcs - 1) / bcs;
+			uint32_t prev = 0;
+			uint32_t top = 0;
+			for(uint32_t i = 0; i < ncl; ++i) {
+				if(run != 0 && i != 0 && (i % run) == 0) next_ += gap;
+				if(next_ >= nclst_) return false;
+				uint32_t c = next_++;
+				if(prev != 0) set_fat_(prev, c);
+				else top = c;
+				prev = c;
+				uint32_t n = (size - i * bcs) < bcs ? (size - i * bcs) : bcs;
+				for(uint32_t j = 0; j < n; ++j) {
+					img_[clust_pos_(c) + j] = data(i * bcs + j);
+				}
+			}
+			if(prev != 0) set_fat_(prev, eoc_());
+			put16_(ent + 26, top);
+			put16_(ent + 20, top >> 16);
+			++nent_;
+			return true;
+		}
+	};
+}
@@ -0,0 +1,146 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト用データ・フラッシュ・モデル（flash_io 互換）@n
+			・0x0000 ～ 0x07FF（BANK0/BANK1）@n
+			・書き込みは、ビットを 1 から 0 にするだけ（消去後の再書き込みを検出）@n
+			・消去回数、書き込みバイト数を数える @n
+			・set_cut(n) で、n 回の操作（１バイト書き込み、消去）の後に電源断 @n
+			　（以降の操作は無視、消去中の電源断は、バンクの一部だけを消去）@n
+			・set_fail(n) で、n 回の write の後、次の write を失敗させる（ベリファイ・エラー）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cstring>
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ホスト・フラッシュ・クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_flash {
+	public:
+		enum class DATA_AREA {
+			BANK0,	///< 0x0000 to 0x03FF (1024)
+			BANK1,	///< 0x0400 to 0x07FF (1024)
+		};
+
+		static const uint16_t SIZE = 0x0800;
+
+		struct stat_t {
+			uint32_t	erase[2];	///< バンク毎の消去回数
+			uint32_t	bytes;		///< 書き込みバイト数
+			uint32_t	calls;		///< write の呼び出し回数
+			uint32_t	rewrite;	///< 消去されていないバイトへの書き込み
+		};
+
+	private:
+		uint8_t		mem_[SIZE];
+		stat_t		stat_;
+		uint32_t	ops_;
+		uint32_t	cut_;
+		uint32_t	fail_;
+		bool		down_;
+
+		bool op_() {
+			if(down_) return false;
+			++ops_;
+			if(ops_ > cut_) {
+				down_ = true;
+				return false;
+			}
+			return true;
+		}
+
+	public:
+		host_flash() : stat_(), ops_(0), cut_(0xFFFFFFFF), fail_(0xFFFFFFFF), down_(false) {
+			std::memset(mem_, 0xFF, SIZE);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  電源断を設定
+			@param[in]	n	操作数（0xFFFFFFFF なら電源断無し）
+		*/
+		//-----------------------------------------------------------------//
+		void set_cut(uint32_t n) {
+			ops_ = 0;
+			cut_ = n;
+			down_ = false;
+		}
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  書き込み失敗を設定（１回だけ、何も書かずに「false」を返す）
+			@param[in]	n	成功させる write の回数（0xFFFFFFFF なら失敗無し）
+		*/
+		//-----------------------------------------------------------------//
+		void set_fail(uint32_t n) { fail_ = n; }
+
+		bool is_down() const { return down_; }
+
+		uint32_t get_ops() const { return ops_; }
+
+		const stat_t& get_stat() const { return stat_; }
+
+		void clear() { stat_ = stat_t(); }
+
+
+		bool erase(DATA_AREA bank) {
+			uint16_t ofs = bank == DATA_AREA::BANK0 ? 0x0000 : 0x0400;
+			if(!op_()) {
+				if(ops_ == (cut_ + 1)) {  // 消去の途中
+					for(uint16_t i = 0; i < 0x0400; i += 2) mem_[ofs + i] = 0xFF;
+				}
+				return true;
+			}
+			std::memset(&mem_[ofs], 0xFF, 0x0400);
+			++stat_.erase[bank == DATA_AREA::BANK0 ? 0 : 1];
+			return true;
+		}
+
+
+		uint8_t read(uint16_t ofs) const {
+			if(ofs >= SIZE) return 0;
+			return mem_[ofs];
+		}
+
+
+		void read(uint16_t ofs, uint16_t len, uint8_t* dst) const {
+			if(ofs >= SIZE || (ofs + len) > SIZE) return;
+			std::memcpy(dst, &mem_[ofs], len);
+		}
+
+
+		bool write(uint16_t ofs, uint8_t data) {
+			return write(&data, ofs, 1);
+		}
+
+
+		bool write(const uint8_t* src, uint16_t ofs, uint16_t len) {
+			if(ofs >= SIZE || (ofs + len) > SIZE) return false;
+			if(fail_ != 0xFFFFFFFF) {
+				if(fail_ == 0) {
+					fail_ = 0xFFFFFFFF;
+					return false;
+				}
+				--fail_;
+			}
+			++stat_.calls;
+			for(uint16_t i = 0; i < len; ++i) {
+				if(!op_()) return true;
+				if(mem_[ofs + i] != 0xFF) ++stat_.rewrite;
+				mem_[ofs + i] &= src[i];
+				++stat_.bytes;
+			}
+			return true;
+		}
+	};
+}
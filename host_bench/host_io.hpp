@@ -0,0 +1,1045 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト用 R8C/M120AN レジスター・シミュレーター（IO_HOST）@n
+			・64K バイトのアドレス空間と、レジスター毎の読み書きフック @n
+			・F_CLK のサイクルで進む時間と、周辺のイベント・スケジューラー @n
+			・割り込み（ILVLx、周辺の許可ビット、I フラグ）と ISR の呼び出し @n
+			・ポート（P1、P3、P4、PA）、タイマー RB/RC/RJ、UART0、A/D の @n
+			　モデル @n
+			・待ちループ（io_host_wait）は、次のイベントまで時間を進める @n
+			・write/read（stdin、stdout）を、sci_putch/sci_getch に繋ぐ @n
+			　（common/syscalls.c と同じ）@n
+			サンプルの main.cpp を、変更無しで「-DIO_HOST -Dmain=sample_main」で @n
+			コンパイルしてリンクし、run() で、シミュレーション時間を決めて動かす @n
+			※ io_host_wr8 などの実体を含むので、１つのソースでだけ include する
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#ifndef IO_HOST
+#define IO_HOST
+#endif
+#include "common/io_utils.hpp"
+
+#ifndef F_CLK
+#  error "host_io.hpp requires F_CLK to be defined"
+#endif
+
+// サンプルが定義していなければ、nullptr になる
+extern "C" {
+	void TIMER_RB_intr(void) __attribute__((weak));
+	void TIMER_RC_intr(void) __attribute__((weak));
+	void TIMER_RJ_intr(void) __attribute__((weak));
+	void UART0_TX_intr(void) __attribute__((weak));
+	void UART0_RX_intr(void) __attribute__((weak));
+	void ADC_intr(void) __attribute__((weak));
+	void sci_putch(char ch) __attribute__((weak));
+	char sci_getch(void) __attribute__((weak));
+}
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ホスト・シミュレーター基本クラス @n
+				アドレス空間、時間、イベント、割り込み
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_core {
+	public:
+		typedef std::function<void (address_type adr, uint8_t data)> wr_hook;
+		typedef std::function<uint8_t (address_type adr)> rd_hook;
+		typedef void (*isr_type)(void);
+
+		static constexpr uint64_t NEVER = 0xFFFFFFFFFFFFFFFFULL;
+		static constexpr uint32_t ACCESS = 3;	///< レジスター・アクセスのサイクル（命令を含む）
+		static constexpr uint32_t INTR = 20;	///< 割り込みの受け付けと REIT のサイクル
+		static constexpr uint32_t DI_EI = 4;	///< fclr/fset i + nop x 2
+
+		static constexpr uint64_t usec(uint64_t us) { return us * (F_CLK / 1000000); }
+		static constexpr uint64_t msec(uint64_t ms) { return ms * (F_CLK / 1000); }
+
+		/// 実行制限に達した（run の中で投げる）
+		struct stop_t {
+			uint64_t	cycle;
+		};
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  周辺モデル（イベントを持つもの）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class model {
+		public:
+			virtual ~model() { }
+			/// 次のイベントのサイクル（無ければ NEVER）
+			virtual uint64_t next() const = 0;
+			/// イベント（t は予定のサイクル）
+			virtual void event(uint64_t t) = 0;
+		};
+
+		/// 割り込み要因
+		struct source_t {
+			const char*		name;
+			address_type	ilvl;	///< 割り込み優先レベル・レジスター
+			uint8_t			pos;	///< レベルのビット位置
+			std::function<bool ()>	req;
+			isr_type		isr;
+			uint32_t		count;	///< 受け付けた回数
+			uint64_t		cycles;	///< ISR のサイクル（受け付けを含む）
+		};
+
+	private:
+		// 時間を決めた外部からの操作（入力の変化など）
+		class sched : public model {
+			std::multimap<uint64_t, std::function<void ()> > list_;
+		public:
+			void add(uint64_t t, std::function<void ()> fn) { list_.emplace(t, fn); }
+
+			uint64_t next() const override {
+				return list_.empty() ? NEVER : list_.begin()->first;
+			}
+
+			void event(uint64_t t) override {
+				auto it = list_.begin();
+				auto fn = it->second;
+				list_.erase(it);
+				fn();
+			}
+		};
+
+		std::vector<uint8_t>	mem_;
+		std::vector<wr_hook>	wr_;
+		std::vector<rd_hook>	rd_;
+		std::vector<model*>		models_;
+		std::vector<source_t>	srcs_;
+		sched		sched_;
+		uint64_t	now_;
+		uint64_t	limit_;
+		bool		i_flag_;
+		bool		in_intr_;
+
+		static host_core*& current_() {
+			static host_core* p = nullptr;
+			return p;
+		}
+
+		uint64_t next_() const {
+			uint64_t t = limit_;
+			for(auto m : models_) {
+				auto n = m->next();
+				if(n < t) t = n;
+			}
+			return t;
+		}
+
+		void dispatch_() {
+			if(!i_flag_ || in_intr_) return;
+			for(;;) {
+				source_t* s = nullptr;
+				uint8_t lvl = 0;
+				for(auto& e : srcs_) {
+					if(e.isr == nullptr) continue;
+					uint8_t l = (mem_[e.ilvl] >> e.pos) & 3;
+					if(l > lvl && e.req()) {
+						lvl = l;
+						s = &e;
+					}
+				}
+				if(s == nullptr) break;
+				in_intr_ = true;
+				uint64_t t = now_;
+				now_ += INTR;
+				s->isr();
+				++s->count;
+				s->cycles += now_ - t;
+				in_intr_ = false;
+			}
+		}
+
+		// t まで、イベントを順に処理して進める
+		void run_(uint64_t t) {
+			for(;;) {
+				model* m = nullptr;
+				uint64_t tn = t;
+				for(auto p : models_) {
+					auto n = p->next();
+					if(n < tn || (m == nullptr && n == tn)) {
+						tn = n;
+						m = p;
+					}
+				}
+				if(m == nullptr) break;
+				if(tn > now_) now_ = tn;
+				m->event(tn);
+				dispatch_();
+			}
+			if(t > now_) now_ = t;
+			dispatch_();
+			if(now_ >= limit_) throw stop_t { now_ };
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター（最後に作ったものが、io_host_xxx の対象）
+		*/
+		//-----------------------------------------------------------------//
+		host_core() : mem_(0x10000, 0), wr_(0x10000), rd_(0x10000),
+			now_(0), limit_(NEVER), i_flag_(true), in_intr_(false) {
+			models_.push_back(&sched_);
+			current_() = this;
+		}
+
+		host_core(const host_core&) = delete;
+		host_core& operator = (const host_core&) = delete;
+
+		static host_core& get() { return *current_(); }
+
+
+		uint8_t& mem(address_type adr) { return mem_[adr]; }
+		uint8_t mem(address_type adr) const { return mem_[adr]; }
+
+		void set_wr(address_type adr, wr_hook hook) { wr_[adr] = hook; }
+		void set_rd(address_type adr, rd_hook hook) { rd_[adr] = hook; }
+		const wr_hook& get_wr(address_type adr) const { return wr_[adr]; }
+		const rd_hook& get_rd(address_type adr) const { return rd_[adr]; }
+
+		void add(model* m) { models_.push_back(m); }
+
+		void add_intr(const char* name, address_type ilvl, uint8_t pos,
+			std::function<bool ()> req, isr_type isr) {
+			srcs_.push_back(source_t { name, ilvl, pos, req, isr, 0, 0 });
+		}
+
+		const std::vector<source_t>& get_intr() const { return srcs_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  サイクル t に、fn を呼ぶ（ピン入力、受信データなど）
+			@param[in]	t	サイクル
+			@param[in]	fn	関数
+		*/
+		//-----------------------------------------------------------------//
+		void at(uint64_t t, std::function<void ()> fn) { sched_.add(t, fn); }
+
+		uint64_t now() const { return now_; }
+
+		void tick(uint32_t cycles) { run_(now_ + cycles); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスター・アクセス（アクセスの前に、時間を進める）
+		*/
+		//-----------------------------------------------------------------//
+		void wr8(address_type adr, uint8_t data) {
+			tick(ACCESS);
+			if(wr_[adr]) wr_[adr](adr, data);
+			else mem_[adr] = data;
+		}
+
+		uint8_t rd8(address_type adr) {
+			tick(ACCESS);
+			if(rd_[adr]) return rd_[adr](adr);
+			return mem_[adr];
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  待ちループ１回分（次のイベントまで進める）
+		*/
+		//-----------------------------------------------------------------//
+		void wait() {
+			uint64_t t = next_();
+			if(t <= now_) t = now_ + 1;
+			run_(t);
+		}
+
+		void delay(uint32_t cycles) { run_(now_ + cycles); }
+
+		void di() {
+			tick(DI_EI);
+			i_flag_ = false;
+		}
+
+		void ei() {
+			i_flag_ = true;
+			tick(DI_EI);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  実行（cycles を過ぎたら止める）
+			@param[in]	fn		実行する関数（サンプルの main など）
+			@param[in]	cycles	最大サイクル
+			@return 時間で止まった場合「true」（fn が戻った場合「false」）
+		*/
+		//-----------------------------------------------------------------//
+		bool run(std::function<void ()> fn, uint64_t cycles) {
+			limit_ = now_ + cycles;
+			bool stop = false;
+			try {
+				fn();
+			} catch(stop_t& s) {
+				stop = true;
+			}
+			in_intr_ = false;
+			limit_ = NEVER;
+			return stop;
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ポート・モデル（P1、P3、P4、PA）@n
+				・入力は、set_input で与えたレベル、無ければプルアップ（PUR）@n
+				・ピン毎に、エッジの数と、High の時間を数える
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_port {
+	public:
+		struct pin_t {
+			uint32_t	edges;	///< エッジの数
+			uint64_t	time;	///< 最後のエッジのサイクル
+			uint64_t	high;	///< High の時間（最後のエッジまで）
+			bool		lvl;
+		};
+
+		/// エッジ毎に呼ぶ
+		std::function<void (uint8_t no, uint8_t bit, bool lvl, uint64_t t)> on_edge;
+
+	private:
+		host_core&	core_;
+		uint8_t		in_[4];
+		uint8_t		drv_[4];
+		uint8_t		lvl_[4];
+		pin_t		pin_[4][8];
+
+		static int index_(uint8_t no) {
+			switch(no) {
+			case 1: return 0;
+			case 3: return 1;
+			case 4: return 2;
+			case 0xa: return 3;
+			default: return -1;
+			}
+		}
+
+		static address_type base_(int idx) {
+			static const address_type tbl[4] = { 0xA9, 0xAB, 0xAC, 0xAD };
+			return tbl[idx];
+		}
+
+		static uint8_t no_(int idx) {
+			static const uint8_t tbl[4] = { 1, 3, 4, 0xa };
+			return tbl[idx];
+		}
+
+		uint8_t level_(int idx) const {
+			auto base = base_(idx);
+			uint8_t dir = core_.mem(base);
+			uint8_t inp = (in_[idx] & drv_[idx]) | (core_.mem(base + 0x0C) & ~drv_[idx]);
+			return (core_.mem(base + 6) & dir) | (inp & ~dir);
+		}
+
+		void update_(int idx) {
+			uint8_t lvl = level_(idx);
+			uint8_t chg = lvl ^ lvl_[idx];
+			lvl_[idx] = lvl;
+			if(chg == 0) return;
+			auto t = core_.now();
+			for(uint8_t i = 0; i < 8; ++i) {
+				if((chg & (1 << i)) == 0) continue;
+				auto& p = pin_[idx][i];
+				if(p.lvl) p.high += t - p.time;
+				p.lvl = (lvl >> i) & 1;
+				p.time = t;
+				++p.edges;
+				if(on_edge) on_edge(no_(idx), i, p.lvl, t);
+			}
+		}
+
+	public:
+		host_port(host_core& core) : core_(core), in_{ 0 }, drv_{ 0 }, lvl_{ 0 }, pin_{ } {
+			for(int i = 0; i < 4; ++i) {
+				auto base = base_(i);
+				for(address_type a : { base, static_cast<address_type>(base + 6),
+						static_cast<address_type>(base + 0x0C) }) {
+					core_.set_wr(a, [this, i](address_type adr, uint8_t data) {
+						core_.mem(adr) = data;
+						update_(i);
+					});
+				}
+				core_.set_rd(base + 6, [this, i](address_type adr) {
+					return level_(i);
+				});
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  外部からピンを駆動する
+			@param[in]	no	ポート番号（1、3、4、0xa）
+			@param[in]	bit	ビット位置
+			@param[in]	lvl	レベル
+		*/
+		//-----------------------------------------------------------------//
+		void set_input(uint8_t no, uint8_t bit, bool lvl) {
+			int idx = index_(no);
+			if(idx < 0) return;
+			drv_[idx] |= 1 << bit;
+			if(lvl) in_[idx] |= 1 << bit;
+			else in_[idx] &= ~(1 << bit);
+			update_(idx);
+		}
+
+		void release(uint8_t no, uint8_t bit) {
+			int idx = index_(no);
+			if(idx < 0) return;
+			drv_[idx] &= ~(1 << bit);
+			update_(idx);
+		}
+
+		bool get_level(uint8_t no, uint8_t bit) const {
+			int idx = index_(no);
+			return idx >= 0 && ((level_(idx) >> bit) & 1);
+		}
+
+		const pin_t& get_pin(uint8_t no, uint8_t bit) const {
+			return pin_[index_(no) & 3][bit & 7];
+		}
+
+		/// High の時間（現在まで）
+		uint64_t get_high(uint8_t no, uint8_t bit) const {
+			const auto& p = get_pin(no, bit);
+			return p.high + (p.lvl ? core_.now() - p.time : 0);
+		}
+
+		void clear_stat() {
+			auto t = core_.now();
+			for(auto& a : pin_) {
+				for(auto& p : a) {
+					p.edges = 0;
+					p.high = 0;
+					p.time = t;
+				}
+			}
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  タイマー RB2 モデル（タイマー・モード）@n
+				TCK は、trb_io の表（f1、f2、f4、f8、f32、f64、f128）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_trb : public host_core::model {
+		enum : address_type {
+			TRBCR = 0xE0, TRBMR = 0xE3, TRBPRE = 0xE4, TRBPR = 0xE5, TRBIR = 0xE7
+		};
+
+		host_core&	core_;
+		uint64_t	next_;
+
+		uint32_t div_() const {
+			static const uint8_t sft[8] = { 0, 3, 0, 1, 2, 5, 6, 7 };
+			return 1 << sft[(core_.mem(TRBMR) >> 4) & 7];
+		}
+
+		uint64_t period_() const {
+			uint32_t pre = core_.mem(TRBPRE);
+			uint32_t pr = core_.mem(TRBPR);
+			uint32_t n;
+			if(core_.mem(TRBMR) & 0x04) n = ((pr << 8) | pre) + 1;  // TCNT16
+			else n = (pre + 1) * (pr + 1);
+			return static_cast<uint64_t>(n) * div_();
+		}
+
+		uint16_t count_() const {
+			uint32_t d = div_();
+			uint64_t n = (next_ - core_.now() + d - 1) / d;
+			return n ? n - 1 : 0;
+		}
+
+	public:
+		uint32_t	underflow;	///< アンダーフローの回数
+
+		host_trb(host_core& core) : core_(core), next_(host_core::NEVER), underflow(0) {
+			core_.mem(TRBPRE) = 0xFF;
+			core_.mem(TRBPR) = 0xFF;
+			core_.set_wr(TRBCR, [this](address_type adr, uint8_t data) {
+				bool run = (data & 0x01) != 0 && (data & 0x04) == 0;
+				core_.mem(adr) = run ? 0x03 : 0x00;
+				if(!run) next_ = host_core::NEVER;
+				else if(next_ == host_core::NEVER) next_ = core_.now() + period_();
+			});
+			for(address_type a : { TRBPRE, TRBPR }) {
+				core_.set_rd(a, [this](address_type adr) {
+					if(next_ == host_core::NEVER || (core_.mem(TRBMR) & 0x04) == 0) {
+						return core_.mem(adr);
+					}
+					auto n = count_();
+					return static_cast<uint8_t>(adr == TRBPRE ? n & 0xff : n >> 8);
+				});
+			}
+			core_.set_wr(TRBIR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				r = (data & ~0x40) | (r & data & 0x40);  // TRBIF は 0 書き込みでクリア
+			});
+			core_.add(this);
+			core_.add_intr("TRB", 0x4C, 0, [this]() {
+				return (core_.mem(TRBIR) & 0xC0) == 0xC0;
+			}, TIMER_RB_intr);
+		}
+
+		uint64_t next() const override { return next_; }
+
+		void event(uint64_t t) override {
+			core_.mem(TRBIR) |= 0x40;
+			++underflow;
+			next_ = t + period_();
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  タイマー RJ2 モデル（タイマー・モード、パルス出力モード）@n
+				TRJ はリロード値で、アンダーフロー毎に TUNDF、TRJIF
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_trj : public host_core::model {
+		enum : address_type {
+			TRJ = 0xD8, TRJCR = 0xDA, TRJMR = 0xDC, TRJIR = 0xDE
+		};
+
+		host_core&	core_;
+		uint64_t	next_;
+
+		uint32_t div_() const {
+			switch((core_.mem(TRJMR) >> 4) & 7) {
+			case 0b001: return 8;
+			case 0b011: return 2;
+			default: return 1;
+			}
+		}
+
+		uint64_t period_() const {
+			uint32_t n = (core_.mem(TRJ) | (core_.mem(TRJ + 1) << 8)) + 1;
+			return static_cast<uint64_t>(n) * div_();
+		}
+
+		bool timer_() const { return (core_.mem(TRJMR) & 7) <= 1; }
+
+	public:
+		uint32_t	underflow;	///< アンダーフローの回数
+
+		host_trj(host_core& core) : core_(core), next_(host_core::NEVER), underflow(0) {
+			core_.set_wr(TRJCR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				bool run = (data & 0x01) != 0 && (data & 0x04) == 0;
+				r = (data & 0x01) | (r & data & 0x30) | (run ? 0x02 : 0x00);  // TEDGF、TUNDF は 0 書き込みでクリア
+				if(!run) next_ = host_core::NEVER;
+				else if(next_ == host_core::NEVER && timer_()) next_ = core_.now() + period_();
+			});
+			for(address_type a = TRJ; a < TRJ + 2; ++a) {
+				core_.set_rd(a, [this](address_type adr) {
+					if(next_ == host_core::NEVER) return core_.mem(adr);
+					uint32_t d = div_();
+					uint64_t n = (next_ - core_.now() + d - 1) / d;
+					if(n) --n;
+					return static_cast<uint8_t>(adr == TRJ ? n & 0xff : n >> 8);
+				});
+			}
+			core_.set_wr(TRJIR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				r = (data & ~0x40) | (r & data & 0x40);
+			});
+			core_.add(this);
+			core_.add_intr("TRJ", 0x4B, 0, [this]() {
+				return (core_.mem(TRJIR) & 0xC0) == 0xC0;
+			}, TIMER_RJ_intr);
+		}
+
+		uint64_t next() const override { return next_; }
+
+		void event(uint64_t t) override {
+			core_.mem(TRJCR) |= 0x20;
+			core_.mem(TRJIR) |= 0x40;
+			++underflow;
+			next_ = t + period_();
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  タイマー RC モデル（カウンターと、コンペア・マッチ A ～ D）@n
+				・CCLR なら、TRCGRA のマッチでクリア、そうでなければ @n
+				　オーバーフロー（OVF）@n
+				・出力端子（TRCIOA ～ D）は扱わない
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_trc : public host_core::model {
+		enum : address_type {
+			TRCCNT = 0xE8, TRCGRA = 0xEA, TRCMR = 0xF2, TRCCR1 = 0xF3,
+			TRCIER = 0xF4, TRCSR = 0xF5
+		};
+
+		host_core&	core_;
+		uint64_t	t0_;	///< c0_ のサイクル（カウント・クロックの境界）
+		uint32_t	c0_;
+		uint64_t	next_;
+		bool		run_;
+
+		uint32_t gr_(int ch) const {
+			address_type a = TRCGRA + ch * 2;
+			return core_.mem(a) | (core_.mem(a + 1) << 8);
+		}
+
+		bool cclr_() const { return (core_.mem(TRCCR1) & 0x80) != 0; }
+
+		uint32_t div_() const {
+			static const uint8_t sft[8] = { 0, 1, 2, 3, 5, 0, 0, 0 };
+			return 1 << sft[(core_.mem(TRCCR1) >> 4) & 7];
+		}
+
+		uint32_t mod_() const { return cclr_() ? gr_(0) + 1 : 0x10000; }
+
+		void rebase_(uint64_t t) {
+			if(!run_) return;
+			uint32_t d = div_();
+			uint64_t n = (t - t0_) / d;
+			c0_ = (c0_ + n) % mod_();
+			t0_ += n * d;
+		}
+
+		void schedule_() {
+			next_ = host_core::NEVER;
+			if(!run_) return;
+			uint32_t m = mod_();
+			uint64_t k = cclr_() ? host_core::NEVER : 0x10000 - c0_;  // オーバーフロー
+			for(int ch = 0; ch < 4; ++ch) {
+				uint32_t g = gr_(ch);
+				if(g >= m) continue;
+				uint64_t n = (g + m - c0_ % m) % m;
+				if(n == 0) n = m;
+				if(n < k) k = n;
+			}
+			if(k != host_core::NEVER) next_ = t0_ + k * div_();
+		}
+
+		uint32_t count_() const {
+			if(!run_) return core_.mem(TRCCNT) | (core_.mem(TRCCNT + 1) << 8);
+			return (c0_ + (core_.now() - t0_) / div_()) % mod_();
+		}
+
+		// 設定を変える前に、現在のカウントまで進めて、変えた後に予定を作り直す
+		void modify_(address_type adr, uint8_t data) {
+			rebase_(core_.now());
+			core_.mem(adr) = data;
+			schedule_();
+		}
+
+	public:
+		host_trc(host_core& core) : core_(core), t0_(0), c0_(0), next_(host_core::NEVER),
+			run_(false) {
+			core_.set_wr(TRCMR, [this](address_type adr, uint8_t data) {
+				bool run = (data & 0x80) != 0;
+				if(run && !run_) {
+					t0_ = core_.now();
+					c0_ = core_.mem(TRCCNT) | (core_.mem(TRCCNT + 1) << 8);
+				} else if(!run && run_) {
+					auto c = count_();
+					core_.mem(TRCCNT) = c & 0xff;
+					core_.mem(TRCCNT + 1) = c >> 8;
+				}
+				run_ = run;
+				core_.mem(adr) = data;
+				schedule_();
+			});
+			for(address_type a = TRCCNT; a < TRCCNT + 2; ++a) {
+				core_.set_wr(a, [this](address_type adr, uint8_t data) {
+					core_.mem(adr) = data;
+					if(run_) {
+						t0_ = core_.now();
+						c0_ = core_.mem(TRCCNT) | (core_.mem(TRCCNT + 1) << 8);
+						schedule_();
+					}
+				});
+				core_.set_rd(a, [this](address_type adr) {
+					auto c = count_();
+					return static_cast<uint8_t>(adr == TRCCNT ? c & 0xff : c >> 8);
+				});
+			}
+			for(address_type a = TRCGRA; a < TRCGRA + 8; ++a) {
+				core_.set_wr(a, [this](address_type adr, uint8_t data) { modify_(adr, data); });
+			}
+			core_.set_wr(TRCCR1, [this](address_type adr, uint8_t data) { modify_(adr, data); });
+			core_.set_wr(TRCSR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				r = (data & ~0x8F) | (r & data & 0x8F);
+			});
+			core_.add(this);
+			core_.add_intr("TRC", 0x43, 4, [this]() {
+				return (core_.mem(TRCSR) & core_.mem(TRCIER) & 0x8F) != 0;
+			}, TIMER_RC_intr);
+		}
+
+		uint64_t next() const override { return next_; }
+
+		void event(uint64_t t) override {
+			rebase_(t);
+			auto& sr = core_.mem(TRCSR);
+			for(int ch = 0; ch < 4; ++ch) {
+				if(gr_(ch) == c0_) sr |= 1 << ch;
+			}
+			if(!cclr_() && c0_ == 0) sr |= 0x80;
+			schedule_();
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  UART0 モデル @n
+				・調歩同期（SMD = 101）と、クロック同期（SMD = 001）@n
+				・送信バッファ、送信シフト・レジスター、TI、TXEPT、UTIF @n
+				・受信は、input で与えたデータを、１フレーム毎に URB へ @n
+				　（RI、URIF、オーバーラン）@n
+				・送信したデータは、get_send で取り出す
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_uart : public host_core::model {
+		enum : address_type {
+			UMR = 0x80, UBRG, UTBL, UTBH, UC0, UC1, URBL, URBH, UIR
+		};
+
+		host_core&	core_;
+		std::string	send_;
+		std::string	recv_;
+		uint64_t	tx_end_;
+		uint64_t	rx_next_;
+		uint16_t	urb_;
+		uint8_t		shift_;
+		uint8_t		buf_;
+		bool		buf_full_;
+		bool		shifting_;
+		bool		ri_;
+
+		bool sync_() const { return (core_.mem(UMR) & 7) == 0b001; }
+		bool re_() const { return (core_.mem(UC1) & 0x04) != 0; }
+
+		uint64_t bit_() const {
+			static const uint8_t sft[4] = { 0, 3, 5, 5 };
+			uint64_t n = static_cast<uint64_t>(core_.mem(UBRG) + 1) << sft[core_.mem(UC0) & 3];
+			return sync_() ? n * 2 : n * 16;
+		}
+
+		uint32_t bits_() const {
+			if(sync_()) return 8;
+			uint8_t m = core_.mem(UMR);
+			return 1 + 8 + ((m >> 6) & 1) + ((m & 0x10) ? 2 : 1);
+		}
+
+		void start_tx_(uint64_t t, uint8_t data) {
+			shift_ = data;
+			shifting_ = true;
+			tx_end_ = t + frame();
+			core_.mem(UIR) |= 0x80;  // UTIF（送信バッファ空）
+		}
+
+		void receive_(uint8_t data) {
+			if(ri_) {
+				urb_ |= 0x9000;  // OER、SUM
+				++overrun;
+			} else {
+				urb_ = data;
+				ri_ = true;
+			}
+			core_.mem(UIR) |= 0x40;  // URIF
+		}
+
+		void schedule_rx_() {
+			if(rx_next_ == host_core::NEVER && re_() && !sync_() && !recv_.empty()) {
+				rx_next_ = core_.now() + frame();
+			}
+		}
+
+	public:
+		/// 送信したデータ毎に呼ぶ
+		std::function<void (char ch, uint64_t t)> on_send;
+		/// クロック同期形の受信データ（無ければ 0xFF）
+		std::function<uint8_t (uint8_t data)> on_xchg;
+		uint32_t	overrun;
+
+		host_uart(host_core& core) : core_(core), tx_end_(host_core::NEVER),
+			rx_next_(host_core::NEVER), urb_(0), shift_(0), buf_(0), buf_full_(false),
+			shifting_(false), ri_(false), overrun(0) {
+			core_.set_wr(UTBL, [this](address_type adr, uint8_t data) {
+				if((core_.mem(UC1) & 0x01) == 0) return;  // TE
+				if(!shifting_) start_tx_(core_.now(), data);
+				else {
+					buf_ = data;
+					buf_full_ = true;
+				}
+			});
+			core_.set_wr(UC0, [this](address_type adr, uint8_t data) {
+				core_.mem(adr) = data & ~0x08;
+			});
+			core_.set_rd(UC0, [this](address_type adr) {
+				return static_cast<uint8_t>(core_.mem(adr) | ((!shifting_ && !buf_full_) << 3));
+			});
+			core_.set_wr(UC1, [this](address_type adr, uint8_t data) {
+				core_.mem(adr) = data & 0x35;
+				if(!re_()) {
+					ri_ = false;
+					urb_ = 0;
+					rx_next_ = host_core::NEVER;
+				}
+				schedule_rx_();
+			});
+			core_.set_rd(UC1, [this](address_type adr) {
+				return static_cast<uint8_t>(core_.mem(adr) | (!buf_full_ << 1) | (ri_ << 3));
+			});
+			core_.set_rd(URBL, [this](address_type adr) {
+				ri_ = false;
+				return static_cast<uint8_t>(urb_ & 0xff);
+			});
+			core_.set_rd(URBH, [this](address_type adr) {
+				return static_cast<uint8_t>(urb_ >> 8);
+			});
+			core_.set_wr(UIR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				r = (data & ~0xC0) | (r & data & 0xC0);  // URIF、UTIF は 0 書き込みでクリア
+			});
+			core_.add(this);
+			core_.add_intr("UART0 TX", 0x48, 4, [this]() {
+				return (core_.mem(UIR) & 0x88) == 0x88;
+			}, UART0_TX_intr);
+			core_.add_intr("UART0 RX", 0x49, 0, [this]() {
+				return (core_.mem(UIR) & 0x44) == 0x44;
+			}, UART0_RX_intr);
+		}
+
+
+		/// １フレームのサイクル
+		uint64_t frame() const { return bit_() * bits_(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信データを与える（１フレーム毎に受信する）
+			@param[in]	str	データ
+		*/
+		//-----------------------------------------------------------------//
+		void input(const std::string& str) {
+			recv_ += str;
+			schedule_rx_();
+		}
+
+		const std::string& get_send() const { return send_; }
+
+		void clear_send() { send_.clear(); }
+
+		uint64_t next() const override { return tx_end_ < rx_next_ ? tx_end_ : rx_next_; }
+
+		void event(uint64_t t) override {
+			if(t == tx_end_) {
+				char ch = static_cast<char>(shift_);
+				send_ += ch;
+				if(on_send) on_send(ch, t);
+				if(sync_() && re_()) receive_(on_xchg ? on_xchg(shift_) : 0xFF);
+				shifting_ = false;
+				tx_end_ = host_core::NEVER;
+				if(buf_full_) {
+					buf_full_ = false;
+					start_tx_(t, buf_);
+				}
+			} else {
+				receive_(recv_[0]);
+				recv_.erase(0, 1);
+				rx_next_ = recv_.empty() ? host_core::NEVER : t + frame();
+			}
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  A/D 変換モデル @n
+				・単発、繰り返し、単掃引、繰り返し掃引（掃引は２チャネル）@n
+				・１チャネルの変換は、CONV サイクル（φAD）@n
+				・入力は、set で与えた値、又は on_input（10 ビット）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_adc : public host_core::model {
+		enum : address_type {
+			AD0 = 0x98, AD1 = 0x9A, ADMOD = 0x9C, ADINSEL, ADCON0, ADICSR
+		};
+
+		host_core&	core_;
+		uint64_t	end_;
+		uint16_t	an_[8];
+
+		bool sweep_() const { return (core_.mem(ADMOD) & 0x10) != 0; }
+		bool repeat_() const { return (core_.mem(ADMOD) & 0x08) != 0; }
+
+		uint8_t chanel_(bool second) const {
+			static const uint8_t tbl[3][2] = { { 0, 1 }, { 2, 3 }, { 4, 7 } };
+			uint8_t g = core_.mem(ADINSEL) >> 6;
+			if(g > 2) g = 2;
+			return tbl[g][second];
+		}
+
+		uint64_t time_() const {
+			static const uint8_t sft[8] = { 3, 2, 1, 0, 0, 0, 0, 0 };  // f8、f4、f2、f1
+			uint64_t n = static_cast<uint64_t>(CONV) << sft[core_.mem(ADMOD) & 7];
+			return sweep_() ? n * 2 : n;
+		}
+
+		void store_(address_type adr, uint8_t an, uint64_t t) {
+			uint16_t v = (on_input ? on_input(an, t) : an_[an]) & 0x3ff;
+			core_.mem(adr) = v & 0xff;
+			core_.mem(adr + 1) = v >> 8;
+		}
+
+	public:
+		static constexpr uint32_t CONV = 43;
+
+		/// 変換毎に呼ぶ（AN 番号、サイクル）
+		std::function<uint16_t (uint8_t an, uint64_t t)> on_input;
+		uint32_t	count;	///< 変換（掃引）の回数
+
+		host_adc(host_core& core) : core_(core), end_(host_core::NEVER), an_{ 0 }, count(0) {
+			core_.set_wr(ADCON0, [this](address_type adr, uint8_t data) {
+				core_.mem(adr) = data;
+				if((data & 0x01) == 0) end_ = host_core::NEVER;
+				else if(end_ == host_core::NEVER) end_ = core_.now() + time_();
+			});
+			core_.set_wr(ADICSR, [this](address_type adr, uint8_t data) {
+				auto& r = core_.mem(adr);
+				r = (data & ~0x80) | (r & data & 0x80);  // ADF は 0 書き込みでクリア
+			});
+			core_.add(this);
+			core_.add_intr("ADC", 0x47, 0, [this]() {
+				return (core_.mem(ADICSR) & 0xC0) == 0xC0;
+			}, ADC_intr);
+		}
+
+		void set(uint8_t an, uint16_t value) { an_[an & 7] = value; }
+
+		uint64_t next() const override { return end_; }
+
+		void event(uint64_t t) override {
+			if(sweep_()) {
+				store_(AD0, chanel_(false), t);
+				store_(AD1, chanel_(true), t);
+			} else {
+				bool ch = core_.mem(ADINSEL) & 0x01;
+				store_(ch ? AD1 : AD0, chanel_(ch), t);
+			}
+			++count;
+			core_.mem(ADICSR) |= 0x80;
+			if(repeat_()) {
+				end_ = t + time_();
+			} else {
+				end_ = host_core::NEVER;
+				core_.mem(ADCON0) &= ~0x01;
+			}
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ホスト・シミュレーター（R8C/M120AN）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class host_io : public host_core {
+	public:
+		host_port	port;
+		host_trb	trb;
+		host_trj	trj;
+		host_trc	trc;
+		host_uart	uart;
+		host_adc	adc;
+
+		host_io() : host_core(), port(*this), trb(*this), trj(*this), trc(*this),
+			uart(*this), adc(*this) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  割り込みの統計を表示
+		*/
+		//-----------------------------------------------------------------//
+		void list_intr() const {
+			double sec = static_cast<double>(now()) / F_CLK;
+			for(const auto& s : get_intr()) {
+				if(s.count == 0) continue;
+				std::printf("  %-9s %8u intr, %7.2f us/intr, load %5.2f %%\n", s.name,
+					s.count, static_cast<double>(s.cycles) * 1e6 / F_CLK / s.count,
+					sec > 0 ? static_cast<double>(s.cycles) * 100.0 / F_CLK / sec : 0.0);
+			}
+		}
+	};
+
+
+	void io_host_wr8(address_type adr, uint8_t data) { host_core::get().wr8(adr, data); }
+
+	uint8_t io_host_rd8(address_type adr) { return host_core::get().rd8(adr); }
+
+	void io_host_wait() { host_core::get().wait(); }
+
+	void io_host_delay(uint32_t cycles) { host_core::get().delay(cycles); }
+}
+
+
+extern "C" {
+
+	void di(void) { device::host_core::get().di(); }
+
+	void ei(void) { device::host_core::get().ei(); }
+
+
+	// common/syscalls.c と同じく、stdout、stderr は sci_putch、stdin は sci_getch
+	ssize_t write(int fd, const void* buf, size_t len)
+	{
+		if(fd != 1 && fd != 2) return -1;
+		auto p = static_cast<const char*>(buf);
+		for(size_t i = 0; i < len; ++i) {
+			if(sci_putch) sci_putch(p[i]);
+			else std::fputc(p[i], stdout);
+		}
+		return len;
+	}
+
+
+	ssize_t read(int fd, void* buf, size_t len)
+	{
+		if(fd != 0 || sci_getch == nullptr) return -1;
+		auto p = static_cast<char*>(buf);
+		for(size_t i = 0; i < len; ++i) {
+			p[i] = sci_getch();
+		}
+		return len;
+	}
+}
@@ -0,0 +1,252 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト用 PLOT クラスと、フレーム出力（PBM/PNG） @n
+			・host_plot は、１ドット１バイトの単純なフレームバッファで、@n
+			　拡張機能（hspan/vspan/blit_bits）を持たない、描画の基準 @n
+			・write_pbm/write_png/read_pbm は、get(x, y) を持つ PLOT に使える
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "common/monograph.hpp"
+
+namespace graphics {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ホスト用プロット・クラス
+		@param[in]	W	横幅
+		@param[in]	H	高さ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <int16_t W, int16_t H>
+	class host_plot {
+	public:
+		typedef int16_t value_type;
+
+		static const int16_t WIDTH  = W;
+		static const int16_t HEIGHT = H;
+
+	private:
+		uint8_t		fb_[W * H];
+
+	public:
+		host_plot() { clear(); }
+
+		void clear(uint8_t v = 0) { std::memset(fb_, v ? 1 : 0, sizeof(fb_)); }
+
+		bool get(int16_t x, int16_t y) const
+		{
+			if(x < 0 || x >= W) return false;
+			if(y < 0 || y >= H) return false;
+			return fb_[y * W + x] != 0;
+		}
+
+		void operator() (int16_t x, int16_t y, bool val)
+		{
+			if(x < 0 || x >= W) return;
+			if(y < 0 || y >= H) return;
+			fb_[y * W + x] = val;
+		}
+	};
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	２つの PLOT の内容を比較
+		@param[in]	a	PLOT
+		@param[in]	b	PLOT
+		@return 異なるドット数
+	*/
+	//-----------------------------------------------------------------//
+	template <class PA, class PB>
+	uint32_t compare_plot(const PA& a, const PB& b)
+	{
+		static_assert(PA::WIDTH == PB::WIDTH && PA::HEIGHT == PB::HEIGHT, "size mismatch");
+		uint32_t n = 0;
+		for(int16_t y = 0; y < PA::HEIGHT; ++y) {
+			for(int16_t x = 0; x < PA::WIDTH; ++x) {
+				if(a.get(x, y) != b.get(x, y)) ++n;
+			}
+		}
+		return n;
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	PBM（P4）形式で書き出す（点がある所が黒）
+		@param[in]	file	ファイル名
+		@param[in]	plot	PLOT
+		@return 成功なら「true」
+	*/
+	//-----------------------------------------------------------------//
+	template <class PLOT>
+	bool write_pbm(const char* file, const PLOT& plot)
+	{
+		FILE* fp = std::fopen(file, "wb");
+		if(fp == nullptr) return false;
+		std::fprintf(fp, "P4\n%d %d\n", PLOT::WIDTH, PLOT::HEIGHT);
+		for(int16_t y = 0; y < PLOT::HEIGHT; ++y) {
+			uint8_t d = 0;
+			for(int16_t x = 0; x < PLOT::WIDTH; ++x) {
+				if(plot.get(x, y)) d |= 0x80 >> (x & 7);
+				if((x & 7) == 7 || x == (PLOT::WIDTH - 1)) {
+					std::fputc(d, fp);
+					d = 0;
+				}
+			}
+		}
+		std::fclose(fp);
+		return true;
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	PBM（P4）形式を読み込んで、PLOT と比較
+		@param[in]	file	ファイル名
+		@param[in]	plot	PLOT
+		@param[out]	diff	異なるドット数
+		@return 読み込めて、サイズが一致すれば「true」
+	*/
+	//-----------------------------------------------------------------//
+	template <class PLOT>
+	bool compare_pbm(const char* file, const PLOT& plot, uint32_t& diff)
+	{
+		diff = 0;
+		FILE* fp = std::fopen(file, "rb");
+		if(fp == nullptr) return false;
+		int w = 0;
+		int h = 0;
+		bool ok = std::fscanf(fp, "P4 %d %d", &w, &h) == 2 && std::fgetc(fp) != EOF;
+		ok = ok && w == PLOT::WIDTH && h == PLOT::HEIGHT;
+		for(int16_t y = 0; ok && y < h; ++y) {
+			int d = 0;
+			for(int16_t x = 0; x < w; ++x) {
+				if((x & 7) == 0) {
+					d = std::fgetc(fp);
+					if(d == EOF) {
+						ok = false;
+						break;
+					}
+				}
+				bool b = d & (0x80 >> (x & 7));
+				if(b != plot.get(x, y)) ++diff;
+			}
+		}
+		std::fclose(fp);
+		return ok;
+	}
+
+
+	namespace png_ {
+
+		inline uint32_t crc32(uint32_t crc, const uint8_t* p, size_t n)
+		{
+			crc = ~crc;
+			while(n > 0) {
+				crc ^= *p++;
+				for(int i = 0; i < 8; ++i) {
+					crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+				}
+				--n;
+			}
+			return ~crc;
+		}
+
+		inline void put32(std::vector<uint8_t>& out, uint32_t v)
+		{
+			out.push_back(v >> 24);
+			out.push_back(v >> 16);
+			out.push_back(v >> 8);
+			out.push_back(v);
+		}
+
+		inline void chunk(FILE* fp, const char* type, const std::vector<uint8_t>& data)
+		{
+			std::vector<uint8_t> t;
+			put32(t, data.size());
+			t.insert(t.end(), type, type + 4);
+			t.insert(t.end(), data.begin(), data.end());
+			put32(t, crc32(0, &t[4], t.size() - 4));
+			std::fwrite(&t[0], 1, t.size(), fp);
+		}
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	PNG（１ビット・グレー、無圧縮 deflate）形式で書き出す @n
+				（点がある所が黒）
+		@param[in]	file	ファイル名
+		@param[in]	plot	PLOT
+		@return 成功なら「true」
+	*/
+	//-----------------------------------------------------------------//
+	template <class PLOT>
+	bool write_png(const char* file, const PLOT& plot)
+	{
+		// フィルター・バイト＋ライン
+		std::vector<uint8_t> raw;
+		for(int16_t y = 0; y < PLOT::HEIGHT; ++y) {
+			raw.push_back(0);
+			uint8_t d = 0;
+			for(int16_t x = 0; x < PLOT::WIDTH; ++x) {
+				if(!plot.get(x, y)) d |= 0x80 >> (x & 7);
+				if((x & 7) == 7 || x == (PLOT::WIDTH - 1)) {
+					raw.push_back(d);
+					d = 0;
+				}
+			}
+		}
+
+		// zlib（無圧縮ブロック）
+		std::vector<uint8_t> z;
+		z.push_back(0x78);
+		z.push_back(0x01);
+		size_t pos = 0;
+		do {
+			size_t n = raw.size() - pos;
+			if(n > 0xffff) n = 0xffff;
+			z.push_back((pos + n) >= raw.size() ? 1 : 0);
+			z.push_back(n);
+			z.push_back(n >> 8);
+			z.push_back(~n);
+			z.push_back(~n >> 8);
+			z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+			pos += n;
+		} while(pos < raw.size());
+		uint32_t a = 1;
+		uint32_t b = 0;
+		for(auto c : raw) {
+			a = (a + c) % 65521;
+			b = (b + a) % 65521;
+		}
+		png_::put32(z, (b << 16) | a);
+
+		FILE* fp = std::fopen(file, "wb");
+		if(fp == nullptr) return false;
+		static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+		std::fwrite(sig, 1, sizeof(sig), fp);
+		std::vector<uint8_t> ihdr;
+		png_::put32(ihdr, PLOT::WIDTH);
+		png_::put32(ihdr, PLOT::HEIGHT);
+		ihdr.push_back(1);  // bit depth
+		ihdr.push_back(0);  // grayscale
+		ihdr.push_back(0);
+		ihdr.push_back(0);
+		ihdr.push_back(0);
+		png_::chunk(fp, "IHDR", ihdr);
+		png_::chunk(fp, "IDAT", z);
+		png_::chunk(fp, "IEND", std::vector<uint8_t>());
+		std::fclose(fp);
+		return true;
+	}
+}
@@ -0,0 +1,497 @@
+//=====================================================================//
+/*!	@file
+	@brief	I2C（iica_io、iica_trj）と、センサー・ドライバーのベンチマーク @n
+			・IO_HOST で、SDA/SCL のポート・レジスターを、I2C バスのモデル @n
+			　（オープン・ドレイン、スタート／ストップ検出、クロック・ストレッチ）@n
+			　と、レジスター・ファイルを持つスレーブ（MPU6050、BMP280）に繋ぐ @n
+			・従来のアクセス（レジスター毎に send + recv）と、バースト・リード @n
+			　（リピーテッド・スタート）の、スタート数、ストップ（トランザクション）数、@n
+			　SCL クロック数を比べる @n
+			・iica_trj は、TimerRJ の割り込みをモデル化して、転送時間と、@n
+			　割り込みで使う CPU の割合を表示 @n
+			・iica_io の転送時間は、ポート・アクセスと、delay のループだけで、@n
+			　IICA_EDGE_CYCLES の内、ポート以外の命令は数えない（SCL の速度の目安） @n
+			・読み出した値を確認（不一致があれば終了コード１）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#define IO_HOST
+#pragma GCC diagnostic ignored "-Wunused-variable"  // レジスター定義（サンプルの Makefile と同じ）
+#include "M120AN/port.hpp"
+#include "common/iica_io.hpp"
+#include "common/iica_trj.hpp"
+#include "chip/MPU6050.hpp"
+#include "chip/BMP280.hpp"
+
+namespace {
+
+	static const uint32_t ACCESS = 3;		///< レジスター・アクセスのサイクル（命令を含む）
+	static const uint32_t ISR_ENTRY = 40;	///< 割り込みの受付、レジスター退避、復帰
+
+	static const uint16_t SDA_BASE = 0x00AC;	///< PORT4（B5）
+	static const uint8_t  SDA_BIT  = 5;
+	static const uint16_t SCL_BASE = 0x00A9;	///< PORT1（B7）
+	static const uint8_t  SCL_BIT  = 7;
+	static const uint16_t TRJCR_ADR = 0x00DA;
+
+	uint8_t reg_[0x10000];	///< レジスター（書き込んだ値）
+
+	bool bit_(uint16_t adr, uint8_t bit) { return (reg_[adr] >> bit) & 1; }
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  レジスター・ファイルのスレーブ（先頭バイトがレジスター番号、@n
+				アクセス毎に自動インクリメント）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct reg_dev {
+		uint8_t		adr;
+		uint8_t		reg[256];
+		uint8_t		ptr;
+	};
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C バス・モデル
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct bus_model {
+		enum class state : uint8_t { idle, addr, write, read, ignore };
+
+		reg_dev*	dev[2];
+		reg_dev*	cur;
+		state		st;
+		uint8_t		bit;
+		uint8_t		shift;
+		bool		first;		///< 書き込みの最初のバイト（レジスター番号）
+		bool		mack;		///< マスターの ACK
+		bool		sda_low;	///< スレーブが SDA を Low にする
+		bool		scl_low;	///< クロック・ストレッチ
+		uint8_t		stretch;	///< アドレスの後のストレッチ（SCL の読み出し回数）
+		uint8_t		stretch_cnt;
+		bool		scl;
+		bool		sda;
+
+		uint32_t	starts;
+		uint32_t	stops;
+		uint32_t	clocks;
+		uint32_t	error;
+
+		void reset() {
+			cur = nullptr;
+			st = state::idle;
+			bit = 0;
+			sda_low = false;
+			scl_low = false;
+			stretch_cnt = 0;
+			scl = true;
+			sda = true;
+			starts = 0;
+			stops = 0;
+			clocks = 0;
+			error = 0;
+		}
+
+		bool master_(uint16_t base, uint8_t b) const {
+			return !(bit_(base, b) && !bit_(base + 6, b));  // 出力で Low なら Low
+		}
+
+		bool sda_line() const { return master_(SDA_BASE, SDA_BIT) && !sda_low; }
+		bool scl_line() const { return master_(SCL_BASE, SCL_BIT) && !scl_low; }
+
+		void drive_() {
+			sda_low = st == state::read && ((shift >> (7 - bit)) & 1) == 0;
+		}
+
+		void byte_() {
+			if(st == state::addr) {
+				cur = nullptr;
+				for(auto d : dev) if(d != nullptr && d->adr == (shift >> 1)) cur = d;
+				if(cur == nullptr) {
+					st = state::ignore;
+					return;
+				}
+				sda_low = true;
+				st = (shift & 1) ? state::read : state::write;
+				first = true;
+				if(st == state::read) {
+					shift = cur->reg[cur->ptr++];
+				}
+				stretch_cnt = stretch;  // ACK の後、SCL を Low に保つ
+			} else if(st == state::write) {
+				if(first) cur->ptr = shift;
+				else cur->reg[cur->ptr++] = shift;
+				first = false;
+				sda_low = true;
+			}
+		}
+
+		void rise_() {
+			++clocks;
+			if(st == state::idle || st == state::ignore) return;
+			if(bit < 8) {
+				if(st != state::read) shift = (shift << 1) | sda;
+			} else if(st == state::read) {
+				mack = !sda;
+			}
+			++bit;
+		}
+
+		void fall_() {
+			if(st == state::idle || st == state::ignore) return;
+			if(bit == 8) {
+				if(st == state::read) sda_low = false;  // マスターの ACK
+				else byte_();
+			} else if(bit == 9) {
+				bit = 0;
+				sda_low = false;
+				if(stretch_cnt > 0) scl_low = true;
+				if(st == state::read) {
+					if(first) {
+						first = false;
+					} else if(mack) {
+						shift = cur->reg[cur->ptr++];
+					} else {
+						st = state::ignore;
+						return;
+					}
+					drive_();
+				}
+			} else if(st == state::read && bit > 0) {
+				drive_();
+			}
+		}
+
+		void eval() {
+			bool c = scl_line();
+			bool d = sda_line();
+			if(c && scl && d != sda) {
+				if(!d) {  // スタート
+					++starts;
+					st = state::addr;
+					bit = 0;
+					shift = 0;
+				} else {  // ストップ
+					++stops;
+					st = state::idle;
+				}
+				sda_low = false;
+			}
+			sda = d;
+			if(c != scl) {
+				scl = c;
+				if(c) rise_();
+				else fall_();
+				sda = sda_line();
+			}
+		}
+
+		void read_scl() {
+			if(scl_low && !bit_(SCL_BASE, SCL_BIT)) {  // 入力で読んでいる
+				if(stretch_cnt > 1) --stretch_cnt;
+				else {
+					stretch_cnt = 0;
+					scl_low = false;
+					eval();
+				}
+			}
+		}
+	};
+
+	bus_model bus_;
+
+	// TimerRJ と時間
+	uint64_t now_ = 0;
+	uint64_t next_ = 0;
+	uint64_t isr_cycles_ = 0;
+	bool in_isr_ = false;
+
+	typedef device::PORT<device::PORT4, device::bitpos::B5> SDA;
+	typedef device::PORT<device::PORT1, device::bitpos::B7> SCL;
+
+	typedef device::iica_io<SDA, SCL> IICA;
+	typedef device::iica_trj<SDA, SCL> IICA_TRJ;
+	IICA_TRJ trj_;
+
+	void tick_()
+	{
+		now_ += ACCESS;
+		if(in_isr_ || !bit_(TRJCR_ADR, 0)) return;
+		uint32_t period = (reg_[0x00D8] | (reg_[0x00D9] << 8)) + 1;
+		while(bit_(TRJCR_ADR, 0) && now_ >= next_) {
+			next_ += period;
+			in_isr_ = true;
+			uint64_t t = now_;
+			now_ += ISR_ENTRY;
+			trj_.itask();
+			isr_cycles_ += now_ - t;
+			in_isr_ = false;
+		}
+	}
+}
+
+
+extern "C" {
+	void di(void) { now_ += 2; }
+	void ei(void) { now_ += 2; }
+}
+
+
+namespace device {
+
+	void io_host_wr8(address_type adr, uint8_t data)
+	{
+		reg_[adr] = data;
+		if(adr == SDA_BASE || adr == SDA_BASE + 6 || adr == SCL_BASE || adr == SCL_BASE + 6) {
+			bus_.eval();
+		}
+		if(adr == TRJCR_ADR) {
+			if((data & 1) == 0) next_ = 0;
+			else if(next_ == 0) next_ = now_ + (reg_[0x00D8] | (reg_[0x00D9] << 8)) + 1;  // カウント開始
+		}
+		tick_();
+	}
+
+
+	uint8_t io_host_rd8(address_type adr)
+	{
+		uint8_t v = reg_[adr];
+		if(adr == SCL_BASE + 6) {
+			bus_.read_scl();
+			if(!bit_(SCL_BASE, SCL_BIT)) {
+				v = (v & ~(1 << SCL_BIT)) | (bus_.scl_line() << SCL_BIT);
+			}
+		}
+		if(adr == SDA_BASE + 6 && !bit_(SDA_BASE, SDA_BIT)) {
+			v = (v & ~(1 << SDA_BIT)) | (bus_.sda_line() << SDA_BIT);
+		}
+		tick_();
+		return v;
+	}
+
+
+	void io_host_wait() { tick_(); }
+
+	void io_host_delay(uint32_t cycles)
+	{
+		now_ += cycles;
+		tick_();
+	}
+}
+
+
+namespace {
+
+	reg_dev mpu_;
+	reg_dev bmp_;
+
+	void put16_(uint8_t* p, uint16_t v, bool le) {
+		p[le ? 1 : 0] = v >> 8;
+		p[le ? 0 : 1] = v & 0xff;
+	}
+
+	void setup_devices_()
+	{
+		std::memset(&mpu_, 0, sizeof(mpu_));
+		mpu_.adr = 0x68;
+		mpu_.reg[0x75] = 0x68;  // WHO_AM_I
+		static const int16_t mv[7] = { 1234, -2345, 16384, 3400, -111, 222, -333 };
+		for(uint8_t i = 0; i < 7; ++i) put16_(&mpu_.reg[0x3B + i * 2], mv[i], false);
+
+		// BMP280 データシートの計算例
+		std::memset(&bmp_, 0, sizeof(bmp_));
+		bmp_.adr = 0x77;
+		bmp_.reg[0xD0] = 0x58;
+		static const int32_t cal[12] = { 27504, 26435, -1000, 36477, -10685, 3024, 2855, 140, -7, 15500, -14600, 6000 };
+		for(uint8_t i = 0; i < 12; ++i) put16_(&bmp_.reg[0x88 + i * 2], cal[i], true);
+		uint32_t adc_p = 415148 << 4;
+		uint32_t adc_t = 519888 << 4;
+		bmp_.reg[0xF7] = adc_p >> 16; bmp_.reg[0xF8] = adc_p >> 8; bmp_.reg[0xF9] = adc_p;
+		bmp_.reg[0xFA] = adc_t >> 16; bmp_.reg[0xFB] = adc_t >> 8; bmp_.reg[0xFC] = adc_t;
+
+		bus_.reset();
+		bus_.dev[0] = &mpu_;
+		bus_.dev[1] = &bmp_;
+	}
+
+
+	struct result_t {
+		uint32_t	starts;
+		uint32_t	stops;
+		uint32_t	clocks;
+		double		us;
+		double		isr;
+	};
+
+	void begin_() {
+		bus_.starts = 0;
+		bus_.stops = 0;
+		bus_.clocks = 0;
+		now_ = 0;
+		isr_cycles_ = 0;
+	}
+
+	result_t end_() {
+		result_t r;
+		r.starts = bus_.starts;
+		r.stops = bus_.stops;
+		r.clocks = bus_.clocks;
+		r.us = static_cast<double>(now_) * 1e6 / F_CLK;
+		r.isr = now_ > 0 ? static_cast<double>(isr_cycles_) * 100.0 / now_ : 0.0;
+		return r;
+	}
+
+
+	// 従来のドライバーのアクセス（レジスター番号を send して、ストップの後、recv する）
+	template <class I2C>
+	bool old_read_(I2C& i2c, uint8_t adr, uint8_t reg, uint8_t* dst, uint8_t num)
+	{
+		if(!i2c.send(adr, &reg, 1)) return false;
+		return i2c.recv(adr, dst, num);
+	}
+
+
+	// 従来の MPU6050：get_accel()、get_temp()、get_gyro()
+	template <class I2C>
+	bool old_mpu_(I2C& i2c, result_t& r)
+	{
+		uint8_t a[6], t[2], g[6];
+		begin_();
+		bool ok = old_read_(i2c, 0x68, 0x3B, a, 6) && old_read_(i2c, 0x68, 0x41, t, 2)
+			&& old_read_(i2c, 0x68, 0x43, g, 6);
+		r = end_();
+		return ok && a[0] == (1234 >> 8) && g[5] == (-333 & 0xff);
+	}
+
+
+	// 従来の BMP280：start() はレジスター毎、get_pressure() は温度と圧力を別々に読む
+	template <class I2C>
+	bool old_bmp_(I2C& i2c, bool start, result_t& r)
+	{
+		uint8_t tmp[3];
+		begin_();
+		bool ok = true;
+		if(start) {
+			ok = old_read_(i2c, 0x77, 0xD0, tmp, 1) && tmp[0] == 0x58;
+			for(uint8_t i = 0; i < 12; ++i) ok = ok && old_read_(i2c, 0x77, 0x88 + i * 2, tmp, 2);
+			ok = ok && i2c.send(0x77, 0xF4, tmp, 1) && i2c.send(0x77, 0xF5, tmp, 1);
+		} else {
+			ok = old_read_(i2c, 0x77, 0xFA, tmp, 3) && old_read_(i2c, 0x77, 0xF7, tmp, 3);
+		}
+		r = end_();
+		return ok;
+	}
+
+
+	// MPU6050：加速度、温度、ジャイロ
+	template <class I2C>
+	bool test_mpu_(I2C& i2c, bool burst, result_t& r)
+	{
+		chip::MPU6050<I2C> mpu(i2c);
+		typename chip::MPU6050<I2C>::int16_vec a, g;
+		int16_t t;
+		begin_();
+		if(burst) {
+			if(!mpu.get_motion(a, t, g)) return false;
+		} else {
+			a = mpu.get_accel();
+			t = mpu.get_temp();
+			g = mpu.get_gyro();
+		}
+		r = end_();
+		return a.x == 1234 && a.y == -2345 && a.z == 16384 && t == 465
+			&& g.x == -111 && g.y == 222 && g.z == -333;
+	}
+
+
+	// BMP280：開始（補正データ）と圧力
+	template <class I2C>
+	bool test_bmp_(I2C& i2c, bool start, result_t& r)
+	{
+		chip::BMP280<I2C> bmp(i2c);
+		if(!start) bmp.start();
+		begin_();
+		bool ok = true;
+		if(start) {
+			ok = bmp.start();
+		} else {
+			ok = bmp.get_pressure() == 100653;
+		}
+		r = end_();
+		if(start) ok = ok && bmp.get_temperature() == 2508;
+		return ok;
+	}
+
+
+	bool show_(const char* name, const result_t& r, bool ok, bool isr)
+	{
+		std::printf("%-34s %6u %6u %8u %10.1f", name, r.starts, r.stops, r.clocks, r.us);
+		if(isr) std::printf(" %8.1f", r.isr);
+		else std::printf(" %8s", "-");
+		std::printf("  %s\n", ok ? "" : "FAIL");
+		return ok;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	setup_devices_();
+	IICA io;
+	io.start(IICA::speed::fast);
+
+	trj_.start(100000, 1);
+
+	std::printf("F_CLK: %u Hz, iica_io: 400 Kbps, iica_trj: 100 Kbps, ISR entry: %u cycles\n\n", F_CLK, ISR_ENTRY);
+	std::printf("%-34s %6s %6s %8s %10s %8s\n", "", "starts", "stops", "SCL", "us", "ISR %");
+	bool ok = true;
+	result_t r;
+	bus_.stretch = 0;
+	ok &= show_("MPU6050 3 values, old", r, old_mpu_(io, r), false);
+	ok &= show_("MPU6050 3 values", r, test_mpu_(io, false, r), false);
+	ok &= show_("MPU6050 get_motion", r, test_mpu_(io, true, r), false);
+	double kbps = r.clocks * 1000.0 / r.us;
+	ok &= show_("BMP280 start, old", r, old_bmp_(io, true, r), false);
+	ok &= show_("BMP280 start", r, test_bmp_(io, true, r), false);
+	ok &= show_("BMP280 get_pressure, old", r, old_bmp_(io, false, r), false);
+	ok &= show_("BMP280 get_pressure", r, test_bmp_(io, false, r), false);
+	std::printf("iica_io SCL (get_motion, with start/stop/ACK): %.0f Kbps\n\n", kbps);
+	ok &= show_("iica_trj MPU6050 3 values, old", r, old_mpu_(trj_, r), true);
+	ok &= show_("iica_trj MPU6050 get_motion", r, test_mpu_(trj_, true, r), true);
+	ok &= show_("iica_trj BMP280 get_pressure, old", r, old_bmp_(trj_, false, r), true);
+	ok &= show_("iica_trj BMP280 get_pressure", r, test_bmp_(trj_, false, r), true);
+
+	// クロック・ストレッチと、存在しないアドレス
+	bus_.stretch = 5;
+	ok &= show_("stretch, get_motion", r, test_mpu_(io, true, r), false);
+	ok &= show_("stretch, iica_trj get_motion", r, test_mpu_(trj_, true, r), true);
+	bus_.stretch = 0;
+	uint8_t tmp[2];
+	bool nack = !io.read(0x50, 0, tmp, 2) && io.get_last_error() == IICA::error::address
+		&& !trj_.read(0x50, 0, tmp, 2) && trj_.get_last_error() == IICA_TRJ::error::address;
+	std::printf("NACK (no device): %s\n", nack ? "ok" : "FAIL");
+	ok &= nack;
+
+	// 非同期：転送中に、メインループが回る回数
+	{
+		uint8_t buf[14];
+		begin_();
+		trj_.async_read(0x68, 0x3B, buf, sizeof(buf));
+		uint32_t loops = 0;
+		while(trj_.is_busy()) {
+			now_ += 10;  // メインループの処理
+			++loops;
+		}
+		r = end_();
+		bool f = trj_.get_last_error() == IICA_TRJ::error::none && buf[0] == (1234 >> 8) && buf[13] == (-333 & 0xff);
+		std::printf("async_read 14 bytes: %.1f us, %.1f %% in ISR, %u main loop iterations during transfer %s\n",
+			r.us, r.isr, loops, f ? "" : "FAIL");
+		ok &= f;
+	}
+	return ok ? 0 : 1;
+}
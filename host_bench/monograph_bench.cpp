@@ -0,0 +1,298 @@
+//=====================================================================//
+/*!	@file
+	@brief	monograph 描画プリミティブのベンチマーク @n
+			・page_plot（hspan/vspan/blit_bits 有り）と、@n
+			　同じレイアウトで点単位の PLOT を比較 @n
+			・プリミティブ毎に、描画ドット数／秒と、結果の一致を表示 @n
+			・flush による部分転送のバイト数と、LCD 側の内容の一致を表示 @n
+			　（上下の半分を交互に描く場合、USB_CHECKER）@n
+			・テキストは、点単位、blit_bits、ページ・グリフ（font6x12_page）を比較
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include "common/page_plot.hpp"
+#include "common/font6x12.hpp"
+#include "common/font6x12_page.hpp"
+#include "common/font6x12.cpp"
+#include "common/font6x12_page.cpp"
+
+namespace {
+
+	static const int16_t WIDTH  = 128;
+	static const int16_t HEIGHT = 64;
+
+	// 点単位のみの PLOT（page_plot と同じ並び）
+	class pixel_plot {
+	public:
+		typedef int16_t value_type;
+
+		static const int16_t WIDTH  = ::WIDTH;
+		static const int16_t HEIGHT = ::HEIGHT;
+
+	private:
+		uint8_t		fb_[WIDTH * HEIGHT / 8];
+
+	public:
+		void clear(uint8_t v = 0) { std::memset(fb_, v, sizeof(fb_)); }
+
+		const uint8_t* fb() const { return fb_; }
+
+		void operator() (int16_t x, int16_t y, bool val)
+		{
+			if(x < 0 || x >= WIDTH) return;
+			if(y < 0 || y >= HEIGHT) return;
+			if(val) fb_[(y >> 3) * WIDTH + x] |= 1 << (y & 7);
+			else fb_[(y >> 3) * WIDTH + x] &= ~(1 << (y & 7));
+		}
+	};
+
+	typedef graphics::page_plot<WIDTH, HEIGHT> FAST_PLOT;
+	typedef graphics::monograph<pixel_plot, graphics::font6x12> SLOW;
+	typedef graphics::monograph<FAST_PLOT, graphics::font6x12> FAST;
+	typedef graphics::monograph<FAST_PLOT, graphics::font6x12_page> PAGE;
+
+	// ページ・グリフの転送（blit_pages）を数える PLOT
+	class count_plot : public FAST_PLOT {
+	public:
+		uint32_t	pages_ = 0;
+
+		void blit_pages(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t pages) {
+			++pages_;
+			FAST_PLOT::blit_pages(x, y, src, w, pages);
+		}
+	};
+	typedef graphics::monograph<count_plot, graphics::font6x12_page> COUNT;
+
+	graphics::kfont_null kfont_;
+	SLOW	slow_(kfont_);
+	FAST	fast_(kfont_);
+	PAGE	page_(kfont_);
+
+	typedef std::chrono::steady_clock CLOCK;
+
+	const int32_t loop_ = 2000;
+
+	// 各プリミティブの描画（戻り値は描画ドット数）
+	template <class MONO>
+	uint32_t hline_(MONO& m, int32_t n) {
+		for(int16_t y = 0; y < HEIGHT; ++y) m.line(n & 7, y, WIDTH - 1 - (n & 3), y, (y ^ n) & 1);
+		return HEIGHT * (WIDTH - (n & 7) - (n & 3));
+	}
+
+	template <class MONO>
+	uint32_t vline_(MONO& m, int32_t n) {
+		for(int16_t x = 0; x < WIDTH; ++x) m.line(x, n & 7, x, HEIGHT - 1 - (n & 3), (x ^ n) & 1);
+		return WIDTH * (HEIGHT - (n & 7) - (n & 3));
+	}
+
+	template <class MONO>
+	uint32_t fill_(MONO& m, int32_t n) {
+		int16_t x = n % 13;
+		int16_t y = n % 11;
+		m.fill(x, y, 100, 40, n & 1);
+		return 100 * 40;
+	}
+
+	template <class MONO>
+	uint32_t frame_(MONO& m, int32_t n) {
+		uint32_t d = 0;
+		for(int16_t i = 0; i < 16; ++i) {
+			int16_t w = WIDTH - i * 4;
+			int16_t h = HEIGHT - i * 2;
+			if(h <= 2) break;
+			m.frame(i * 2, i, w, h, (i ^ n) & 1);
+			d += (w + h) * 2 - 4;
+		}
+		return d;
+	}
+
+	template <class MONO>
+	uint32_t line_(MONO& m, int32_t n) {
+		for(int16_t i = 0; i < 16; ++i) {
+			m.line(0, i * 4, WIDTH - 1, HEIGHT - 1 - i * 4, (i ^ n) & 1);
+		}
+		return 16 * WIDTH;
+	}
+
+	template <class MONO>
+	uint32_t text_(MONO& m, int32_t n) {
+		// 分岐予測で同じパターンを覚えないように、文字を毎回変える
+		uint32_t d = 0;
+		uint8_t c = n * 7;
+		for(int16_t y = -(n & 3); y < HEIGHT; y += 12) {
+			for(int16_t x = -(n & 7); x < WIDTH; ) {
+				c = c * 13 + 5;
+				x = m.draw_font(x, y, 0x21 + (c % 94));
+			}
+			d += WIDTH * 12;
+		}
+		return d;
+	}
+
+	template <class MONO>
+	double bench_(MONO& m, uint32_t (*func)(MONO&, int32_t)) {
+		m.clear(0);
+		uint32_t dots = 0;
+		auto t0 = CLOCK::now();
+		for(int32_t n = 0; n < loop_; ++n) {
+			dots += func(m, n);
+		}
+		auto t1 = CLOCK::now();
+		double s = std::chrono::duration<double>(t1 - t0).count();
+		return s > 0.0 ? static_cast<double>(dots) / s : 0.0;
+	}
+
+	// 転送内容を記録する LCD
+	class mirror_lcd {
+		uint8_t		ram_[WIDTH * HEIGHT / 8];
+	public:
+		mirror_lcd() { std::memset(ram_, 0x55, sizeof(ram_)); }
+
+		const uint8_t* ram() const { return ram_; }
+
+		void copy_part(const uint8_t* src, uint8_t page, uint8_t col, uint8_t len) {
+			std::memcpy(&ram_[page * WIDTH + col], src, len);
+		}
+	};
+
+
+	int flush_test_()
+	{
+		mirror_lcd lcd;
+		auto& plot = fast_.at_plot();
+		fast_.clear(0);
+		fast_.draw_text(0, 0, "Volt: 12.34V");
+		fast_.frame(0, 40, WIDTH, 24, 1);
+		uint32_t full = plot.flush(lcd);
+
+		// 数字の部分だけを書き換える
+		uint32_t part = 0;
+		int err = 0;
+		char tmp[8];
+		for(int32_t n = 0; n < 100; ++n) {
+			std::snprintf(tmp, sizeof(tmp), "%02d", static_cast<int>(n));
+			fast_.fill(6 * 9, 0, 6 * 2, 12, 0);
+			fast_.draw_text(6 * 9, 0, tmp);
+			part += plot.flush(lcd);
+			if(std::memcmp(lcd.ram(), plot.fb(), WIDTH * HEIGHT / 8) != 0) ++err;
+		}
+
+		// 斜めの線（画面外の端点を含む）の変更範囲
+		uint32_t r = 1;
+		for(int32_t n = 0; n < 500; ++n) {
+			int16_t v[4];
+			for(auto& a : v) {
+				r = r * 1103515245 + 12345;
+				a = static_cast<int16_t>((r >> 16) % (WIDTH + 40)) - 20;
+			}
+			fast_.line(v[0], v[1] % (HEIGHT + 20), v[2], v[3] % (HEIGHT + 20), n & 1);
+			plot.flush(lcd);
+			if(std::memcmp(lcd.ram(), plot.fb(), WIDTH * HEIGHT / 8) != 0) ++err;
+		}
+		std::printf("flush      full: %u bytes, digit update: %u bytes/frame %s\n",
+			full, part / 100, err == 0 ? "" : "(MISMATCH)");
+		return err == 0 ? 0 : 1;
+	}
+
+
+	// USB_CHECKER の様に、１つのバッファ（128 x 24）で、上下の半分を交互に描く
+	typedef graphics::monograph<graphics::page_plot<WIDTH, 24>, graphics::font6x12_page> HALF;
+
+	int half_test_()
+	{
+		mirror_lcd lcd;
+		HALF half(kfont_);
+		auto& plot = half.at_plot();
+		uint32_t all = 0;
+		uint32_t part = 0;
+		uint8_t text_w[2] = { 0, 0 };  // USB_CHECKER の text_ と同じ
+		int err = 0;
+		char tmp[16];
+		for(int32_t n = 0; n < 200; ++n) {
+			uint8_t pg = n & 1;
+			// 幅が変わる文字列（「9.99V」と「10.00V」など）
+			int v = (n * 373) % 1500;
+			std::snprintf(tmp, sizeof(tmp), "%d.%02d%c", v / 100, v % 100, pg ? 'A' : 'V');
+			if(n < 100) {  // 毎回、全体を消す
+				half.clear(0);
+				half.draw_text(0, 0, tmp);
+				all += plot.flush(lcd, pg * 3);
+			} else {  // 両方の半分の、前の文字列の広い方を消す
+				uint8_t w = text_w[0] > text_w[1] ? text_w[0] : text_w[1];
+				if(w > 0) half.fill(0, 0, w, 12, 0);
+				text_w[pg] = half.draw_text(0, 0, tmp);
+				part += plot.flush(lcd, pg * 3);
+			}
+			if(std::memcmp(lcd.ram() + pg * 3 * WIDTH, plot.fb(), WIDTH * 3) != 0) ++err;
+		}
+		std::printf("flush      half screen, clear: %u bytes/frame, text only: %u bytes/frame %s\n",
+			all / 100, part / 100, err == 0 ? "" : "(MISMATCH)");
+		return err == 0 ? 0 : 1;
+	}
+
+
+	int text_test_()
+	{
+		double ps = bench_(slow_, text_<SLOW>);
+		double pf = bench_(fast_, text_<FAST>);
+		bool ok = std::memcmp(slow_.at_plot().fb(), fast_.at_plot().fb(), WIDTH * HEIGHT / 8) == 0;
+		double pp = bench_(page_, text_<PAGE>);
+		ok = ok && std::memcmp(slow_.at_plot().fb(), page_.at_plot().fb(), WIDTH * HEIGHT / 8) == 0;
+
+		// ページ境界を跨ぐ位置、プロポーショナル
+		for(int16_t y = -12; y <= HEIGHT; ++y) {
+			slow_.clear(0);
+			page_.clear(0);
+			slow_.draw_text(y - 6, y, "Volt: 12.34V ilj|!", true);
+			page_.draw_text(y - 6, y, "Volt: 12.34V ilj|!", true);
+			if(std::memcmp(slow_.at_plot().fb(), page_.at_plot().fb(), WIDTH * HEIGHT / 8) != 0) ok = false;
+		}
+
+		// ページ・グリフの経路を通っているか
+		COUNT cnt(kfont_);
+		cnt.clear(0);
+		slow_.clear(0);
+		cnt.draw_text(3, 5, "Volt: 12.34V");
+		slow_.draw_text(3, 5, "Volt: 12.34V");
+		uint32_t pages = cnt.at_plot().pages_;
+		if(pages != 12) ok = false;
+		if(std::memcmp(slow_.at_plot().fb(), cnt.at_plot().fb(), WIDTH * HEIGHT / 8) != 0) ok = false;
+		std::printf("%-10s pixel: %8.2f Mdot/s, blit: %8.2f Mdot/s, page: %8.2f Mdot/s, x%5.1f (blit x%4.1f) %s\n", "text",
+			ps / 1e6, pf / 1e6, pp / 1e6, ps > 0.0 ? pp / ps : 0.0, pf > 0.0 ? pp / pf : 0.0,
+			ok ? "" : "(MISMATCH)");
+		std::printf("%-10s blit_pages: %u calls for 12 glyphs\n", "", pages);
+		return ok ? 0 : 1;
+	}
+
+
+	int test_(const char* name, uint32_t (*fs)(SLOW&, int32_t), uint32_t (*ff)(FAST&, int32_t))
+	{
+		double ps = bench_(slow_, fs);
+		double pf = bench_(fast_, ff);
+		bool ok = std::memcmp(slow_.at_plot().fb(), fast_.at_plot().fb(), WIDTH * HEIGHT / 8) == 0;
+		std::printf("%-10s pixel: %8.2f Mdot/s, span: %8.2f Mdot/s, x%5.1f %s\n", name,
+			ps / 1e6, pf / 1e6, ps > 0.0 ? pf / ps : 0.0, ok ? "" : "(MISMATCH)");
+		return ok ? 0 : 1;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	int ret = 0;
+	ret |= test_("hline", hline_<SLOW>, hline_<FAST>);
+	ret |= test_("vline", vline_<SLOW>, vline_<FAST>);
+	ret |= test_("fill", fill_<SLOW>, fill_<FAST>);
+	ret |= test_("frame", frame_<SLOW>, frame_<FAST>);
+	ret |= test_("line", line_<SLOW>, line_<FAST>);
+	ret |= text_test_();
+	ret |= flush_test_();
+	ret |= half_test_();
+	return ret;
+}
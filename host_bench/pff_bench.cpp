@@ -0,0 +1,455 @@
+//=====================================================================//
+/*!	@file
+	@brief	Petit FatFs（pff.c）のアクセス・パターン・ベンチマーク @n
+			・FAT12/16/32 のイメージを生成して、pf_mount、ディレクトリー一覧、@n
+			　連続読み出し、pf_lseek、pf_write の、コマンド数、転送量、@n
+			　読み捨て量と、SD カード（SPI）の時間の見積もりを表示 @n
+			・従来の pff（キャッシュ無し）と CMD17、キャッシュ付きの pff と、@n
+			　CMD17、CMD18（mmc_io のストリーム）を比較 @n
+			・ディスクは、pfatfs::mmc_io と、SPI の SD カード（host_disk）@n
+			・読み出したデータを、生成したデータと比較して確認 @n
+			「-l us」で、コマンド毎の待ち時間、「-b kbps」で、SPI の速度を指定 @n
+			「-i file」で、SD カードのイメージ・ファイル（ルートの全ファイルを @n
+			読み、一番大きなファイルで pf_lseek）、「-o prefix」で、テスト後の @n
+			イメージを、prefix + 名前 + 「.img」に書き出す
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "pfatfs/src/pff.h"
+#include "host_disk.hpp"
+
+// 従来の設定（_FAT_CACHE=0、_FAST_SEEK=0）でコンパイルした pff（Makefile 参照）
+extern "C" {
+	FRESULT pf0_mount(FATFS* fs);
+	FRESULT pf0_open(const char* path);
+	FRESULT pf0_read(void* buff, UINT btr, UINT* br);
+	FRESULT pf0_write(const void* buff, UINT btw, UINT* bw);
+	FRESULT pf0_lseek(DWORD ofs);
+	FRESULT pf0_opendir(DIR* dj, const char* path);
+	FRESULT pf0_readdir(DIR* dj, FILINFO* fno);
+}
+
+namespace {
+
+	struct pff_t {
+		FRESULT (*mount)(FATFS*);
+		FRESULT (*open)(const char*);
+		FRESULT (*read)(void*, UINT, UINT*);
+		FRESULT (*write)(const void*, UINT, UINT*);
+		FRESULT (*lseek)(DWORD);
+		FRESULT (*opendir)(DIR*, const char*);
+		FRESULT (*readdir)(DIR*, FILINFO*);
+	};
+
+	const pff_t pff0_ = { pf0_mount, pf0_open, pf0_read, pf0_write, pf0_lseek, pf0_opendir, pf0_readdir };
+	const pff_t pff_  = { pf_mount, pf_open, pf_read, pf_write, pf_lseek, pf_opendir, pf_readdir };
+
+	struct variant_t {
+		const char*		name;
+		const pff_t&	pff;
+		bool			stream;	///< mmc_io の CMD18 ストリーム
+	};
+
+	const variant_t variant_[] = {
+		{ "pff0/CMD17", pff0_, false },
+		{ "pff/CMD17",  pff_,  false },
+		{ "pff/CMD18",  pff_,  true },
+	};
+
+	double cmd_us_ = 300.0;
+	double kbps_ = 4000.0;
+	const char* out_ = nullptr;
+
+	static const uint32_t SMALL_NUM = 40;
+	static const uint32_t CHUNK = 256;  // SD_WAV_play の１回分（128 x 2）
+
+	uint8_t seq_data_(uint32_t ofs) { return (ofs * 7 + (ofs >> 9)) ^ 0x5A; }
+	uint8_t frag_data_(uint32_t ofs) { return (ofs * 13 + (ofs >> 8)) ^ 0xA5; }
+	uint8_t small_data_(uint32_t ofs) { return 'a' + (ofs % 26); }
+	uint8_t write_data_(uint32_t ofs) { return ofs * 3 + 1; }
+
+	struct image_t {
+		const char*	name;	// イメージ・ファイルの場合は、パス
+		uint8_t		type;
+		uint32_t	tsect;
+		uint8_t		spc;
+		uint32_t	seq;	// SEQ.BIN のサイズ
+		uint32_t	frag;	// FRAG.BIN のサイズ
+	};
+
+	const image_t image_[] = {
+		{ "FAT12",  12,   4096, 1,  1024 * 1024, 256 * 1024 },
+		{ "FAT16",  16,  65536, 4,  4096 * 1024, 1024 * 1024 },
+		{ "FAT32",  32, 139264, 1,  4096 * 1024, 1024 * 1024 },
+	};
+
+	uint32_t rand_ = 1;
+	uint32_t rand_next_() {
+		rand_ = rand_ * 1103515245 + 12345;
+		return rand_ >> 8;
+	}
+
+
+	// 結果が FR_OK で、データが一致したら「true」
+	typedef bool (*test_func)(const pff_t& pff, const image_t& img, uint32_t& bytes);
+
+	bool mount_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		static FATFS fs;
+		bytes = 0;
+		return pff.mount(&fs) == FR_OK;
+	}
+
+	bool dir_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		DIR dj;
+		FILINFO fno;
+		if(pff.opendir(&dj, "") != FR_OK) return false;
+		uint32_t n = 0;
+		bytes = 0;
+		for(;;) {
+			if(pff.readdir(&dj, &fno) != FR_OK) return false;
+			if(fno.fname[0] == 0) break;
+			++n;
+			bytes += 32;
+		}
+		return n == (SMALL_NUM + 2);
+	}
+
+	bool open_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		bytes = 0;
+		char tmp[16];
+		std::snprintf(tmp, sizeof(tmp), "FILE%02u.TXT", SMALL_NUM - 1);
+		if(pff.open(tmp) != FR_OK) return false;
+		uint8_t buf[64];
+		UINT br;
+		if(pff.read(buf, sizeof(buf), &br) != FR_OK || br != sizeof(buf)) return false;
+		for(UINT i = 0; i < br; ++i) {
+			if(buf[i] != small_data_(i)) return false;
+		}
+		bytes = br;
+		return true;
+	}
+
+	// 大きなファイル（SEQ.BIN）を開くだけ（クラスター・チェーンを辿らない事）
+	bool open_big_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		bytes = 0;
+		return pff.open("SEQ.BIN") == FR_OK;
+	}
+
+	bool read_all_(const pff_t& pff, const char* file, uint32_t size, uint8_t (*data)(uint32_t), uint32_t& bytes)
+	{
+		bytes = 0;
+		if(pff.open(file) != FR_OK) return false;
+		uint8_t buf[CHUNK];
+		for(;;) {
+			UINT br;
+			if(pff.read(buf, sizeof(buf), &br) != FR_OK) return false;
+			for(UINT i = 0; i < br; ++i) {
+				if(buf[i] != data(bytes + i)) return false;
+			}
+			bytes += br;
+			if(br < sizeof(buf)) break;
+		}
+		return bytes == size;
+	}
+
+	bool seq_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		return read_all_(pff, "SEQ.BIN", img.seq, seq_data_, bytes);
+	}
+
+	bool frag_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		return read_all_(pff, "FRAG.BIN", img.frag, frag_data_, bytes);
+	}
+
+	// ランダムな位置に pf_lseek して、３２バイト読む
+	bool seek_all_(const pff_t& pff, const char* file, uint32_t size, uint8_t (*data)(uint32_t), uint32_t& bytes)
+	{
+		bytes = 0;
+		if(pff.open(file) != FR_OK) return false;
+		rand_ = 1;
+		for(uint32_t n = 0; n < 200; ++n) {
+			uint32_t ofs = rand_next_() % (size - 32);
+			if(pff.lseek(ofs) != FR_OK) return false;
+			uint8_t buf[32];
+			UINT br;
+			if(pff.read(buf, sizeof(buf), &br) != FR_OK || br != sizeof(buf)) return false;
+			for(UINT i = 0; i < br; ++i) {
+				if(buf[i] != data(ofs + i)) return false;
+			}
+			bytes += br;
+		}
+		return true;
+	}
+
+	bool seek_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		return seek_all_(pff, "SEQ.BIN", img.seq, seq_data_, bytes);
+	}
+
+	bool seek_frag_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		return seek_all_(pff, "FRAG.BIN", img.frag, frag_data_, bytes);
+	}
+
+	// FRAG.BIN の後半に書いて、読み戻す（元のデータに戻す）
+	bool write_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		static const uint32_t LEN = 32 * 1024;
+		uint32_t top = img.frag / 2;
+		bytes = 0;
+		for(int pass = 0; pass < 2; ++pass) {
+			auto data = pass == 0 ? write_data_ : frag_data_;
+			if(pff.open("FRAG.BIN") != FR_OK) return false;
+			if(pff.lseek(top) != FR_OK) return false;
+			uint8_t buf[512];
+			for(uint32_t ofs = 0; ofs < LEN; ofs += sizeof(buf)) {
+				for(uint32_t i = 0; i < sizeof(buf); ++i) buf[i] = data(top + ofs + i);
+				UINT bw;
+				if(pff.write(buf, sizeof(buf), &bw) != FR_OK || bw != sizeof(buf)) return false;
+			}
+			UINT bw;
+			if(pff.write(nullptr, 0, &bw) != FR_OK) return false;
+			if(pass != 0) break;
+			bytes = LEN;
+			if(pff.lseek(top) != FR_OK) return false;
+			for(uint32_t ofs = 0; ofs < LEN; ofs += sizeof(buf)) {
+				UINT br;
+				if(pff.read(buf, sizeof(buf), &br) != FR_OK || br != sizeof(buf)) return false;
+				for(uint32_t i = 0; i < sizeof(buf); ++i) {
+					if(buf[i] != data(top + ofs + i)) return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// イメージ・ファイルのテスト（最初の variant で読んだ内容と比べる）
+	char big_[13];				// 一番大きなファイル
+	std::vector<uint8_t> ref_;	// その内容
+	uint32_t sum_ref_;			// 全ファイルのチェックサム
+
+	bool files_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		DIR dj;
+		FILINFO fno;
+		if(pff.opendir(&dj, "") != FR_OK) return false;
+		bool first = ref_.empty() && big_[0] == 0;
+		uint32_t sum = 0;
+		uint32_t big = 0;
+		bytes = 0;
+		for(;;) {
+			if(pff.readdir(&dj, &fno) != FR_OK) return false;
+			if(fno.fname[0] == 0) break;
+			if(fno.fattrib & AM_DIR) continue;
+			if(pff.open(fno.fname) != FR_OK) return false;
+			bool keep = first && (big_[0] == 0 || fno.fsize > big);
+			if(keep) {
+				std::strcpy(big_, fno.fname);
+				big = fno.fsize;
+				ref_.clear();
+			}
+			uint8_t buf[CHUNK];
+			uint32_t n = 0;
+			for(;;) {
+				UINT br;
+				if(pff.read(buf, sizeof(buf), &br) != FR_OK) return false;
+				for(UINT i = 0; i < br; ++i) sum = sum * 31 + buf[i];
+				if(keep) ref_.insert(ref_.end(), buf, buf + br);
+				n += br;
+				if(br < sizeof(buf)) break;
+			}
+			if(n != fno.fsize) return false;
+			bytes += n;
+		}
+		if(first) sum_ref_ = sum;
+		return sum == sum_ref_;
+	}
+
+	bool seek_file_(const pff_t& pff, const image_t& img, uint32_t& bytes)
+	{
+		bytes = 0;
+		if(big_[0] == 0 || ref_.size() <= 32) return true;  // 対象無し
+		if(pff.open(big_) != FR_OK) return false;
+		rand_ = 1;
+		for(uint32_t n = 0; n < 200; ++n) {
+			uint32_t ofs = rand_next_() % (ref_.size() - 32);
+			if(pff.lseek(ofs) != FR_OK) return false;
+			uint8_t buf[32];
+			UINT br;
+			if(pff.read(buf, sizeof(buf), &br) != FR_OK || br != sizeof(buf)) return false;
+			if(std::memcmp(buf, &ref_[ofs], br) != 0) return false;
+			bytes += br;
+		}
+		return true;
+	}
+
+	struct test_t {
+		const char*	name;
+		test_func	func;
+	};
+
+	const test_t test_[] = {
+		{ "mount",     mount_ },
+		{ "readdir",   dir_ },
+		{ "open",      open_ },
+		{ "open big",  open_big_ },
+		{ "seq",       seq_ },
+		{ "seq frag",  frag_ },
+		{ "seek",      seek_ },
+		{ "seek frag", seek_frag_ },
+		{ "write",     write_ },
+	};
+
+	const test_t file_test_[] = {
+		{ "mount",     mount_ },
+		{ "files",     files_ },
+		{ "seek",      seek_file_ },
+	};
+
+
+	// テストを、全ての variant で実行して、表を出す
+	int run_tests_(std::vector<uint8_t>& buf, const image_t& img, const test_t* test, uint32_t num)
+	{
+		pfatfs::host_disk disk(buf);
+		disk.set_latency(cmd_us_, kbps_);
+		pfatfs::host_disk_ = &disk;
+		pfatfs::host_mmc mmc(disk);
+		pfatfs::host_mmc_ = &mmc;
+
+		std::printf("%-10s", "");
+		for(const auto& v : variant_) std::printf("|%-36s", v.name);
+		std::printf("\n%-10s", "");
+		for(uint32_t i = 0; i < (sizeof(variant_) / sizeof(variant_[0])); ++i) {
+			std::printf("|%7s %6s %9s %11s", "cmd", "amp", "skip", "ms");
+		}
+		std::printf("\n");
+
+		int ret = 0;
+		for(uint32_t n = 0; n < num; ++n) {
+			const auto& t = test[n];
+			std::printf("%-10s", t.name);
+			for(const auto& v : variant_) {
+				mmc.enable_stream(v.stream);
+				disk.clear();
+				uint32_t bytes = 0;
+				if(t.func != mount_) {
+					FATFS fs;
+					if(v.pff.mount(&fs) != FR_OK) return 1;
+					disk.clear();
+					if(!t.func(v.pff, img, bytes)) {
+						std::printf("|%-36s", "  FAIL");
+						ret = 1;
+						continue;
+					}
+				} else if(!t.func(v.pff, img, bytes)) {
+					std::printf("|%-36s", "  FAIL");
+					ret = 1;
+					continue;
+				}
+				mmc.stop_stream();  // 止める CMD12 も数える
+				const auto& st = disk.get_stat();
+				// 増幅率は、カードとの転送量（SPI の全バイト）／必要なバイト数
+				double amp = bytes > 0 ? static_cast<double>(st.bytes) / bytes : 0.0;
+				// skip は、カードが送ったデータ・ブロックの内、mmc_io が捨てたバイト数
+				std::printf("|%7u %6.1f %9u %11.2f", st.cmd, amp, st.skip, st.us / 1000.0);
+			}
+			std::printf("\n");
+		}
+		std::printf("\n");
+		pfatfs::host_mmc_ = nullptr;
+		pfatfs::host_disk_ = nullptr;
+		return ret;
+	}
+
+
+	// テスト後のイメージを書き出す
+	int save_(const std::vector<uint8_t>& buf, const char* name)
+	{
+		if(out_ == nullptr) return 0;
+		std::string path = std::string(out_) + name + ".img";
+		if(!pfatfs::host_disk::save(path.c_str(), buf)) {
+			std::printf("%s: can't write\n", path.c_str());
+			return 1;
+		}
+		return 0;
+	}
+
+
+	int run_(const image_t& img)
+	{
+		std::vector<uint8_t> buf;
+		pfatfs::fat_image fat(buf, img.type, img.tsect, img.spc);
+		for(uint32_t i = 0; i < SMALL_NUM; ++i) {
+			char tmp[16];
+			std::snprintf(tmp, sizeof(tmp), "FILE%02u.TXT", i);
+			fat.add_file(tmp, 100 + i, 0, 0, small_data_);
+		}
+		bool ok = fat.add_file("SEQ.BIN", img.seq, 0, 0, seq_data_);
+		ok = ok && fat.add_file("FRAG.BIN", img.frag, 4, 1, frag_data_);  // ４クラスター毎に１つ空ける
+		if(!ok) {
+			std::printf("%s: image full\n", img.name);
+			return 1;
+		}
+
+		std::printf("%s: %u clusters, %u bytes/cluster\n", img.name, fat.get_clusters(), img.spc * 512);
+		int ret = run_tests_(buf, img, test_, sizeof(test_) / sizeof(test_[0]));
+		return ret | save_(buf, img.name);
+	}
+
+
+	// イメージ・ファイル
+	int run_file_(const char* path)
+	{
+		std::vector<uint8_t> buf;
+		if(!pfatfs::host_disk::load(path, buf)) {
+			std::printf("%s: can't read\n", path);
+			return 1;
+		}
+		image_t img = { path, 0, static_cast<uint32_t>(buf.size() / 512), 0, 0, 0 };
+		std::printf("%s: %u sectors\n", path, img.tsect);
+		int ret = run_tests_(buf, img, file_test_, sizeof(file_test_) / sizeof(file_test_[0]));
+		if(big_[0] != 0) {
+			std::printf("seek: %s, %u bytes\n\n", big_, static_cast<uint32_t>(ref_.size()));
+		}
+		return ret | save_(buf, "IMAGE");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* in = nullptr;
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-l" && (i + 1) < argc) cmd_us_ = std::atof(argv[++i]);
+		else if(p == "-b" && (i + 1) < argc) kbps_ = std::atof(argv[++i]);
+		else if(p == "-i" && (i + 1) < argc) in = argv[++i];
+		else if(p == "-o" && (i + 1) < argc) out_ = argv[++i];
+		else {
+			std::printf("usage: %s [-l command_latency_us] [-b spi_kbps] [-i image] [-o prefix]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	std::printf("command latency: %.0f us, SPI: %.0f kbps, read chunk: %u bytes\n\n", cmd_us_, kbps_, CHUNK);
+	if(in != nullptr) return run_file_(in);
+
+	int ret = 0;
+	for(const auto& img : image_) {
+		ret |= run_(img);
+	}
+	return ret;
+}
@@ -0,0 +1,129 @@
+//=====================================================================//
+/*!	@file
+	@brief	psg_mng::render のベンチマーク @n
+			・PSG_sample の楽曲を、TICK 毎に render/service して、@n
+			　N 秒分の波形を生成し、レンダリング時間（ns/sample）を表示 @n
+			・波形のハッシュを、除算で正規化していた時の値と比較して、@n
+			　ビット単位で一致する事を確認（楽曲は psg_mml のパック形式） @n
+			・正規化テーブルが、全ての合計値、チャネル数で除算と一致する事を確認 @n
+			・drum は、ノイズと DPCM の処理時間
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include "PSG_sample/score.hpp"
+
+extern "C" {
+	void sci_putch(char ch) { }
+}
+
+namespace {
+
+	typedef std::chrono::steady_clock CLOCK;
+
+	static const uint16_t TICK = 100;
+	static const uint16_t CNUM = 3;
+
+	uint32_t seconds_ = 60;
+
+	struct result_t {
+		uint32_t	hash;
+		uint32_t	samples;
+		double		ns;
+	};
+
+	template <uint16_t SAMPLE, uint16_t BSIZE>
+	result_t render_(const PSG::SCORE* s0, const PSG::SCORE* s1, const PSG::SCORE* s2)
+	{
+		typedef utils::psg_mng<SAMPLE, TICK, BSIZE, CNUM> PSG_MNG;
+
+		result_t best = { 0, 0, 0.0 };
+		for(int n = 0; n < 5; ++n) {
+			PSG_MNG psg;
+			psg.set_dpcm(0, &dpcm_kick_);
+			for(uint8_t i = 0; i < 8; ++i) psg.set_sub_score(i, ladutorm_sub_[i]);
+			if(s0 != nullptr) psg.set_score(0, s0);
+			if(s1 != nullptr) psg.set_score(1, s1);
+			if(s2 != nullptr) psg.set_score(2, s2);
+
+			// FNV-1a
+			uint32_t hash = 2166136261;
+			uint32_t done = 0;
+			uint16_t pos = 0;
+			CLOCK::duration t(0);
+			for(uint32_t tick = 0; tick < seconds_ * TICK; ++tick) {
+				uint16_t len = (tick + 1) * SAMPLE / TICK - done;
+				auto t0 = CLOCK::now();
+				psg.render(len);
+				t += CLOCK::now() - t0;
+				for(uint16_t i = 0; i < len; ++i) {
+					hash ^= psg.get_wav(pos);
+					hash *= 16777619;
+					pos = (pos + 1) & (BSIZE - 1);
+				}
+				done += len;
+				psg.service();
+			}
+			double ns = std::chrono::duration<double, std::nano>(t).count() / done;
+			if(n == 0 || ns < best.ns) best.ns = ns;
+			best.hash = hash;
+			best.samples = done;
+		}
+		return best;
+	}
+
+
+	// 合成値の最大は、チャネル毎に 112（volume 128 の矩形波、三角波）
+	int scale_test_()
+	{
+		typedef utils::psg_mng<19531, TICK, 512, 8> PSG8;
+		uint32_t err = 0;
+		for(uint8_t n = 2; n <= (8 + 1); ++n) {
+			for(int16_t sum = -112 * 8; sum <= 112 * 8; ++sum) {
+				if(PSG8::scale(sum, n) != (sum / n)) ++err;
+			}
+		}
+		std::printf("%-12s %u errors\n", "scale", err);
+		return err == 0 ? 0 : 1;
+	}
+
+
+	int test_(const char* name, const result_t& r, uint32_t ref)
+	{
+		bool ok = seconds_ != 60 || r.hash == ref;
+		std::printf("%-12s %7u samples, %6.2f ns/sample, hash: %08X %s\n", name,
+			r.samples, r.ns, r.hash, ok ? "" : "(MISMATCH)");
+		return ok ? 0 : 1;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	if(argc > 1) {
+		seconds_ = std::atoi(argv[1]);
+		if(seconds_ == 0) {
+			std::printf("usage: %s [seconds]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// F_CLK(20MHz) / 4 / 256、LOW_PROFILE は F_CLK / 8 / 256
+	static const uint16_t SAMPLE = 19531;
+	static const uint16_t SAMPLE_LOW = 9765;
+
+	// 参照値は、６０秒の時、チャネル毎の合計を除算で正規化していた時の波形
+	// drum は、NOISE、DPCM を追加した時の波形（変更の検出用）
+	int ret = scale_test_();
+	ret |= test_("song", render_<SAMPLE, 512>(ladutorm_a_, ladutorm_b_, nullptr), 0xF89C35D0);
+	ret |= test_("song (low)", render_<SAMPLE_LOW, 256>(ladutorm_a_, ladutorm_b_, nullptr), 0x8A9EB816);
+	ret |= test_("song x3", render_<SAMPLE, 512>(ladutorm_a_, ladutorm_b_, ladutorm_a_), 0xFE77FF84);
+	ret |= test_("test", render_<SAMPLE, 512>(score_test_, nullptr, nullptr), 0x1DDFEF6C);
+	ret |= test_("drum", render_<SAMPLE, 512>(score_drum_, nullptr, nullptr), 0xCCDE670D);
+	return ret;
+}
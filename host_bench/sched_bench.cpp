@@ -0,0 +1,172 @@
+//=====================================================================//
+/*!	@file
+	@brief	協調型スケジューラー（sched）を、ホスト・シミュレーター（host_io）で検査 @n
+			・タイマー RB（1000Hz）のティックで、周期（位相付き）と１回のタスク @n
+			・UART0 の受信割り込みから post したタスクが呼ばれるまでの遅れを、@n
+			　次のティックで見る（timer_b_.sync のループ）場合と比べる
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cmath>
+#include "host_io.hpp"
+
+#pragma GCC diagnostic ignored "-Wunused-variable"  // レジスター定義（サンプルの Makefile と同じ）
+#include "common/fifo.hpp"
+#include "common/uart_io.hpp"
+#include "common/trb_io.hpp"
+#include "common/sched.hpp"
+
+namespace {
+
+	static const uint32_t TICK_FREQ = 1000;
+	static const uint64_t TICK = F_CLK / TICK_FREQ;
+
+	typedef utils::sched<4, 8> SCHED;
+
+	typedef device::trb_io<SCHED::tick_task, uint8_t> TIMER_B;
+	TIMER_B	timer_b_;
+
+	typedef utils::fifo<uint8_t, 16> TX_BUFF;
+	typedef utils::fifo<uint8_t, 16> RX_BUFF;
+	typedef device::uart_io<device::UART0, TX_BUFF, RX_BUFF> UART;
+	UART	uart_;
+
+	device::host_core*	core_;
+
+	std::vector<uint64_t>	per_[2];
+	std::vector<uint64_t>	one_;
+	std::vector<uint64_t>	rx_isr_;
+	std::vector<uint64_t>	rx_call_;
+	uint32_t	rx_chars_ = 0;
+
+	void per0_() { per_[0].push_back(core_->now()); }
+	void per1_() { per_[1].push_back(core_->now()); }
+
+	void one_task_()
+	{
+		one_.push_back(core_->now());
+		if(one_.size() < 3) SCHED::set_oneshot(2, one_task_, 250);
+	}
+
+	void rx_task_()
+	{
+		rx_call_.push_back(core_->now());
+		while(uart_.length() != 0) {
+			uart_.getch();
+			++rx_chars_;
+		}
+	}
+
+
+	// 周期の平均と、最大のずれ（サイクル）
+	bool period_(const std::vector<uint64_t>& v, uint64_t period, double& avg, double& jit)
+	{
+		if(v.size() < 3) return false;
+		avg = static_cast<double>(v.back() - v.front()) / (v.size() - 1);
+		jit = 0.0;
+		for(size_t i = 1; i < v.size(); ++i) {
+			double d = std::fabs(static_cast<double>(v[i] - v[i - 1]) - period);
+			if(d > jit) jit = d;
+		}
+		return true;
+	}
+}
+
+extern "C" {
+
+	void TIMER_RB_intr(void) {
+		timer_b_.itask();
+	}
+
+
+	void UART0_TX_intr(void) {
+		uart_.isend();
+	}
+
+
+	void UART0_RX_intr(void) {
+		rx_isr_.push_back(core_->now());
+		uart_.irecv();
+		SCHED::post(3);
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+	core_ = &io;
+
+	// 受信は、ティックと揃わない時間に、１文字づつ
+	for(uint32_t i = 0; i < 40; ++i) {
+		io.at(io.usec(3700 + i * 23300), [&]() { io.uart.input("x"); });
+	}
+
+	bool stop = io.run([]() {
+		timer_b_.start(TICK_FREQ, 2);
+		uart_.start(57600, 1);
+		SCHED::set_periodic(0, per0_, 10);
+		SCHED::set_periodic(1, per1_, 10, 5);
+		SCHED::set_oneshot(2, one_task_, 250);
+		SCHED::set_event(3, rx_task_);
+		SCHED::run();
+	}, io.msec(1000));
+
+	bool ok = stop;
+	std::printf("sched  %.1f s, tick %u Hz (%u cycles)\n",
+		static_cast<double>(io.now()) / F_CLK, TICK_FREQ, static_cast<uint32_t>(TICK));
+
+	for(uint32_t i = 0; i < 2; ++i) {
+		double avg, jit;
+		if(!period_(per_[i], TICK * 10, avg, jit)) {
+			ok = false;
+			continue;
+		}
+		std::printf("  periodic %u: %3u calls, period %8.1f cycles, jitter %6.1f cycles\n",
+			i, static_cast<uint32_t>(per_[i].size()), avg, jit);
+		if(std::fabs(avg - TICK * 10) > 1.0 || jit > TICK / 10) ok = false;
+	}
+	if(per_[0].size() >= 1 && per_[1].size() >= 1) {
+		double ph = static_cast<double>(per_[1][0] - per_[0][0]) / TICK;
+		std::printf("  phase 1 - 0: %.2f ticks\n", ph);
+		if(std::fabs(ph - 5.0) > 0.1) ok = false;
+	}
+
+	std::printf("  oneshot:");
+	for(auto t : one_) std::printf(" %.2f", static_cast<double>(t) / TICK);
+	std::printf(" ticks\n");
+	if(one_.size() != 3) ok = false;
+	for(size_t i = 1; i < one_.size(); ++i) {
+		if(std::fabs(static_cast<double>(one_[i] - one_[i - 1]) / TICK - 250.0) > 0.1) ok = false;
+	}
+
+	// post からの遅れと、次のティックまでの時間（sync のループの場合）
+	double ev_sum = 0.0, ev_max = 0.0, tk_sum = 0.0, tk_max = 0.0;
+	uint32_t n = 0;
+	size_t j = 0;
+	for(auto t : rx_isr_) {
+		while(j < rx_call_.size() && rx_call_[j] < t) ++j;
+		if(j >= rx_call_.size()) break;
+		double ev = static_cast<double>(rx_call_[j] - t);
+		double tk = static_cast<double>(TICK - (t % TICK));
+		ev_sum += ev;
+		tk_sum += tk;
+		if(ev > ev_max) ev_max = ev;
+		if(tk > tk_max) tk_max = tk;
+		++n;
+	}
+	if(n > 0) {
+		std::printf("  event: %u posts, %u chars, latency avg %7.1f, max %7.1f cycles\n",
+			n, rx_chars_, ev_sum / n, ev_max);
+		std::printf("  tick : (sync loop)         latency avg %7.1f, max %7.1f cycles\n",
+			tk_sum / n, tk_max);
+	}
+	if(n != 40 || rx_chars_ != 40 || ev_max > 500) ok = false;
+
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
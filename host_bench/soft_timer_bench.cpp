@@ -0,0 +1,151 @@
+//=====================================================================//
+/*!	@file
+	@brief	delay（サイクル）と、ソフトウェア・タイマー（soft_timer）の検査 @n
+			・host_io で、delay::cycles、nano、micro の、ループと nop の @n
+			　分け方が、サイクル数と合うかを見る @n
+			・タイマー RB（1000Hz）のティックで、仮想タイマー（１回、周期）の @n
+			　コールバック、has_elapsed、timeout を検査
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cmath>
+#include "host_io.hpp"
+
+#pragma GCC diagnostic ignored "-Wunused-variable"  // レジスター定義（サンプルの Makefile と同じ）
+#include "common/trb_io.hpp"
+#include "common/soft_timer.hpp"
+
+namespace {
+
+	static const uint16_t TICK_FREQ = 1000;
+	static const uint64_t TICK = F_CLK / TICK_FREQ;
+
+	typedef utils::soft_timer<TICK_FREQ, 12> TIMER;
+	typedef device::trb_io<TIMER::tick_task, uint8_t> TIMER_B;
+	TIMER_B	timer_b_;
+
+	device::host_core*	core_;
+
+	std::vector<uint64_t>	call_[12];
+
+	template <uint8_t ID>
+	void cb_() { call_[ID].push_back(core_->now()); }
+
+	template <uint32_t N>
+	bool cycles_(const char* name, void (*fn)())
+	{
+		uint64_t t = core_->now();
+		fn();
+		uint64_t d = core_->now() - t;
+		std::printf("  %-22s %9u cycles (expect %9u)\n", name, static_cast<uint32_t>(d), N);
+		return d == N;
+	}
+}
+
+extern "C" {
+
+	void TIMER_RB_intr(void) {
+		timer_b_.itask();
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+	core_ = &io;
+
+	// 割り込みの無い所で、待ちのサイクルを見る
+	bool ok = true;
+	std::printf("delay  F_CLK %u Hz, loop %u cycles\n", F_CLK, utils::delay::LOOP_CYCLES);
+	io.run([&]() {
+		ok &= cycles_<3>("cycles<3>", utils::delay::cycles<3>);
+		ok &= cycles_<1234>("cycles<1234>", utils::delay::cycles<1234>);
+		ok &= cycles_<400000>("cycles<400000>", utils::delay::cycles<400000>);
+		ok &= cycles_<3>("nano<120>", utils::delay::nano<120>);
+		ok &= cycles_<20 * 250>("micro<250>", utils::delay::micro<250>);
+		ok &= cycles_<20 * 1000 * 20>("micro<20000>", utils::delay::micro<20000>);
+		ok &= cycles_<20 * 37>("micro_second(37)", []() { utils::delay::micro_second(37); });
+		ok &= cycles_<10>("nano_second(500)", []() { utils::delay::nano_second(500); });
+	}, io.msec(100));
+
+	// 仮想タイマー
+	uint16_t dl = 0;
+	bool dl_early = false;
+	uint64_t dl_time = 0;
+	uint64_t tmo_time = 0;
+	uint32_t tmo_pause = 0;
+	uint64_t t0 = 0;
+	bool stop = io.run([&]() {
+		timer_b_.start(TICK_FREQ, 1);
+		// タイムアウト（仮想タイマーの前、service を呼ばない待ち）
+		{
+			uint64_t t = core_->now();
+			TIMER::timeout tmo(40);
+			while(!tmo.expired()) {
+				tmo.pause(1000);
+				++tmo_pause;
+			}
+			tmo_time = core_->now() - t;
+		}
+		t0 = core_->now();
+		TIMER::start(0, TIMER::msec(50), cb_<0>);
+		TIMER::start(1, TIMER::msec(10), cb_<1>, TIMER::msec(10));
+		TIMER::start(2, TIMER::msec(7), cb_<2>, TIMER::msec(33));
+		for(uint8_t i = 3; i < 12; ++i) {
+			TIMER::start(i, i, cb_<11>, 100);  // 多数のタイマーが、同じコールバック
+		}
+		dl = TIMER::deadline(TIMER::msec(25));
+		// 25ms の期限を、sleep で待つ（WAIT）
+		while(!TIMER::has_elapsed(dl)) {
+			if(core_->now() - t0 > TICK * 30) dl_early = true;
+			TIMER::service();
+			TIMER::sleep(1);
+		}
+		dl_time = core_->now() - t0;
+		while(1) {
+			TIMER::service();
+			TIMER::sleep(1);
+		}
+	}, io.msec(500));
+
+	std::printf("soft_timer  %u Hz, %.1f s\n", TICK_FREQ, static_cast<double>(io.now() - t0) / F_CLK);
+	ok &= stop;
+
+	// １回
+	std::printf("  oneshot 0: %u calls at %.2f ms (expect 50)\n",
+		static_cast<uint32_t>(call_[0].size()),
+		call_[0].empty() ? 0.0 : static_cast<double>(call_[0][0] - t0) / TICK);
+	if(call_[0].size() != 1 || std::fabs(static_cast<double>(call_[0][0] - t0) / TICK - 50.0) > 1.0) ok = false;
+	if(TIMER::is_active(0)) ok = false;
+
+	// 周期
+	static const uint32_t per[2] = { 10, 33 };
+	for(uint32_t i = 0; i < 2; ++i) {
+		const auto& v = call_[1 + i];
+		if(v.size() < 2) {
+			ok = false;
+			continue;
+		}
+		double avg = static_cast<double>(v.back() - v.front()) / (v.size() - 1) / TICK;
+		std::printf("  periodic %u: %3u calls, period %6.2f ms (expect %u)\n", 1 + i,
+			static_cast<uint32_t>(v.size()), avg, per[i]);
+		if(std::fabs(avg - per[i]) > 0.01) ok = false;
+	}
+	std::printf("  timers 3..11: %u calls (expect %u)\n",
+		static_cast<uint32_t>(call_[11].size()), 9 * 5);
+	if(call_[11].size() != 9 * 5) ok = false;
+
+	std::printf("  deadline 25 ms: %.2f ms\n", static_cast<double>(dl_time) / TICK);
+	if(dl_early || std::fabs(static_cast<double>(dl_time) / TICK - 25.0) > 1.0) ok = false;
+	std::printf("  timeout 40 ms: %.2f ms, %u pauses (WAIT)\n",
+		static_cast<double>(tmo_time) / TICK, tmo_pause);
+	if(std::fabs(static_cast<double>(tmo_time) / TICK - 40.0) > 1.0) ok = false;
+
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,541 @@
+//=====================================================================//
+/*!	@file
+	@brief	SPI（spi_io、spi_uart_io）のベンチマーク @n
+			・IO_HOST で、ポート・レジスター（ソフト SPI）と、UART0 の @n
+			　クロック同期形シリアル（送信バッファ、シフト・レジスター、@n
+			　TI、RI、TXEPT）をモデル化して、スレーブ（SD カード、ST7565、@n
+			　MAX7219）に繋ぐ @n
+			・xchg、send、recv と、mmc_io（初期化、セクター読み出し）、@n
+			　ST7565（フレーム転送）、MAX7219（service）の時間を、@n
+			　両方のバックエンドで比べる @n
+			・SD カードのデータ、LCD、LED に送ったバイト列を確認 @n
+			　（不一致があれば終了コード１）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#define IO_HOST
+#pragma GCC diagnostic ignored "-Wunused-variable"  // レジスター定義（サンプルの Makefile と同じ）
+#include "common/spi_uart_io.hpp"
+#include "pfatfs/mmc_io.hpp"
+#include "chip/ST7565.hpp"
+#include "chip/MAX7219.hpp"
+
+namespace {
+
+	static const uint32_t ACCESS = 3;		///< レジスター・アクセスのサイクル（命令を含む）
+
+	static const uint16_t P1_ADR = 0x00A9 + 6;
+	static const uint16_t P3_ADR = 0x00AB + 6;
+	static const uint8_t  SPCK_BIT = 6;		///< P1_6（CLK0）
+	static const uint8_t  MOSI_BIT = 4;		///< P1_4（TXD0）
+	static const uint8_t  MISO_BIT = 5;		///< P1_5（RXD0）
+	static const uint8_t  SD_SEL_BIT = 4;	///< P3_4
+	static const uint8_t  LCD_SEL_BIT = 7;	///< P3_7
+	static const uint8_t  LED_SEL_BIT = 3;	///< P3_3
+
+	static const uint16_t UART_ADR = 0x0080;
+	static const uint16_t UBRG_ADR = UART_ADR + 0x01;
+	static const uint16_t UTBL_ADR = UART_ADR + 0x02;
+	static const uint16_t UC0_ADR  = UART_ADR + 0x04;
+	static const uint16_t UC1_ADR  = UART_ADR + 0x05;
+	static const uint16_t URB_ADR  = UART_ADR + 0x06;
+
+	uint8_t reg_[0x10000];	///< レジスター（書き込んだ値）
+	uint64_t now_ = 0;		///< CPU サイクル
+
+	bool bit_(uint16_t adr, uint8_t bit) { return (reg_[adr] >> bit) & 1; }
+
+	uint32_t hash_(uint32_t h, uint8_t d) { return (h ^ d) * 16777619; }
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  SD カード（SPI モード、SDHC、CMD0/8/55/41/58/16/17/18/12）@n
+				セクター s のバイト i は、(s * 7 + i) & 0xff
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct sd_card {
+		uint8_t		cmd[6];
+		uint8_t		cpos;
+		uint8_t		resp[8];
+		uint8_t		rnum;
+		uint8_t		rpos;
+		bool		app;
+		bool		idle;
+		bool		multi;		///< CMD18 の転送中
+		uint32_t	sec;
+		int16_t		dpos;		///< データ・パケット（-3: 無し、-2: トークン待ち、512、513: CRC）
+		uint8_t		gap;
+		uint32_t	cmds;
+
+		void reset() {
+			cpos = 0;
+			rnum = 0;
+			rpos = 0;
+			app = false;
+			idle = true;
+			multi = false;
+			dpos = -3;
+			cmds = 0;
+		}
+
+		void reply_(uint8_t r1, const uint8_t* ext = nullptr, uint8_t n = 0) {
+			resp[0] = 0xFF;  // NCR
+			resp[1] = r1;
+			for(uint8_t i = 0; i < n; ++i) resp[2 + i] = ext[i];
+			rnum = 2 + n;
+			rpos = 0;
+		}
+
+		void command_() {
+			++cmds;
+			uint8_t c = cmd[0] & 0x3F;
+			uint32_t arg = (cmd[1] << 24) | (cmd[2] << 16) | (cmd[3] << 8) | cmd[4];
+			bool a = app;
+			app = false;
+			if(c == 12) {
+				multi = false;
+				dpos = -3;
+				reply_(0x00);
+				return;
+			}
+			switch(c) {
+			case 0:
+				idle = true;
+				reply_(0x01);
+				break;
+			case 8:
+				{
+					static const uint8_t r7[4] = { 0x00, 0x00, 0x01, 0xAA };
+					reply_(0x01, r7, 4);
+				}
+				break;
+			case 55:
+				app = true;
+				reply_(idle ? 0x01 : 0x00);
+				break;
+			case 41:
+				if(a) {
+					reply_(idle ? 0x01 : 0x00);
+					idle = false;  // ２回目で準備完了
+				} else reply_(0x05);
+				break;
+			case 58:
+				{
+					static const uint8_t ocr[4] = { 0xC0, 0xFF, 0x80, 0x00 };  // CCS = 1
+					reply_(0x00, ocr, 4);
+				}
+				break;
+			case 16:
+				reply_(0x00);
+				break;
+			case 17:
+			case 18:
+				sec = arg;
+				multi = c == 18;
+				reply_(0x00);
+				dpos = -2;
+				gap = 3;
+				break;
+			default:
+				reply_(0x05);
+				break;
+			}
+		}
+
+		uint8_t data_() {
+			if(dpos == -2) {
+				if(gap > 0) {
+					--gap;
+					return 0xFF;
+				}
+				dpos = 0;
+				return 0xFE;  // データ・トークン
+			}
+			uint8_t d = dpos < 512 ? static_cast<uint8_t>(sec * 7 + dpos) : 0x00;
+			++dpos;
+			if(dpos == 514) {
+				if(multi) {
+					++sec;
+					dpos = -2;
+					gap = 1;
+				} else {
+					dpos = -3;
+				}
+			}
+			return d;
+		}
+
+		// 次に出すバイト
+		uint8_t out() {
+			if(rpos < rnum) return resp[rpos++];
+			if(dpos >= -2) return data_();
+			return 0xFF;
+		}
+
+		void in(uint8_t d) {
+			if(cpos == 0 && (d & 0xC0) != 0x40) return;
+			cmd[cpos++] = d;
+			if(cpos == 6) {
+				cpos = 0;
+				command_();
+			}
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  SPI バス（選択されたスレーブに、バイト単位で繋ぐ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct spi_bus {
+		sd_card		sd;
+		uint8_t		out;		///< スレーブが出しているバイト
+		uint32_t	lcd_bytes;
+		uint32_t	lcd_hash;
+		uint32_t	led_bytes;
+		uint32_t	led_hash;
+
+		// ソフト SPI
+		bool		spck;
+		uint8_t		bit;
+		uint8_t		shift;
+		bool		miso;
+
+		void reset() {
+			sd.reset();
+			out = 0xFF;
+			lcd_bytes = 0;
+			lcd_hash = 2166136261;
+			led_bytes = 0;
+			led_hash = 2166136261;
+			spck = true;
+			bit = 0;
+			miso = true;
+		}
+
+		// 1 バイトの転送（戻り値は MISO）
+		uint8_t xchg(uint8_t d) {
+			uint8_t r = out;
+			if(!bit_(P3_ADR, SD_SEL_BIT)) sd.in(d);
+			if(!bit_(P3_ADR, LCD_SEL_BIT)) {
+				++lcd_bytes;
+				lcd_hash = hash_(lcd_hash, d);
+			}
+			if(!bit_(P3_ADR, LED_SEL_BIT)) {
+				++led_bytes;
+				led_hash = hash_(led_hash, d);
+			}
+			out = !bit_(P3_ADR, SD_SEL_BIT) ? sd.out() : 0xFF;
+			return r;
+		}
+
+		// ポート（P1）の書き込み：立下りで MISO を出し、立ち上がりで MOSI を取る
+		void port() {
+			bool c = bit_(P1_ADR, SPCK_BIT);
+			if(c == spck) return;
+			spck = c;
+			if(!c) {
+				miso = (out >> (7 - bit)) & 1;
+			} else {
+				shift = (shift << 1) | bit_(P1_ADR, MOSI_BIT);
+				if(++bit == 8) {
+					bit = 0;
+					xchg(shift);
+				}
+			}
+		}
+	};
+
+	spi_bus bus_;
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  UART0 クロック同期形シリアル
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct uart_sync {
+		bool		buf_full;	///< 送信バッファ（UTB）
+		uint8_t		buf;
+		bool		shifting;	///< 送信シフト・レジスター
+		uint8_t		shift;
+		uint64_t	end;
+		bool		ri;
+		uint8_t		urb;
+		uint32_t	overrun;
+
+		void reset() {
+			buf_full = false;
+			shifting = false;
+			ri = false;
+			overrun = 0;
+		}
+
+		uint32_t bit_cycles() const {
+			static const uint8_t sft[4] = { 0, 3, 5, 5 };
+			return (2 * (reg_[UBRG_ADR] + 1)) << sft[reg_[UC0_ADR] & 3];
+		}
+
+		void advance() {
+			while(shifting && now_ >= end) {
+				uint8_t r = bus_.xchg(shift);
+				if(bit_(UC1_ADR, 2)) {  // RE
+					if(ri) ++overrun;
+					else {
+						urb = r;
+						ri = true;
+					}
+				}
+				if(buf_full) {
+					shift = buf;
+					buf_full = false;
+					end += 8 * bit_cycles();
+				} else {
+					shifting = false;
+				}
+			}
+		}
+
+		void write(uint8_t d) {
+			if(!bit_(UC1_ADR, 0)) return;  // TE
+			if(!shifting) {
+				shift = d;
+				shifting = true;
+				end = now_ + 8 * bit_cycles();
+			} else {
+				buf = d;
+				buf_full = true;
+			}
+		}
+	};
+
+	uart_sync uart_;
+}
+
+
+namespace device {
+
+	void io_host_wr8(address_type adr, uint8_t data)
+	{
+		now_ += ACCESS;
+		uart_.advance();
+		reg_[adr] = data;
+		if(adr == P1_ADR) bus_.port();
+		else if(adr == UTBL_ADR) uart_.write(data);
+	}
+
+
+	uint8_t io_host_rd8(address_type adr)
+	{
+		now_ += ACCESS;
+		uart_.advance();
+		uint8_t v = reg_[adr];
+		if(adr == P1_ADR) {
+			v = (v & ~(1 << MISO_BIT)) | (bus_.miso << MISO_BIT);
+		} else if(adr == UC0_ADR) {
+			v = (v & ~0x08) | ((!uart_.shifting && !uart_.buf_full) << 3);  // TXEPT
+		} else if(adr == UC1_ADR) {
+			v = (v & ~0x0A) | (!uart_.buf_full << 1) | (uart_.ri << 3);  // TI、RI
+		} else if(adr == URB_ADR) {
+			v = uart_.urb;
+			uart_.ri = false;
+		} else if(adr == URB_ADR + 1) {
+			v = 0;
+		}
+		return v;
+	}
+
+
+	void io_host_wait()
+	{
+		++now_;
+		uart_.advance();
+	}
+
+	void io_host_delay(uint32_t cycles)
+	{
+		now_ += cycles;
+		uart_.advance();
+	}
+}
+
+
+namespace {
+
+	typedef device::PORT<device::PORT1, device::bitpos::B6> SPCK;
+	typedef device::PORT<device::PORT1, device::bitpos::B4> MOSI;
+	typedef device::PORT<device::PORT1, device::bitpos::B5> MISO;
+
+	typedef device::spi_io<MISO, MOSI, SPCK, device::soft_spi_mode::CK10> SPI_SOFT;
+	typedef device::spi_select<MISO, MOSI, SPCK, device::soft_spi_mode::CK10>::type SPI_UART;
+	static_assert(std::is_same<SPI_UART, device::spi_uart_io<MISO, MOSI, SPCK, device::soft_spi_mode::CK10> >::value,
+		"P1_6/P1_4/P1_5 is UART0");
+	// P4_2 の SPCK は、CLK0 に出来ない
+	typedef device::PORT<device::PORT4, device::bitpos::B2> SPCK_P42;
+	static_assert(std::is_same<device::spi_select<MISO, MOSI, SPCK_P42, device::soft_spi_mode::CK10>::type,
+		device::spi_io<MISO, MOSI, SPCK_P42, device::soft_spi_mode::CK10> >::value, "fall back to spi_io");
+
+	typedef device::PORT<device::PORT3, device::bitpos::B4> SD_SEL;
+	typedef device::PORT<device::PORT3, device::bitpos::B7> LCD_SEL;
+	typedef device::PORT<device::PORT4, device::bitpos::B5> LCD_A0;
+	typedef device::PORT<device::PORT4, device::bitpos::B7> LCD_RES;
+	typedef device::PORT<device::PORT3, device::bitpos::B3> LED_SEL;
+
+	struct result_t {
+		double		us;
+		uint32_t	bytes;
+		uint32_t	hash;
+	};
+
+	void begin_() {
+		uart_.advance();
+		if(uart_.shifting) uart_.end -= now_;
+		now_ = 0;
+	}
+
+	double us_() { return static_cast<double>(now_) * 1e6 / F_CLK; }
+
+	void reset_() {
+		std::memset(reg_, 0, sizeof(reg_));
+		reg_[P1_ADR] = 0xFF;
+		reg_[P3_ADR] = 0xFF;  // 選択無し
+		bus_.reset();
+		uart_.reset();
+	}
+
+
+	// xchg、send、recv（512 バイト、MAX7219 を選択して、送ったバイトを数える）
+	template <class SPI>
+	bool raw_(SPI& spi, uint32_t speed, result_t res[3])
+	{
+		reset_();
+		spi.start(speed);
+		LED_SEL::DIR = 1;
+		LED_SEL::P = 0;
+		uint8_t src[512];
+		for(uint16_t i = 0; i < sizeof(src); ++i) src[i] = i * 13;
+		uint8_t dst[512];
+
+		begin_();
+		for(uint16_t i = 0; i < sizeof(src); ++i) spi.xchg(src[i]);
+		res[0].us = us_();
+		res[0].hash = bus_.led_hash;
+
+		begin_();
+		spi.send(src, sizeof(src));
+		res[1].us = us_();
+		res[1].hash = bus_.led_hash;
+
+		begin_();
+		spi.recv(dst, sizeof(dst));
+		res[2].us = us_();
+		res[2].hash = bus_.led_hash;
+		LED_SEL::P = 1;
+		return bus_.led_bytes == 512 * 3 && uart_.overrun == 0;
+	}
+
+
+	// mmc_io：初期化と、64 セクターの連続読み出し
+	template <class SPI>
+	bool mmc_(SPI& spi, result_t& init, result_t& read)
+	{
+		reset_();
+		pfatfs::mmc_io<SPI, SD_SEL> mmc(spi);
+		begin_();
+		if(mmc.disk_initialize() != 0) return false;
+		init.us = us_();
+		init.bytes = bus_.sd.cmds;
+
+		begin_();
+		bool ok = true;
+		uint8_t buf[512];
+		for(uint32_t s = 100; s < 164; ++s) {
+			if(mmc.disk_readp(buf, s, 0, sizeof(buf)) != RES_OK) return false;
+			for(uint16_t i = 0; i < sizeof(buf); ++i) {
+				if(buf[i] != static_cast<uint8_t>(s * 7 + i)) ok = false;
+			}
+		}
+		read.us = us_();
+		read.bytes = 64 * 512;
+		mmc.stop_stream();
+		return ok && uart_.overrun == 0;
+	}
+
+
+	// ST7565：128 x 64 のフレーム転送、MAX7219（４個）の service
+	template <class SPI>
+	bool lcd_led_(SPI& spi, result_t& lcd, result_t& led)
+	{
+		reset_();
+		spi.start(0);
+		chip::ST7565<SPI, LCD_SEL, LCD_A0, LCD_RES> st7565(spi);
+		st7565.start(0x10);
+		static uint8_t fb[1024];
+		for(uint16_t i = 0; i < sizeof(fb); ++i) fb[i] = i ^ (i >> 3);
+		uint32_t n = bus_.lcd_bytes;
+		begin_();
+		st7565.copy(fb, 8);
+		lcd.us = us_();
+		lcd.bytes = bus_.lcd_bytes - n;
+		lcd.hash = bus_.lcd_hash;
+
+		chip::MAX7219<SPI, LED_SEL, 4> max7219(spi);
+		max7219.start();
+		for(uint8_t i = 0; i < 32; ++i) max7219.set(i, i * 5);
+		n = bus_.led_bytes;
+		begin_();
+		max7219.service();
+		led.us = us_();
+		led.bytes = bus_.led_bytes - n;
+		led.hash = bus_.led_hash;
+		return uart_.overrun == 0;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	bool ok = true;
+	SPI_SOFT soft;
+	SPI_UART hard;
+
+	std::printf("F_CLK: %u Hz, register access: %u cycles\n\n", F_CLK, ACCESS);
+
+	result_t rs[3] = { }, rh[3] = { }, rh4[3] = { };
+	ok &= raw_(soft, 0, rs);
+	ok &= raw_(hard, 0, rh);
+	ok &= raw_(hard, 4000000, rh4);
+	std::printf("%-20s %14s %14s %14s\n", "512 bytes", "spi_io", "uart 10 MHz", "uart 4 MHz");
+	static const char* name[3] = { "xchg", "send", "recv" };
+	for(uint8_t i = 0; i < 3; ++i) {
+		std::printf("%-20s %8.1f us %8.1f us %8.1f us  %s\n", name[i], rs[i].us, rh[i].us, rh4[i].us,
+			(rs[i].hash == rh[i].hash && rs[i].hash == rh4[i].hash) ? "" : "FAIL");
+		ok &= rs[i].hash == rh[i].hash && rs[i].hash == rh4[i].hash;
+	}
+
+	result_t si = { }, sr = { }, hi = { }, hr = { };
+	bool fs = mmc_(soft, si, sr);
+	bool fh = mmc_(hard, hi, hr);
+	std::printf("\n%-20s %14s %14s\n", "", "spi_io", "spi_uart_io");
+	std::printf("%-20s %8.1f us %8.1f us  %s\n", "mmc disk_initialize*", si.us, hi.us, (fs && fh) ? "" : "FAIL");
+	std::printf("%-20s %8.1f KB/s %6.1f KB/s  %s\n", "mmc 64 sectors", sr.bytes / sr.us * 1e6 / 1024.0,
+		hr.bytes / hr.us * 1e6 / 1024.0, (fs && fh) ? "" : "FAIL");
+	ok &= fs && fh;
+
+	result_t sl = { }, sd = { }, hl = { }, hd = { };
+	bool f = lcd_led_(soft, sl, sd) && lcd_led_(hard, hl, hd) && sl.hash == hl.hash && sd.hash == hd.hash;
+	std::printf("%-20s %8.1f us %8.1f us  %s\n", "ST7565 copy 8 pages", sl.us, hl.us, f ? "" : "FAIL");
+	std::printf("%-20s %8.1f us %8.1f us  %s\n", "MAX7219 x4 service", sd.us, hd.us, f ? "" : "FAIL");
+	ok &= f;
+	std::printf("\n* spi_io delay loops (slow start speed) are not counted\n");
+
+	return ok ? 0 : 1;
+}
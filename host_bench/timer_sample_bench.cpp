@@ -0,0 +1,51 @@
+//=====================================================================//
+/*!	@file
+	@brief	TIMER_sample を、ホスト・シミュレーター（host_io）で動かす @n
+			・TIMER_sample/main.cpp を、変更無しでリンクする（Makefile）@n
+			・タイマー RB（60Hz）の割り込みで、LED0（P1_0、負論理）が、１秒周期 @n
+			　（High 20 フレーム、Low 40 フレーム）で点滅するかを検査 @n
+			・割り込みの負荷と、シミュレーションの速度を表示
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <chrono>
+#include <cmath>
+#include "host_io.hpp"
+
+int sample_main(int argc, char* argv[]);
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+
+	std::vector<uint64_t> fall;
+	io.port.on_edge = [&](uint8_t no, uint8_t bit, bool lvl, uint64_t t) {
+		if(no == 1 && bit == 0 && !lvl) fall.push_back(t);
+	};
+
+	auto st = std::chrono::steady_clock::now();
+	bool stop = io.run([]() { sample_main(0, nullptr); }, io.msec(5000));
+	auto et = std::chrono::steady_clock::now();
+	double host = std::chrono::duration<double>(et - st).count();
+	double sim = static_cast<double>(io.now()) / F_CLK;
+
+	bool ok = stop && fall.size() >= 3;
+	double period = 0.0;
+	double duty = static_cast<double>(io.port.get_high(1, 0)) / io.now() * 100.0;
+	if(ok) {
+		auto n = fall.size() - 1;
+		period = static_cast<double>(fall.back() - fall.front()) / n / F_CLK * 1e3;
+		ok = std::fabs(period - 1000.0) < 1.0 && std::fabs(duty - 100.0 / 3.0) < 1.0;
+	}
+
+	std::printf("TIMER_sample  %.1f s, host %.3f s (x%.0f)\n", sim, host, sim / host);
+	std::printf("  LED0 (P1_0) %u edges, period %8.3f ms, high %5.1f %%\n",
+		io.port.get_pin(1, 0).edges, period, duty);
+	std::printf("  LED1 (P1_1) %u edges\n", io.port.get_pin(1, 1).edges);
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+//=====================================================================//
+/*!	@file
+	@brief	UART_sample を、ホスト・シミュレーター（host_io）で動かす @n
+			・UART_sample/main.cpp を、変更無しでリンクする（Makefile）@n
+			・UART0（57600 bps、割り込み）の送信を取り込み、コマンド入力 @n
+			　（数値、数値以外）を与えて、応答を検査 @n
+			・10ms ソフト・タイマー（delay）のループで、LED0（P1_0）の周期 @n
+			　（50 ループ）を表示
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <chrono>
+#include "host_io.hpp"
+
+int sample_main(int argc, char* argv[]);
+
+namespace {
+
+	void print_(const std::string& s)
+	{
+		std::printf("  | ");
+		for(char ch : s) {
+			if(ch == '\r') continue;
+			else if(ch == '\n') std::printf("\n  | ");
+			else if(ch == 0x1b) std::printf("<ESC>");
+			else std::putchar(ch);
+		}
+		std::printf("\n");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	device::host_io io;
+
+	std::vector<uint64_t> fall;
+	io.port.on_edge = [&](uint8_t no, uint8_t bit, bool lvl, uint64_t t) {
+		if(no == 1 && bit == 0 && !lvl) fall.push_back(t);
+	};
+	io.at(io.msec(100), [&]() { io.uart.input("123\r"); });
+	io.at(io.msec(300), [&]() { io.uart.input("abc\r"); });
+
+	auto st = std::chrono::steady_clock::now();
+	bool stop = io.run([]() { sample_main(0, nullptr); }, io.msec(2000));
+	auto et = std::chrono::steady_clock::now();
+	double host = std::chrono::duration<double>(et - st).count();
+	double sim = static_cast<double>(io.now()) / F_CLK;
+
+	const auto& s = io.uart.get_send();
+	static const char* expect[] = {
+		"Start R8C UART sample\r\n",
+		"Real baud rate: 59523\r\n",
+		"Value: 123, 0x7B\r\n",
+		"Input only decimal: 'abc'\r\n",
+	};
+	bool ok = stop;
+	for(auto e : expect) {
+		if(s.find(e) == std::string::npos) ok = false;
+	}
+	double period = 0.0;
+	if(fall.size() >= 2) {
+		period = static_cast<double>(fall.back() - fall.front()) / (fall.size() - 1) / F_CLK * 1e3;
+	} else {
+		ok = false;
+	}
+
+	std::printf("UART_sample  %.1f s, host %.3f s (x%.0f)\n", sim, host, sim / host);
+	print_(s);
+	std::printf("  send %u bytes, frame %.2f us, overrun %u\n", static_cast<uint32_t>(s.size()),
+		static_cast<double>(io.uart.frame()) * 1e6 / F_CLK, io.uart.overrun);
+	std::printf("  LED0 (P1_0) period %8.3f ms (50 x 10ms delay)\n", period);
+	io.list_intr();
+	std::printf("  %s\n", ok ? "ok" : "NG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,429 @@
+//=====================================================================//
+/*!	@file
+	@brief	リンカーの .map から、RAM、ROM の静的な使用量を表にする（ホスト・ツール）@n
+			・Memory Configuration の領域毎の使用量と、ユーザー、割り込みの @n
+			　スタックに残る大きさ（_usp_init、_isp_init）@n
+			・オブジェクト（アーカイブのメンバー）毎の ROM、data、bss @n
+			・テンプレートのインスタンス（クラス毎、関数テンプレート毎）@n
+			　g++ は、テンプレート、インライン関数、テンプレートの静的メンバーを、@n
+			　名前付きのセクション（.text._ZN...）に置くので、その大きさを集める @n
+			※data は、RAM と、ROM（初期値）の両方に数える
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cxxabi.h>
+
+namespace {
+
+	struct region_t {
+		std::string	name;
+		uint64_t	org;
+		uint64_t	len;
+		bool		ram;
+		uint64_t	used;
+	};
+
+	enum class KIND {
+		NONE,	///< 数えない（デバッグ情報など）
+		ROM,	///< ROM だけ
+		DATA,	///< RAM と ROM（初期値）
+		BSS,	///< RAM だけ
+	};
+
+	struct size_t_ {
+		uint64_t	rom = 0;
+		uint64_t	data = 0;
+		uint64_t	bss = 0;
+		uint32_t	num = 0;
+
+		void add(KIND k, uint64_t n) {
+			if(k == KIND::ROM) rom += n;
+			else if(k == KIND::DATA) { rom += n; data += n; }
+			else if(k == KIND::BSS) bss += n;
+			++num;
+		}
+		uint64_t total() const { return rom + data + bss; }
+	};
+
+	typedef std::map<std::string, size_t_> table_t;
+
+	std::vector<region_t>	regions_;
+
+
+	std::vector<std::string> split_(const char* line)
+	{
+		std::vector<std::string> out;
+		const char* p = line;
+		while(1) {
+			while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') ++p;
+			if(*p == 0) break;
+			const char* s = p;
+			while(*p != 0 && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') ++p;
+			out.emplace_back(s, p - s);
+		}
+		return out;
+	}
+
+
+	bool hex_(const std::string& s, uint64_t& v)
+	{
+		if(s.size() < 3 || s[0] != '0' || s[1] != 'x') return false;
+		char* e;
+		v = std::strtoull(s.c_str() + 2, &e, 16);
+		return *e == 0;
+	}
+
+
+	const region_t* find_region_(uint64_t adr)
+	{
+		for(const auto& r : regions_) {
+			if(r.org <= adr && adr < (r.org + r.len)) return &r;
+		}
+		return nullptr;
+	}
+
+
+	// 出力セクションの種類（領域が無い場合は、名前で決める）
+	KIND kind_(const std::string& name, uint64_t vma, bool has_lma, uint64_t lma)
+	{
+		if(!regions_.empty()) {
+			auto r = find_region_(vma);
+			if(r == nullptr) return KIND::NONE;
+			if(!r->ram) return KIND::ROM;
+			if(has_lma) {
+				auto l = find_region_(lma);
+				if(l != nullptr && l != r) return KIND::DATA;
+			}
+			return KIND::BSS;
+		}
+		static const char* rom[] = { ".text", ".rodata", ".exttext", ".init", ".fini",
+			".vvec", ".fvec", ".eh_frame", ".gcc_except_table", nullptr };
+		for(const char** p = rom; *p != nullptr; ++p) {
+			if(name.compare(0, std::strlen(*p), *p) == 0) return KIND::ROM;
+		}
+		if(name.compare(0, 5, ".data") == 0 || name.compare(0, 7, ".ctors") == 0
+			|| name.compare(0, 7, ".dtors") == 0 || name.compare(0, 11, ".init_array") == 0
+			|| name.compare(0, 11, ".fini_array") == 0) return KIND::DATA;
+		if(name.compare(0, 4, ".bss") == 0) return KIND::BSS;
+		return KIND::NONE;
+	}
+
+
+	// ファイル名（ディレクトリを除く、アーカイブは「lib.a(member.o)」）
+	std::string object_(const std::string& path)
+	{
+		auto pos = path.rfind('(');
+		auto base = path.rfind('/', pos == std::string::npos ? path.size() : pos);
+		if(base == std::string::npos) return path;
+		return path.substr(base + 1);
+	}
+
+
+	// セクション名から、マングルされた名前を取り出す（m32c の「__Z」も）
+	std::string mangled_(const std::string& sec)
+	{
+		for(size_t i = 0; i < sec.size(); ++i) {
+			if(sec[i] != '.') continue;
+			auto s = sec.substr(i + 1);
+			if(s.compare(0, 2, "_Z") == 0) return s;
+			if(s.compare(0, 3, "__Z") == 0) return s.substr(1);
+		}
+		return std::string();
+	}
+
+
+	std::string demangle_(const std::string& m)
+	{
+		int st = 0;
+		char* p = abi::__cxa_demangle(m.c_str(), nullptr, nullptr, &st);
+		if(p == nullptr || st != 0) return m;
+		std::string s = p;
+		std::free(p);
+		return s;
+	}
+
+
+	// 関数、変数の名前から、インスタンスのまとまり（クラス、又は関数）を作る
+	// テンプレートでなければ、空
+	std::string group_(std::string s)
+	{
+		static const char* pre[] = { "vtable for ", "typeinfo for ", "typeinfo name for ",
+			"guard variable for ", nullptr };
+		for(const char** p = pre; *p != nullptr; ++p) {
+			auto n = std::strlen(*p);
+			if(s.compare(0, n, *p) == 0) {
+				s = s.substr(n);
+				return s.find('<') != std::string::npos ? s : std::string();
+			}
+		}
+
+		// 引数のリスト（最後の、上位の括弧）を取る
+		{
+			int d = 0;
+			size_t arg = std::string::npos;
+			for(size_t i = 0; i < s.size(); ++i) {
+				char ch = s[i];
+				if(d == 0 && ch == '(' && s.compare(i, 21, "(anonymous namespace)") != 0) arg = i;
+				if(ch == '<' || ch == '(') ++d;
+				else if((ch == '>' || ch == ')') && d > 0) --d;
+			}
+			if(arg != std::string::npos) s = s.substr(0, arg);
+		}
+
+		// 関数テンプレートの戻り値の型（最後の、上位の空白の前）を取る、
+		// 最後の、上位の「::」の前が、クラス
+		int d = 0;
+		size_t sep = std::string::npos;
+		for(size_t i = 0; i < s.size(); ++i) {
+			char ch = s[i];
+			if(ch == '<' || ch == '(') ++d;
+			else if((ch == '>' || ch == ')') && d > 0) --d;
+			else if(d == 0 && ch == ' ' && !(i >= 8 && s.compare(i - 8, 8, "operator") == 0)) {
+				s = s.substr(i + 1);
+				i = static_cast<size_t>(-1);
+				sep = std::string::npos;
+			} else if(d == 0 && ch == ':' && (i + 1) < s.size() && s[i + 1] == ':') {
+				sep = i;
+				++i;
+			}
+		}
+		if(sep != std::string::npos) {
+			auto cls = s.substr(0, sep);
+			if(cls.find('<') != std::string::npos) return cls;
+		}
+		return s.find('<') != std::string::npos ? s : std::string();
+	}
+
+
+	std::string kb_(uint64_t n)
+	{
+		char tmp[32];
+		std::snprintf(tmp, sizeof(tmp), "%6u", static_cast<uint32_t>(n));
+		return tmp;
+	}
+
+
+	void print_table_(const char* title, const table_t& tab, uint32_t limit)
+	{
+		std::vector<std::pair<std::string, size_t_>> v(tab.begin(), tab.end());
+		std::stable_sort(v.begin(), v.end(), [](const std::pair<std::string, size_t_>& a,
+			const std::pair<std::string, size_t_>& b) { return a.second.total() > b.second.total(); });
+
+		size_t_ sum;
+		std::printf("\n%s\n", title);
+		std::printf("     ROM   data    bss    RAM  name\n");
+		uint32_t n = 0;
+		for(const auto& t : v) {
+			sum.rom += t.second.rom;
+			sum.data += t.second.data;
+			sum.bss += t.second.bss;
+			if(limit > 0 && n >= limit) continue;
+			std::printf("  %s %s %s %s  %s", kb_(t.second.rom).c_str(), kb_(t.second.data).c_str(),
+				kb_(t.second.bss).c_str(), kb_(t.second.data + t.second.bss).c_str(), t.first.c_str());
+			if(t.second.num > 1) std::printf("  (%u)", t.second.num);
+			std::printf("\n");
+			++n;
+		}
+		if(limit > 0 && v.size() > limit) {
+			std::printf("  ... %u more\n", static_cast<uint32_t>(v.size() - limit));
+		}
+		std::printf("  %s %s %s %s  (total)\n", kb_(sum.rom).c_str(), kb_(sum.data).c_str(),
+			kb_(sum.bss).c_str(), kb_(sum.data + sum.bss).c_str());
+	}
+
+
+	void help_(const char* cmd)
+	{
+		std::fprintf(stderr, "usage: %s [options] map-file\n", cmd);
+		std::fprintf(stderr, "  -a       all named sections (inline, not only templates)\n");
+		std::fprintf(stderr, "  -s       list each template member\n");
+		std::fprintf(stderr, "  -n num   rows of each table (default 0: all)\n");
+		std::fprintf(stderr, "  (reads stdin when map-file is '-')\n");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	bool all = false;
+	bool member = false;
+	uint32_t limit = 0;
+	std::string file;
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-a") all = true;
+		else if(p == "-s") member = true;
+		else if(p == "-n" && (i + 1) < argc) limit = std::strtoul(argv[++i], nullptr, 10);
+		else if((p[0] == '-' && p != "-") || !file.empty()) {
+			help_(argv[0]);
+			return 1;
+		} else file = p;
+	}
+	if(file.empty()) {
+		help_(argv[0]);
+		return 1;
+	}
+
+	FILE* fp = stdin;
+	if(file != "-") {
+		fp = std::fopen(file.c_str(), "rb");
+		if(fp == nullptr) {
+			std::fprintf(stderr, "Can't open map: '%s'\n", file.c_str());
+			return 1;
+		}
+	}
+
+	enum class STEP { TOP, MEMORY, MAP, END };
+	STEP step = STEP::TOP;
+
+	table_t objs;
+	table_t insts;
+	table_t mems;
+	std::map<std::string, uint64_t> syms;
+	uint64_t bss_end = 0;
+
+	KIND kind = KIND::NONE;
+	std::string out_name;	// 名前だけの行（次の行に、アドレスと大きさ）
+	std::string in_name;
+	char tmp[4096];
+	while(std::fgets(tmp, sizeof(tmp), fp) != nullptr) {
+		if(std::strncmp(tmp, "Memory Configuration", 20) == 0) {
+			step = STEP::MEMORY;
+			continue;
+		} else if(std::strncmp(tmp, "Linker script and memory map", 28) == 0) {
+			step = STEP::MAP;
+			continue;
+		} else if(std::strncmp(tmp, "Cross Reference Table", 21) == 0) {
+			step = STEP::END;
+		}
+		auto ss = split_(tmp);
+		if(ss.empty()) continue;
+
+		if(step == STEP::MEMORY) {
+			region_t r;
+			if(ss.size() >= 3 && ss[0] != "*default*" && hex_(ss[1], r.org) && hex_(ss[2], r.len)) {
+				r.name = ss[0];
+				r.ram = ss.size() >= 4 && ss[3].find_first_of("wW") != std::string::npos;
+				r.used = 0;
+				regions_.push_back(r);
+			}
+			continue;
+		}
+		if(step != STEP::MAP) continue;
+
+		// シンボルの代入（_usp_init = 0x7c0 など）
+		uint64_t a, n;
+		if(ss.size() >= 3 && hex_(ss[0], a) && ss[2] == "=") {
+			syms[ss[1]] = a;
+			continue;
+		}
+
+		if(tmp[0] == '.' || !out_name.empty()) {  // 出力セクション
+			if(tmp[0] == '.') {
+				out_name = ss[0];
+				ss.erase(ss.begin());
+				if(ss.empty()) continue;  // 名前が長いと、次の行
+			}
+			std::string name = out_name;
+			out_name.clear();
+			if(ss.size() < 2 || !hex_(ss[0], a) || !hex_(ss[1], n)) continue;
+			uint64_t lma = 0;
+			bool has_lma = ss.size() >= 5 && ss[2] == "load" && ss[3] == "address" && hex_(ss[4], lma);
+			kind = kind_(name, a, has_lma, lma);
+			if(kind != KIND::NONE && n > 0) {
+				mems[name].add(kind, n);
+				if(!regions_.empty()) {
+					for(auto& r : regions_) {
+						if(r.org <= a && a < (r.org + r.len)) r.used += n;
+						else if(has_lma && r.org <= lma && lma < (r.org + r.len)) r.used += n;
+					}
+				}
+				if(kind == KIND::BSS && (a + n) > bss_end) bss_end = a + n;
+				if(kind == KIND::DATA && bss_end == 0) bss_end = a + n;
+			}
+			continue;
+		}
+
+		if(tmp[0] != ' ' || kind == KIND::NONE) continue;
+
+		// 入力セクション（「 .text._ZN...」、名前が長いと、次の行）
+		if(tmp[1] != ' ') {
+			if(ss[0][0] == '*' && ss[0] != "*fill*") continue;  // *(.text ...)
+			in_name = ss[0];
+			ss.erase(ss.begin());
+			if(ss.empty()) continue;
+		} else if(in_name.empty()) continue;
+		std::string name = in_name;
+		in_name.clear();
+		if(ss.size() < 2 || !hex_(ss[0], a) || !hex_(ss[1], n) || n == 0) continue;
+		if(name == "*fill*") {
+			objs["(fill)"].add(kind, n);
+			continue;
+		}
+		std::string obj = ss.size() >= 3 ? object_(ss[2]) : std::string("(linker)");
+		objs[obj].add(kind, n);
+
+		auto m = mangled_(name);
+		if(m.empty()) continue;
+		auto dm = demangle_(m);
+		auto g = group_(dm);
+		if(g.empty()) {
+			if(!all) continue;
+			g = dm;
+		}
+		insts[g].add(kind, n);
+		if(member) {
+			std::printf("  %6u  %-8s %s\n", static_cast<uint32_t>(n),
+				name.substr(0, name.find('.', 1)).c_str(), dm.c_str());
+		}
+	}
+	if(fp != stdin) std::fclose(fp);
+
+	if(mems.empty()) {
+		std::fprintf(stderr, "No memory map found\n");
+		return 1;
+	}
+
+	if(!regions_.empty()) {
+		std::printf("Region        origin   length     used     free\n");
+		for(const auto& r : regions_) {
+			std::printf("  %-8s %8X %8u %8u %8d  (%.1f %%)\n", r.name.c_str(),
+				static_cast<uint32_t>(r.org), static_cast<uint32_t>(r.len),
+				static_cast<uint32_t>(r.used), static_cast<int32_t>(r.len - r.used),
+				r.len > 0 ? 100.0 * r.used / r.len : 0.0);
+		}
+	}
+
+	// スタックの領域（m120an.ld: bss の後ろ 〜 _usp_init 〜 _isp_init）
+	auto usp = syms.find("_usp_init");
+	auto isp = syms.find("_isp_init");
+	if(usp != syms.end() && isp != syms.end() && bss_end > 0) {
+		std::printf("Stack  bss end: %04X, _usp_init: %04X, _isp_init: %04X\n",
+			static_cast<uint32_t>(bss_end), static_cast<uint32_t>(usp->second),
+			static_cast<uint32_t>(isp->second));
+		std::printf("  user: %d bytes (free RAM), interrupt: %d bytes\n",
+			static_cast<int32_t>(usp->second - bss_end),
+			static_cast<int32_t>(isp->second - usp->second));
+		if(bss_end > usp->second) {
+			std::printf("  static RAM overlaps the user stack\n");
+		}
+	}
+
+	print_table_("Output section", mems, 0);
+	print_table_("Object", objs, limit);
+	if(!insts.empty()) {
+		print_table_(all ? "Template instance, inline" : "Template instance", insts, limit);
+	}
+	return 0;
+}
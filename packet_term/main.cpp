@@ -0,0 +1,270 @@
+//=====================================================================//
+/*!	@file
+	@brief	R8C バイナリー・パケット通信、ホスト側ツール @n
+			・「PACKET_sample」と、COBS + CRC-16 フレームで通信する @n
+			・エコー試験で、実効転送速度、エラー数を計測 @n
+			・「--loopback」では、デバイス無しで、メモリー上で送受信を検証
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include "r8cprog/rs232c_io.hpp"
+#include "common/packet_io.hpp"
+
+namespace {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  メモリー上のシリアル（ループバック用）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class memory_sio {
+		std::deque<char>	q_;
+	public:
+		uint16_t length() const { return q_.size() > 0xffff ? 0xffff : q_.size(); }
+		char getch() { char ch = q_.front(); q_.pop_front(); return ch; }
+		void putch_raw(char ch) { q_.push_back(ch); }
+		std::deque<char>& at_queue() { return q_; }
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  シリアル・ポート
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class serial_sio {
+		utils::rs232c_io&	rs_;
+		std::deque<char>	q_;
+		std::vector<char>	out_;
+		uint32_t			send_count_;
+		uint32_t			recv_count_;
+	public:
+		serial_sio(utils::rs232c_io& rs) : rs_(rs), send_count_(0), recv_count_(0) { }
+
+		uint16_t length() {
+			if(q_.empty()) {
+				char tmp[256];
+				timeval tv;
+				tv.tv_sec  = 0;
+				tv.tv_usec = 2000;
+				auto n = rs_.recv(tmp, sizeof(tmp), tv);
+				for(size_t i = 0; i < n; ++i) q_.push_back(tmp[i]);
+				recv_count_ += n;
+			}
+			return q_.size() > 0xffff ? 0xffff : q_.size();
+		}
+		char getch() { char ch = q_.front(); q_.pop_front(); return ch; }
+		void putch_raw(char ch) { out_.push_back(ch); }
+		void flush() {
+			if(out_.empty()) return;
+			rs_.send(&out_[0], out_.size());
+			send_count_ += out_.size();
+			out_.clear();
+		}
+		uint32_t get_send_count() const { return send_count_; }
+		uint32_t get_recv_count() const { return recv_count_; }
+	};
+
+
+	struct options {
+		std::string	com_path;
+		uint32_t	com_speed = 115200;
+		uint32_t	count = 1000;
+		uint32_t	length = 64;
+		bool		loopback = false;
+		bool		help = false;
+	};
+
+
+	bool get_speed_(uint32_t baud, speed_t& speed)
+	{
+		switch(baud) {
+		case 9600:   speed = B9600;   break;
+		case 19200:  speed = B19200;  break;
+		case 38400:  speed = B38400;  break;
+		case 57600:  speed = B57600;  break;
+		case 115200: speed = B115200; break;
+		default:
+			return false;
+		}
+		return true;
+	}
+
+
+	void help_(const char* cmd)
+	{
+		using namespace std;
+		cout << "R8C binary packet terminal (COBS + CRC-16)" << endl;
+		cout << "usage:" << endl;
+		cout << cmd << " [options]" << endl;
+		cout << endl;
+		cout << "Options :" << endl;
+		cout << "-P, --port=PORT\t\t\tSpecify serial port" << endl;
+		cout << "-s, --speed=SPEED\t\tSpecify serial speed (default 115200)" << endl;
+		cout << "    --count=N\t\t\tNumber of echo frames (default 1000)" << endl;
+		cout << "    --length=N\t\t\tPayload length (1 to 64, default 64)" << endl;
+		cout << "    --loopback\t\t\tEncode/decode check in memory (no device)" << endl;
+		cout << "-h, --help\t\t\tDisplay this" << endl;
+	}
+
+
+	int loopback_(const options& opts)
+	{
+		memory_sio sio;
+		utils::packet_io<memory_sio> pio(sio);
+		std::vector<uint8_t> rb(1024 + utils::packet_io<memory_sio>::CRC_SIZE);
+		pio.set_buffer(&rb[0], rb.size());
+
+		std::mt19937 rnd(1);
+		uint32_t err = 0;
+		uint32_t detect = 0;
+		uint32_t corrupt = 0;
+		for(uint32_t n = 0; n < opts.count; ++n) {
+			// ゼロの多いパターン、２５４バイト境界などを含める
+			uint32_t len = rnd() % 1024 + 1;
+			std::vector<uint8_t> src(len);
+			uint32_t mode = rnd() % 3;
+			for(auto& d : src) {
+				if(mode == 0) d = rnd();
+				else if(mode == 1) d = (rnd() % 4) == 0 ? 0 : rnd();
+				else d = 0xFF;
+			}
+			pio.send(&src[0], len);
+
+			// 一定の割合で、１ビットを反転
+			bool flip = (n % 8) == 7;
+			if(flip) {
+				auto& q = sio.at_queue();
+				auto pos = rnd() % (q.size() - 1);
+				char ch = q[pos] ^ (1 << (rnd() % 8));
+				if(ch == 0) ch = 0x55;
+				q[pos] = ch;
+				++corrupt;
+			}
+
+			bool ok = pio.service();
+			if(flip) {
+				if(!ok) ++detect;
+				else if(pio.get_length() != len || std::memcmp(&rb[0], &src[0], len) != 0) ++err;
+				while(pio.service()) ;
+				sio.at_queue().clear();
+			} else if(!ok || pio.get_length() != len || std::memcmp(&rb[0], &src[0], len) != 0) {
+				std::cerr << "Loopback error: frame " << n << ", length " << len << std::endl;
+				++err;
+			}
+		}
+		std::cout << "Frames: " << opts.count << ", errors: " << err << std::endl;
+		std::cout << "Corrupted: " << corrupt << ", detected: " << detect << std::endl;
+		return err == 0 ? 0 : 1;
+	}
+
+
+	int echo_(const options& opts)
+	{
+		speed_t speed;
+		if(!get_speed_(opts.com_speed, speed)) {
+			std::cerr << "Serial speed error: " << opts.com_speed << std::endl;
+			return -1;
+		}
+		utils::rs232c_io rs;
+		if(!rs.open(opts.com_path, speed)) {
+			std::cerr << "Can't open serial port: '" << opts.com_path << "'" << std::endl;
+			return -1;
+		}
+
+		serial_sio sio(rs);
+		utils::packet_io<serial_sio> pio(sio);
+		uint8_t rb[64 + utils::packet_io<serial_sio>::CRC_SIZE];
+		pio.set_buffer(rb, sizeof(rb));
+
+		std::mt19937 rnd(1);
+		uint32_t err = 0;
+		uint32_t timeout = 0;
+		auto st = std::chrono::steady_clock::now();
+		for(uint32_t n = 0; n < opts.count; ++n) {
+			uint8_t src[64];
+			for(uint32_t i = 0; i < opts.length; ++i) src[i] = rnd();
+			pio.send(src, opts.length);
+			sio.flush();
+
+			auto t = std::chrono::steady_clock::now();
+			bool ok = false;
+			while((std::chrono::steady_clock::now() - t) < std::chrono::milliseconds(500)) {
+				if(pio.service()) {
+					ok = true;
+					break;
+				}
+			}
+			if(!ok) {
+				++timeout;
+			} else if(pio.get_length() != opts.length || std::memcmp(rb, src, opts.length) != 0) {
+				++err;
+			}
+		}
+		auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - st).count();
+		rs.close();
+
+		double sec = static_cast<double>(us) / 1e6;
+		uint32_t payload = opts.count * opts.length * 2;
+		std::cout << "Frames: " << opts.count << ", payload: " << opts.length << " bytes" << std::endl;
+		std::cout << "Errors: " << err << ", timeouts: " << timeout
+			<< ", CRC errors: " << pio.get_crc_error()
+			<< ", frame errors: " << pio.get_frame_error() << std::endl;
+		std::cout << "Line bytes: " << (sio.get_send_count() + sio.get_recv_count())
+			<< ", payload bytes: " << payload << std::endl;
+		if(sec > 0.0) {
+			std::cout << "Effective payload rate: " << static_cast<uint32_t>(payload / sec)
+				<< " bytes/sec" << std::endl;
+		}
+		return (err == 0 && timeout == 0) ? 0 : 1;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	options opts;
+	bool dp = false;
+	bool br = false;
+	for(int i = 1; i < argc; ++i) {
+		const std::string p = argv[i];
+		if(dp) { opts.com_path = p; dp = false; }
+		else if(br) { opts.com_speed = std::strtoul(p.c_str(), nullptr, 10); br = false; }
+		else if(p == "-P") dp = true;
+		else if(p.compare(0, 7, "--port=") == 0) opts.com_path = p.substr(7);
+		else if(p == "-s") br = true;
+		else if(p.compare(0, 8, "--speed=") == 0) opts.com_speed = std::strtoul(&p[8], nullptr, 10);
+		else if(p.compare(0, 8, "--count=") == 0) opts.count = std::strtoul(&p[8], nullptr, 10);
+		else if(p.compare(0, 9, "--length=") == 0) opts.length = std::strtoul(&p[9], nullptr, 10);
+		else if(p == "--loopback") opts.loopback = true;
+		else if(p == "-h" || p == "--help") opts.help = true;
+		else {
+			std::cerr << "Option error: '" << p << "'" << std::endl;
+			opts.help = true;
+		}
+	}
+
+	if(opts.loopback && !opts.help) {
+		return loopback_(opts);
+	}
+
+	if(opts.help || opts.com_path.empty() || opts.length == 0 || opts.length > 64) {
+		help_(argv[0]);
+		return 0;
+	}
+
+	return echo_(opts);
+}
@@ -2,6 +2,10 @@
 //=====================================================================//
 /*!	@file
 	@brief	MMC（SD カード）pFatFS ドライバー @n
+			読み出しは、CMD18（マルチブロック）の転送を開いたままにして、@n
+			同じセクターの続き、次のセクターを、ストリームから読む @n
+			（不連続な読み出し、書き込みの時に、CMD12 で転送を止める） @n
+			SPI バスを他のデバイスと共有する場合は、stop_stream() で止めてから使う @n
 			Copyright 2016 Kunihito Hiramatsu
 	@author	平松邦仁 (hira@rvf-rc45.net)
 */
@@ -19,9 +23,10 @@ namespace pfatfs {
 		@brief  MMC テンプレートクラス
 		@param[in]	SPI	SPI クラス
 		@param[in]	SEL	デバイス選択クラス
+		@param[in]	TIMEOUT	タイムアウト（utils::delay_timeout、soft_timer の timeout）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class SPI, class SEL>
+	template <class SPI, class SEL, class TIMEOUT = utils::delay_timeout>
 	class mmc_io {
 
 		SPI	&spi_;
@@ -32,8 +37,10 @@ namespace pfatfs {
 			CMD1    = 0x40 + 1,		/* SEND_OP_COND (MMC) */
 			ACMD41  = 0xC0 + 41,	/* SEND_OP_COND (SDC) */
 			CMD8    = 0x40 + 8,		/* SEND_IF_COND */
+			CMD12   = 0x40 + 12,	/* STOP_TRANSMISSION */
 			CMD16   = 0x40 + 16,	/* SET_BLOCKLEN */
 			CMD17   = 0x40 + 17,	/* READ_SINGLE_BLOCK */
+			CMD18   = 0x40 + 18,	/* READ_MULTIPLE_BLOCK */
 			CMD24   = 0x40 + 24,	/* WRITE_BLOCK */
 			CMD55   = 0x40 + 55,	/* APP_CMD */
 			CMD58   = 0x40 + 58,	/* READ_OCR */
@@ -47,6 +54,11 @@ namespace pfatfs {
 
 		BYTE CardType;			/* b0:MMC, b1:SDv1, b2:SDv2, b3:Block addressing */
 
+		bool	stream_;	///< ストリーム・モード
+		bool	open_;		///< CMD18 の転送中
+		DWORD	sec_;		///< 転送中のセクター（LBA）
+		UINT	pos_;		///< 転送中のセクター内の位置
+
 		void forward_(BYTE d) { }
 
 		void skip_(uint16_t num)
@@ -67,6 +79,27 @@ namespace pfatfs {
 		}
 
 
+		//---------------------------------------------------------------//
+		//  Wait for a data token, poll without delay first (max 100ms)
+		//---------------------------------------------------------------//
+		bool wait_token_()
+		{
+			BYTE d;
+			UINT n = 1000;
+			do {
+				d = spi_.xchg();
+			} while(d == 0xFF && --n) ;
+			if(d == 0xFF) {
+				TIMEOUT t(100);
+				do {
+					t.pause(100);
+					d = spi_.xchg();
+				} while(d == 0xFF && !t.expired()) ;
+			}
+			return d == 0xFE;
+		}
+
+
 		//---------------------------------------------------------------//
 		//  Send a command packet to MMC
 		//---------------------------------------------------------------//
@@ -79,12 +112,14 @@ namespace pfatfs {
 				if(res > 1) return res;
 			}
 
-			// Select the card
-			SEL::P = 1;
-			spi_.xchg();
+			// Select the card（CMD12 は、転送中の選択のまま送る）
+			if(cm != command::CMD12) {
+				SEL::P = 1;
+				spi_.xchg();
 
-			SEL::P = 0;
-			spi_.xchg();
+				SEL::P = 0;
+				spi_.xchg();
+			}
 
 			// Send a command packet
 			uint8_t tmp[5];
@@ -98,6 +133,7 @@ namespace pfatfs {
 			if(cm == command::CMD0) n = 0x95;  // Valid CRC for CMD0(0)
 			if(cm == command::CMD8) n = 0x87;  // Valid CRC for CMD8(0x1AA)
 			spi_.xchg(n);
+			if(cm == command::CMD12) spi_.xchg();  // Discard a stuff byte
 
 			// Receive a command response
 			BYTE res;
@@ -111,13 +147,107 @@ namespace pfatfs {
 			return res;  // Return with the response value
 		}
 
+		// 受信（buff が NULL ならストリームへ転送）
+		void recv_(BYTE* buff, UINT count)
+		{
+			if(buff) {  // Store data to the memory
+				spi_.recv(buff, count);
+			} else {	/* Forward data to the outgoing stream */
+				do {
+					auto d = spi_.xchg();
+					forward_(d);
+				} while(--count) ;
+			}
+		}
+
+
+		DRESULT read_single_(BYTE* buff, DWORD sector, UINT offset, UINT count)
+		{
+			if(!(CardType & CT_BLOCK)) sector *= 512;  // Convert to byte address if needed
+
+			DRESULT res = RES_ERROR;
+			if(send_cmd_(command::CMD17, sector) == 0) {  // READ_SINGLE_BLOCK
+				if(wait_token_()) {  // A data packet arrived
+					UINT bc = 514 - offset - count;
+
+					// Skip leading bytes
+					if(offset) {
+						skip_(offset);
+					}
+
+					// Receive a part of the sector
+					recv_(buff, count);
+
+					// Skip trailing bytes and CRC
+					skip_(bc);
+					res = RES_OK;
+				}
+			}
+			release_spi_();
+			return res;
+		}
+
+
+		// CMD18 の転送を開始して、先頭のデータ・トークンを待つ
+		bool open_stream_(DWORD sector)
+		{
+			DWORD adr = sector;
+			if(!(CardType & CT_BLOCK)) adr *= 512;  // Convert to byte address if needed
+
+			if(send_cmd_(command::CMD18, adr) != 0) {  // READ_MULTIPLE_BLOCK
+				release_spi_();
+				return false;
+			}
+			open_ = true;
+			if(!wait_token_()) {
+				stop_stream();
+				return false;
+			}
+			sec_ = sector;
+			pos_ = 0;
+			return true;
+		}
+
 		public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		mmc_io(SPI& spi) : spi_(spi) { }
+		mmc_io(SPI& spi) : spi_(spi), CardType(0),
+			stream_(true), open_(false), sec_(0), pos_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ストリーム読み出しの許可
+			@param[in]	ena	「false」なら、毎回 CMD17 で読む
+		*/
+		//-----------------------------------------------------------------//
+		void enable_stream(bool ena = true)
+		{
+			if(!ena) stop_stream();
+			stream_ = ena;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ストリーム読み出しを止めて、SPI バスを解放する
+		*/
+		//-----------------------------------------------------------------//
+		void stop_stream()
+		{
+			if(!open_) return;
+			open_ = false;
+			send_cmd_(command::CMD12, 0);  // STOP_TRANSMISSION
+			// Wait for ready (max 100ms)
+			TIMEOUT t(100);
+			while(spi_.xchg() != 0xFF && !t.expired()) {
+				t.pause(100);
+			}
+			release_spi_();
+		}
 
 
 		//-----------------------------------------------------------------//
@@ -128,7 +258,8 @@ namespace pfatfs {
 		//-----------------------------------------------------------------//
 		DSTATUS disk_initialize()
 		{
-			spi_.start(10);  // setup slow clock
+			open_ = false;
+			spi_.start(400000);  // setup slow clock（初期化は 400 kHz 以下）
 
 			SEL::DIR = 1;
 			SEL::P = 1;
@@ -142,12 +273,12 @@ namespace pfatfs {
 					// Get trailing return value of R7 resp
 					spi_.recv(buf, 4);
 					if(buf[2] == 0x01 && buf[3] == 0xAA) {	// The card can work at vdd range of 2.7-3.6V
-						UINT tmr;
-						for(tmr = 1000; tmr; tmr--) {      // Wait for leaving idle state (ACMD41 with HCS bit)
-							if (send_cmd_(command::ACMD41, 1UL << 30) == 0) break;
-							utils::delay::micro_second(1000);
+						TIMEOUT t(1000);  // Wait for leaving idle state (ACMD41 with HCS bit)
+						BYTE r;
+						while((r = send_cmd_(command::ACMD41, 1UL << 30)) != 0 && !t.expired()) {
+							t.pause(1000);
 						}
-						if(tmr && send_cmd_(command::CMD58, 0) == 0) {  // Check CCS bit in the OCR
+						if(r == 0 && send_cmd_(command::CMD58, 0) == 0) {  // Check CCS bit in the OCR
 							spi_.recv(buf, 4);
 							ty = (buf[0] & 0x40) ? CT_SD2 | CT_BLOCK : CT_SD2;	// SDv2 (HC or SC)
 						}
@@ -162,12 +293,12 @@ namespace pfatfs {
 						ty = CT_MMC;
 						cmd = command::CMD1;	// MMCv3
 					}
-					uint16_t tmr;
-					for(tmr = 1000; tmr; tmr--) {  // Wait for leaving idle state
-						if(send_cmd_(cmd, 0) == 0) break;
-						utils::delay::micro_second(1000);
+					TIMEOUT t(1000);  // Wait for leaving idle state
+					BYTE r;
+					while((r = send_cmd_(cmd, 0)) != 0 && !t.expired()) {
+						t.pause(1000);
 					}
-					if(!tmr || send_cmd_(command::CMD16, 512) != 0) {  // Set R/W block length to 512
+					if(r != 0 || send_cmd_(command::CMD16, 512) != 0) {  // Set R/W block length to 512
 						ty = 0;
 					}
 				}
@@ -193,41 +324,30 @@ namespace pfatfs {
 		//-----------------------------------------------------------------//
 		DRESULT disk_readp(BYTE* buff, DWORD sector, UINT offset, UINT count)
 		{
-			if(!(CardType & CT_BLOCK)) sector *= 512;  // Convert to byte address if needed
-
-			DRESULT res = RES_ERROR;
-			if(send_cmd_(command::CMD17, sector) == 0) {  // READ_SINGLE_BLOCK
-				UINT tmr = 1000;
-				BYTE d;
-				do {  // wait for data packet in timeout of 100ms
-					utils::delay::micro_second(100);
-					d = spi_.xchg();
-				} while (d == 0xFF && --tmr) ;
-
-				if(d == 0xFE) {  // A data packet arrived
-					UINT bc = 514 - offset - count;
-
-					// Skip leading bytes
-					if(offset) {
-						skip_(offset);
-					}
+			if(!stream_) return read_single_(buff, sector, offset, count);
 
-					// Receive a part of the sector
-					if(buff) {  // Store data to the memory
-						spi_.recv(buff, count);
-					} else {	/* Forward data to the outgoing stream */
-						do {
-							auto d = spi_.xchg();
-							forward_(d);
-						} while(--count) ;
-					}
-					// Skip trailing bytes and CRC
-					skip_(bc);
-					res = RES_OK;
+			if(open_ && sector == (sec_ + 1)) {  // 次のセクター
+				skip_(512 - pos_ + 2);  // Skip trailing bytes and CRC
+				if(!wait_token_()) {
+					stop_stream();
+					return RES_ERROR;
 				}
+				sec_ = sector;
+				pos_ = 0;
+			} else if(!open_ || sector != sec_ || offset < pos_) {  // 不連続
+				stop_stream();
+				if(!open_stream_(sector)) return RES_ERROR;
 			}
-			release_spi_();
-			return res;
+
+			// Skip leading bytes
+			if(offset > pos_) {
+				skip_(offset - pos_);
+			}
+
+			// Receive a part of the sector
+			recv_(buff, count);
+			pos_ = offset + count;
+			return RES_OK;
 		}
 
 
@@ -244,6 +364,8 @@ namespace pfatfs {
 		{
 			static UINT wc;
 
+			if(!buff && sc) stop_stream();
+
 			DRESULT res = RES_ERROR;
 
 			UINT bc;
@@ -272,11 +394,12 @@ namespace pfatfs {
 					// Receive data resp and wait for end of write process in timeout of 300ms
 					if((spi_.xchg() & 0x1F) == 0x05) {
 						// Wait for ready (max 1000ms)
-						uint16_t tmr;
-						for(tmr = 10000; spi_.xchg() != 0xFF && tmr; tmr--) {
-							utils::delay::micro_second(100);
+						TIMEOUT t(1000);
+						BYTE d;
+						while((d = spi_.xchg()) != 0xFF && !t.expired()) {
+							t.pause(100);
 						}
-						if(tmr) res = RES_OK;
+						if(d == 0xFF) res = RES_OK;
 					}
 					release_spi_();
 				}
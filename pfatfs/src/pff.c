@@ -55,6 +55,10 @@
 #define _FS_32ONLY 0
 #endif
 
+#if _FAT_CACHE && ((_FAT_CACHE & (_FAT_CACHE - 1)) || _FAT_CACHE < 8 || _FAT_CACHE > 512)
+#error Wrong _FAT_CACHE setting.
+#endif
+
 #define ABORT(err)	{fs->flag = 0; return err;}
 
 
@@ -341,6 +345,43 @@ int mem_cmp (const void* dst, const void* src, int cnt) {
 
 
 
+/*-----------------------------------------------------------------------*/
+/* FAT access - Read bytes of the FAT through the cache                  */
+/*-----------------------------------------------------------------------*/
+
+static
+DRESULT read_fat (
+	BYTE* buf,		/* Pointer to the read buffer */
+	DWORD sect,		/* FAT sector */
+	UINT ofs,		/* Byte offset in the sector */
+	UINT cnt		/* Number of bytes to read (never crosses the sector) */
+)
+{
+#if _FAT_CACHE
+	FATFS *fs = FatFs;
+	UINT i;
+
+
+	while (cnt--) {						/* An entry may cross the window (FAT12) */
+		i = ofs % _FAT_CACHE;
+		if (fs->fc_sect != sect || fs->fc_ofs != ofs - i) {	/* Cache miss? */
+			fs->fc_sect = 0;
+			if (disk_readp(fs->fc_buf, sect, ofs - i, _FAT_CACHE)) return RES_ERROR;
+			fs->fc_sect = sect;
+			fs->fc_ofs = ofs - i;
+		}
+		*buf++ = fs->fc_buf[i];
+		ofs++;
+	}
+	return RES_OK;
+#else
+	return disk_readp(buf, sect, ofs, cnt);
+#endif
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT access - Read value of a FAT entry                                */
 /*-----------------------------------------------------------------------*/
@@ -364,10 +405,10 @@ CLUST get_fat (	/* 1:IO error, Else:Cluster status */
 		bc = (UINT)clst; bc += bc / 2;
 		ofs = bc % 512; bc /= 512;
 		if (ofs != 511) {
-			if (disk_readp(buf, fs->fatbase + bc, ofs, 2)) break;
+			if (read_fat(buf, fs->fatbase + bc, ofs, 2)) break;
 		} else {
-			if (disk_readp(buf, fs->fatbase + bc, 511, 1)) break;
-			if (disk_readp(buf+1, fs->fatbase + bc + 1, 0, 1)) break;
+			if (read_fat(buf, fs->fatbase + bc, 511, 1)) break;
+			if (read_fat(buf+1, fs->fatbase + bc + 1, 0, 1)) break;
 		}
 		wc = LD_WORD(buf);
 		return (clst & 1) ? (wc >> 4) : (wc & 0xFFF);
@@ -375,12 +416,12 @@ CLUST get_fat (	/* 1:IO error, Else:Cluster status */
 #endif
 #if _FS_FAT16
 	case FS_FAT16 :
-		if (disk_readp(buf, fs->fatbase + clst / 256, ((UINT)clst % 256) * 2, 2)) break;
+		if (read_fat(buf, fs->fatbase + clst / 256, ((UINT)clst % 256) * 2, 2)) break;
 		return LD_WORD(buf);
 #endif
 #if _FS_FAT32
 	case FS_FAT32 :
-		if (disk_readp(buf, fs->fatbase + clst / 128, ((UINT)clst % 128) * 4, 4)) break;
+		if (read_fat(buf, fs->fatbase + clst / 128, ((UINT)clst % 128) * 4, 4)) break;
 		return LD_DWORD(buf) & 0x0FFFFFFF;
 #endif
 	}
@@ -391,6 +432,131 @@ CLUST get_fat (	/* 1:IO error, Else:Cluster status */
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Fast seek - Cluster run table of the open file                        */
+/*-----------------------------------------------------------------------*/
+#if _FAST_SEEK
+
+/* Start the table with the first cluster (no FAT access) */
+static
+void init_runs (void)
+{
+	FATFS *fs = FatFs;
+
+
+	fs->n_run = 0;
+	fs->run_ncl = 0;
+	fs->run_full = 1;
+	if (!fs->fsize || !fs->org_clust) return;
+	fs->run_clst[0] = fs->org_clust;
+	fs->run_len[0] = 1;
+	fs->n_run = 1;
+	fs->run_ncl = 1;
+	fs->run_full = 0;
+}
+
+
+/* Record a cluster found by following the chain (only the next one of the table) */
+static
+void add_run (
+	DWORD idx,		/* Cluster index from top of the file */
+	CLUST clst		/* Cluster# of the index */
+)
+{
+	FATFS *fs = FatFs;
+	BYTE i;
+
+
+	if (fs->run_full || idx != fs->run_ncl) return;
+	i = fs->n_run - 1;
+	if (clst == fs->run_clst[i] + fs->run_len[i]) {	/* Contiguous */
+		fs->run_len[i]++;
+	} else {							/* Fragmented, start a new run */
+		if (fs->n_run >= _FAST_SEEK) {	/* Table full, follow the rest with get_fat() */
+			fs->run_full = 1;
+			return;
+		}
+		fs->run_clst[fs->n_run] = clst;
+		fs->run_len[fs->n_run++] = 1;
+	}
+	fs->run_ncl++;
+}
+
+
+/* Extend the table ahead from its end (up to RUN_AHEAD links in a burst, so
+   FAT reads are not interleaved with the data stream on every cluster) */
+#define RUN_AHEAD	128
+
+static
+void follow_runs (void)
+{
+	FATFS *fs = FatFs;
+	CLUST clst, ncl;
+	WORD n;
+
+
+	ncl = (CLUST)((fs->fsize - 1) / 512 / fs->csize) + 1;	/* Number of clusters of the file */
+	for (n = 0; n < RUN_AHEAD && !fs->run_full && fs->run_ncl < ncl; n++) {
+		clst = fs->run_clst[fs->n_run - 1] + fs->run_len[fs->n_run - 1] - 1;	/* Last cluster in the table */
+		clst = get_fat(clst);
+		if (clst <= 1 || clst >= fs->n_fatent) break;
+		add_run(fs->run_ncl, clst);
+	}
+}
+
+
+/* Get cluster# of the cluster index in the file (0:Not in the table) */
+static
+CLUST run_clust (
+	DWORD idx		/* Cluster index from top of the file */
+)
+{
+	FATFS *fs = FatFs;
+	BYTE i;
+
+
+	for (i = 0; i < fs->n_run; i++) {
+		if (idx < fs->run_len[i]) return fs->run_clst[i] + (CLUST)idx;
+		idx -= fs->run_len[i];
+	}
+	return 0;
+}
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Get next cluster of the open file (fptr is on the cluster boundary)   */
+/*-----------------------------------------------------------------------*/
+#if _USE_READ || _USE_WRITE
+
+static
+CLUST next_clust (void)	/* 1:IO error, Else:Cluster status */
+{
+	FATFS *fs = FatFs;
+#if _FAST_SEEK
+	CLUST clst;
+	DWORD idx;
+
+
+	idx = fs->fptr / 512 / fs->csize;
+	clst = run_clust(idx);
+	if (clst) return clst;
+	if (!fs->run_full && idx == fs->run_ncl) {	/* Next to the table, extend it */
+		follow_runs();
+		clst = run_clust(idx);
+		if (clst) return clst;
+	}
+	return get_fat(fs->curr_clust);
+#else
+	return get_fat(fs->curr_clust);
+#endif
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Get sector# from cluster# / Get cluster field from directory entry    */
 /*-----------------------------------------------------------------------*/
@@ -814,6 +980,13 @@ FRESULT pf_mount (
 	fs->database = fs->fatbase + fsize + fs->n_rootdir / 16;	/* Data start sector (lba) */
 
 	fs->flag = 0;
+#if _FAT_CACHE
+	fs->fc_sect = 0;
+#endif
+#if _FAST_SEEK
+	fs->n_run = 0;
+	fs->run_full = 1;
+#endif
 	FatFs = fs;
 
 	return FR_OK;
@@ -848,6 +1021,9 @@ FRESULT pf_open (
 	fs->org_clust = get_clust(dir);		/* File start cluster */
 	fs->fsize = LD_DWORD(dir+DIR_FileSize);	/* File size */
 	fs->fptr = 0;						/* File pointer */
+#if _FAST_SEEK
+	init_runs();						/* Cluster run table (extended on the way) */
+#endif
 	fs->flag = FA_OPENED;
 
 	return FR_OK;
@@ -890,7 +1066,7 @@ FRESULT pf_read (
 				if (fs->fptr == 0)					/* On the top of the file? */
 					clst = fs->org_clust;
 				else
-					clst = get_fat(fs->curr_clust);
+					clst = next_clust();
 				if (clst <= 1) ABORT(FR_DISK_ERR);
 				fs->curr_clust = clst;				/* Update current cluster */
 			}
@@ -954,7 +1130,7 @@ FRESULT pf_write (
 				if (fs->fptr == 0)					/* On the top of the file? */
 					clst = fs->org_clust;
 				else
-					clst = get_fat(fs->curr_clust);
+					clst = next_clust();
 				if (clst <= 1) ABORT(FR_DISK_ERR);
 				fs->curr_clust = clst;				/* Update current cluster */
 			}
@@ -1004,6 +1180,21 @@ FRESULT pf_lseek (
 	fs->fptr = 0;
 	if (ofs > 0) {
 		bcs = (DWORD)fs->csize * 512;	/* Cluster size (byte) */
+#if _FAST_SEEK
+		clst = run_clust((ofs - 1) / bcs);	/* Look up the run table */
+		if (clst) {
+			fs->curr_clust = clst;
+			fs->fptr = ofs;
+			sect = clust2sect(clst);
+			if (!sect) ABORT(FR_DISK_ERR);
+			fs->dsect = sect + (fs->fptr / 512 & (fs->csize - 1));
+			return FR_OK;
+		}
+		if (!fs->run_full) {			/* Follow the chain from the end of the table */
+			ifptr = (DWORD)fs->run_ncl * bcs;
+			fs->curr_clust = run_clust(fs->run_ncl - 1);
+		}
+#endif
 		if (ifptr > 0 &&
 			(ofs - 1) / bcs >= (ifptr - 1) / bcs) {	/* When seek to same or following cluster, */
 			fs->fptr = (ifptr - 1) & ~(bcs - 1);	/* start from the current cluster */
@@ -1019,6 +1210,9 @@ FRESULT pf_lseek (
 			fs->curr_clust = clst;
 			fs->fptr += bcs;
 			ofs -= bcs;
+#if _FAST_SEEK
+			add_run(fs->fptr / bcs, clst);	/* Extend the table */
+#endif
 		}
 		fs->fptr += ofs;
 		sect = clust2sect(clst);		/* Current sector */
@@ -52,6 +52,18 @@ typedef struct {
 	CLUST	org_clust;	/* File start cluster */
 	CLUST	curr_clust;	/* File current cluster */
 	DWORD	dsect;		/* File current data sector */
+#if _FAT_CACHE
+	DWORD	fc_sect;	/* FAT cache sector (0:Invalid) */
+	WORD	fc_ofs;		/* FAT cache offset in the sector */
+	BYTE	fc_buf[_FAT_CACHE];	/* FAT cache */
+#endif
+#if _FAST_SEEK
+	BYTE	n_run;		/* Number of cluster runs in the table */
+	BYTE	run_full;	/* The table can not be extended any more */
+	CLUST	run_ncl;	/* Number of clusters covered by the table */
+	CLUST	run_clst[_FAST_SEEK];	/* Start cluster of each run */
+	CLUST	run_len[_FAST_SEEK];	/* Number of clusters in each run */
+#endif
 } FATFS;
 
 
@@ -18,6 +18,23 @@
 #define _FS_FAT16	1	/* Enable FAT16 */
 #define _FS_FAT32	1	/* Enable FAT32 */
 
+#ifndef _FAT_CACHE		/* Can be given from the command line (host_bench) */
+#define _FAT_CACHE	16	/* FAT entry cache in byte (0:Disable, 8..512 power of 2) */
+#endif
+/* get_fat() reads an aligned window of _FAT_CACHE bytes and keeps it in the
+/  FATFS object, so following entries of a contiguous chain cost no disk access.
+/  FAT is never modified by Petit FatFs, so the cache does not go stale. */
+
+#ifndef _FAST_SEEK
+#define _FAST_SEEK	2	/* Number of cluster runs held for the open file (0:Disable) */
+#endif
+/* The cluster chain of the open file is recorded as runs of contiguous clusters
+/  (2 * sizeof(CLUST) bytes each). pf_open() records only the first cluster, and
+/  the table is extended while pf_read()/pf_write()/pf_lseek() follow the chain,
+/  so each FAT entry is read at most once and opening a file costs no FAT access.
+/  pf_lseek() and cluster advance look the cluster up in the table. Once the
+/  table is full, clusters beyond the last run are followed with get_fat(). */
+
 
 /*---------------------------------------------------------------------------/
 / Locale and Namespace Configurations
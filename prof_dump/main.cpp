@@ -0,0 +1,177 @@
+//=====================================================================//
+/*!	@file
+	@brief	prof（PROF_SCOPE）のダンプ・デコーダー（ホスト・ツール） @n
+			・端末のログ（ファイル、又は標準入力）から、「PROF」〜「END」を @n
+			　探して、id 毎の回数、最小、平均、最大を、サイクルと [us] で表示 @n
+			・ログに、他の出力や「\r」が混ざっていても良い、複数の表は、順に表示
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace {
+
+	struct head_t {
+		uint32_t	clk;
+		uint32_t	shift;
+		uint32_t	ovh;
+		uint32_t	num;
+	};
+
+	struct entry_t {
+		uint32_t	id;
+		uint32_t	count;
+		uint32_t	min;
+		uint32_t	max;
+		uint32_t	sum;
+	};
+
+	typedef std::map<uint32_t, std::string> names_t;
+
+
+	// 「TAG hex hex ...」を分解（TAG が違う、数が足りない場合 false）
+	bool split_(const char* line, const char* tag, uint32_t* out, uint32_t num)
+	{
+		const char* p = line;
+		while(*tag != 0) {
+			if(*p++ != *tag++) return false;
+		}
+		for(uint32_t i = 0; i < num; ++i) {
+			if(*p != ' ') return false;
+			++p;
+			char* e;
+			unsigned long v = std::strtoul(p, &e, 16);
+			if(e == p) return false;
+			out[i] = static_cast<uint32_t>(v);
+			p = e;
+		}
+		while(*p == '\r' || *p == '\n' || *p == ' ') ++p;
+		return *p == 0;
+	}
+
+
+	void print_(const head_t& h, const std::vector<entry_t>& tab, const names_t& names)
+	{
+		double us = 1e6 / static_cast<double>(h.clk);
+		uint32_t k = 1 << h.shift;
+		std::printf("F_CLK: %u [Hz], tick: %u cycles (%.3f us), overhead: %u cycles\n",
+			h.clk, k, k * us, h.ovh * k);
+		std::printf("  id name             count        min        avg        max"
+					"      total\n");
+		for(const auto& e : tab) {
+			std::string name;
+			auto it = names.find(e.id);
+			if(it != names.end()) name = it->second;
+			if(e.count == 0) {
+				std::printf("  %2u %-12s %9u          -          -          -          -\n",
+					e.id, name.c_str(), e.count);
+				continue;
+			}
+			double avg = static_cast<double>(e.sum) / e.count;
+			std::printf("  %2u %-12s %9u %10u %10.1f %10u %10.0f  cycles\n",
+				e.id, name.c_str(), e.count, e.min * k, avg * k, e.max * k,
+				static_cast<double>(e.sum) * k);
+			std::printf("  %2s %-12s %9s %10.2f %10.2f %10.2f %10.3f  us (total ms)\n",
+				"", "", "", e.min * k * us, avg * k * us, e.max * k * us,
+				static_cast<double>(e.sum) * k * us * 1e-3);
+		}
+		for(const auto& e : tab) {
+			if(e.count >= 0xFFFF) {
+				std::printf("  (count saturated at 65535, clear the table more often)\n");
+				break;
+			}
+		}
+	}
+
+
+	void help_(const char* cmd)
+	{
+		std::fprintf(stderr, "usage: %s [options] [log-file]\n", cmd);
+		std::fprintf(stderr, "  -n id=name   name of the id (repeatable)\n");
+		std::fprintf(stderr, "  (reads stdin when no log-file)\n");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	names_t names;
+	std::string file;
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-n" && (i + 1) < argc) {
+			std::string s = argv[++i];
+			auto pos = s.find('=');
+			if(pos == std::string::npos || pos == 0) {
+				help_(argv[0]);
+				return 1;
+			}
+			names[std::strtoul(s.substr(0, pos).c_str(), nullptr, 10)] = s.substr(pos + 1);
+		} else if(p[0] == '-' || !file.empty()) {
+			help_(argv[0]);
+			return 1;
+		} else file = p;
+	}
+
+	FILE* fp = stdin;
+	if(!file.empty()) {
+		fp = std::fopen(file.c_str(), "rb");
+		if(fp == nullptr) {
+			std::fprintf(stderr, "Can't open log: '%s'\n", file.c_str());
+			return 1;
+		}
+	}
+
+	head_t h = { 0, 0, 0, 0 };
+	std::vector<entry_t> tab;
+	bool in = false;
+	uint32_t blocks = 0;
+	char tmp[256];
+	while(std::fgets(tmp, sizeof(tmp), fp) != nullptr) {
+		const char* line = tmp;
+		while(*line == '\r') ++line;
+		uint32_t v[5];
+		if(split_(line, "PROF", v, 4)) {
+			h.clk = v[0];
+			h.shift = v[1];
+			h.ovh = v[2];
+			h.num = v[3];
+			if(h.clk == 0 || h.shift > 16) continue;
+			tab.clear();
+			in = true;
+		} else if(in && split_(line, "P", v, 5)) {
+			entry_t e;
+			e.id = v[0];
+			e.count = v[1];
+			e.min = v[2];
+			e.max = v[3];
+			e.sum = v[4];
+			tab.push_back(e);
+		} else if(in && split_(line, "END", v, 0)) {
+			in = false;
+			if(tab.size() != h.num) {
+				std::fprintf(stderr, "Broken table: %u / %u lines\n",
+					static_cast<uint32_t>(tab.size()), h.num);
+				continue;
+			}
+			if(blocks > 0) std::printf("\n");
+			print_(h, tab, names);
+			++blocks;
+		}
+	}
+	if(fp != stdin) std::fclose(fp);
+
+	if(blocks == 0) {
+		std::fprintf(stderr, "No PROF table found\n");
+		return 1;
+	}
+	return 0;
+}
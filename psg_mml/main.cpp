@@ -0,0 +1,814 @@
+//=====================================================================//
+/*!	@file
+	@brief	psg_mng 用 MML コンパイラー（ホスト・ツール） @n
+			・MML のテキストを、psg_mng のスコア（ヘッダー）に変換して、@n
+			　標準出力に出す（統計は標準エラー） @n
+			・同じキーが続く場合、音長が表に有れば、パック・ノート（１バイト）にする @n
+			・連続する休符をまとめ、繰り返し現れる部分を、サブ・スコア（CALL0 〜 7）@n
+			　に括り出す
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "common/psg_mng.hpp"
+
+namespace {
+
+	typedef utils::psg_base PSG;
+
+	static const uint8_t KEY_Q = static_cast<uint8_t>(PSG::KEY::Q);
+	static const uint8_t CH_NUM = 8;
+	static const uint8_t SUB_NUM = 8;
+	static const uint32_t SUB_MAX = 96;  // サブ・スコアの最大イベント数
+
+	uint8_t ctrl_(PSG::CTRL c) { return static_cast<uint8_t>(c); }
+
+	struct event_t {
+		enum class type : uint8_t {
+			NOTE,	///< key, len
+			REST,	///< len（２５５を超える事がある）
+			CTRL,	///< code
+			FOR,	///< len（回数）
+			BEFORE,
+			CALL,	///< key（サブ・スコア番号）
+			TERM,	///< code（END、REPEAT）
+		};
+		type		t;
+		uint8_t		key;
+		uint16_t	len;
+		std::vector<uint8_t> code;
+
+		event_t(type t_, uint8_t k = 0, uint16_t l = 0) : t(t_), key(k), len(l) { }
+
+		void append(std::string& s) const
+		{
+			s += static_cast<char>(t);
+			s += static_cast<char>(key);
+			s += static_cast<char>(len);
+			s += static_cast<char>(len >> 8);
+			s += static_cast<char>(code.size());
+			s.append(code.begin(), code.end());
+		}
+	};
+	typedef std::vector<event_t> stream_t;
+
+
+	//-------------------------------------------------------------//
+	// パーサー
+	//-------------------------------------------------------------//
+	class parser {
+		struct state_t {
+			int		oct;
+			uint16_t len;
+			bool	loop;
+			bool	term;
+			uint32_t plain;  // 従来形式のバイト数
+			state_t() : oct(4), len(16), loop(false), term(false), plain(0) { }
+		};
+
+		const char*	file_;
+		uint32_t	line_;
+		const char*	p_;
+		std::string	err_;
+
+		state_t		state_[CH_NUM];
+
+		bool error_(const char* msg)
+		{
+			if(err_.empty()) {
+				err_ = std::string(file_) + ":" + std::to_string(line_) + ": " + msg;
+			}
+			return false;
+		}
+
+		void skip_() { while(*p_ == ' ' || *p_ == '\t') ++p_; }
+
+		bool number_(int& n)
+		{
+			skip_();
+			bool neg = false;
+			if(*p_ == '-' || *p_ == '+') {
+				neg = *p_ == '-';
+				++p_;
+			}
+			if(*p_ < '0' || *p_ > '9') return false;
+			n = 0;
+			while(*p_ >= '0' && *p_ <= '9') {
+				n = n * 10 + (*p_ - '0');
+				if(n > 100000) return false;
+				++p_;
+			}
+			if(neg) n = -n;
+			return true;
+		}
+
+		// 音長（分割数と付点、「%」は直接の値）、省略時は def
+		bool length_(uint16_t def, uint16_t& len)
+		{
+			skip_();
+			int n = 0;
+			uint16_t base;
+			if(*p_ == '%') {
+				++p_;
+				if(!number_(n) || n <= 0 || n > 0xffff) return error_("bad length");
+				len = n;
+				return true;
+			} else if(*p_ >= '0' && *p_ <= '9') {
+				number_(n);
+				if(n <= 0 || n > 64 || (64 % n) != 0) return error_("bad length");
+				base = 64 / n;
+			} else {
+				base = def;
+			}
+			len = base;
+			while(*p_ == '.') {
+				if((base & 1) != 0) return error_("too many dots");
+				base /= 2;
+				len += base;
+				++p_;
+			}
+			return true;
+		}
+
+		// 音長とタイ
+		bool tie_length_(uint16_t def, uint16_t& len)
+		{
+			if(!length_(def, len)) return false;
+			skip_();
+			while(*p_ == '^') {
+				++p_;
+				uint16_t l = 0;
+				if(!length_(def, l)) return false;
+				len += l;
+				skip_();
+			}
+			return true;
+		}
+
+		bool word_(const char* w)
+		{
+			auto n = std::strlen(w);
+			if(std::strncmp(p_, w, n) != 0) return false;
+			char c = p_[n];
+			if((c >= 'a' && c <= 'z') || c == '_') return false;
+			p_ += n;
+			return true;
+		}
+
+		bool ctrl_arg_(stream_t& s, PSG::CTRL c, int min, int max)
+		{
+			int n;
+			if(!number_(n) || n < min || n > max) return error_("bad argument");
+			event_t e(event_t::type::CTRL);
+			e.code.push_back(ctrl_(c));
+			e.code.push_back(static_cast<uint8_t>(n));
+			s.push_back(e);
+			return true;
+		}
+
+		bool at_(stream_t& s)
+		{
+			event_t e(event_t::type::CTRL);
+			if(word_("sq25")) e.code.push_back(ctrl_(PSG::CTRL::SQ25));
+			else if(word_("sq50")) e.code.push_back(ctrl_(PSG::CTRL::SQ50));
+			else if(word_("sq75")) e.code.push_back(ctrl_(PSG::CTRL::SQ75));
+			else if(word_("tri")) e.code.push_back(ctrl_(PSG::CTRL::TRI));
+			else if(word_("noises")) e.code.push_back(ctrl_(PSG::CTRL::NOISE_S));
+			else if(word_("noise")) e.code.push_back(ctrl_(PSG::CTRL::NOISE));
+			else if(word_("dpcm")) return ctrl_arg_(s, PSG::CTRL::DPCM, 0, 255);
+			else if(word_("atk")) return ctrl_arg_(s, PSG::CTRL::ATTACK, 0, 255);
+			else if(word_("fade")) return ctrl_arg_(s, PSG::CTRL::FADE, 0, 128);
+			else if(word_("fs")) return ctrl_arg_(s, PSG::CTRL::FADE_SPEED, 0, 255);
+			else if(word_("rel")) {
+				int f, g;
+				if(!number_(f) || f < 0 || f > 255) return error_("bad argument");
+				skip_();
+				if(*p_ != ',') return error_("',' expected");
+				++p_;
+				if(!number_(g) || g < 0 || g > 255) return error_("bad argument");
+				e.code.push_back(ctrl_(PSG::CTRL::RELEASE));
+				e.code.push_back(f);
+				e.code.push_back(g);
+			} else if(word_("chout")) {
+				return ctrl_arg_(s, PSG::CTRL::CHOUT, 0, 255);
+			} else if(word_("repeat")) {
+				e.t = event_t::type::TERM;
+				e.code.push_back(ctrl_(PSG::CTRL::REPEAT));
+			} else {
+				return error_("unknown '@' command");
+			}
+			s.push_back(e);
+			return true;
+		}
+
+		bool note_(stream_t& s, int key, uint16_t len)
+		{
+			if(key < 0 || key >= KEY_Q) return error_("key out of range");
+			if(len > 255) return error_("note too long");
+			s.push_back(event_t(event_t::type::NOTE, key, len));
+			return true;
+		}
+
+		bool mml_(stream_t& s, state_t& st)
+		{
+			static const int8_t semi[7] = { 9, 11, 0, 2, 4, 5, 7 };  // a 〜 g
+			for(;;) {
+				skip_();
+				char c = *p_;
+				if(c == 0 || c == ';' || c == '\n' || c == '\r') break;
+				if(st.term) return error_("command after '@repeat'");
+				++p_;
+				int n;
+				if(c >= 'a' && c <= 'g') {
+					int k = st.oct * 12 + semi[c - 'a'];
+					while(*p_ == '+' || *p_ == '#' || *p_ == '-') {
+						k += *p_ == '-' ? -1 : 1;
+						++p_;
+					}
+					uint16_t len;
+					if(!tie_length_(st.len, len)) return false;
+					if(!note_(s, k - 9, len)) return false;
+					st.plain += 2;
+				} else if(c == 'n') {  // n<key>[,len]
+					if(!number_(n)) return error_("bad key");
+					skip_();
+					uint16_t len = st.len;
+					if(*p_ == ',') {
+						++p_;
+						if(!tie_length_(st.len, len)) return false;
+					}
+					if(!note_(s, n, len)) return false;
+					st.plain += 2;
+				} else if(c == 'r') {
+					uint16_t len;
+					if(!tie_length_(st.len, len)) return false;
+					st.plain += (len + 254) / 255 * 2;
+					if(!s.empty() && s.back().t == event_t::type::REST) s.back().len += len;
+					else s.push_back(event_t(event_t::type::REST, 0, len));
+				} else if(c == 'o') {
+					if(!number_(n) || n < 0 || n > 8) return error_("bad octave");
+					st.oct = n;
+				} else if(c == '>') {
+					++st.oct;
+				} else if(c == '<') {
+					--st.oct;
+				} else if(c == 'l') {
+					uint16_t len = 0;
+					if(!length_(16, len)) return false;
+					st.len = len;
+				} else if(c == 't') {
+					if(!ctrl_arg_(s, PSG::CTRL::TEMPO, 1, 255)) return false;
+					st.plain += 2;
+				} else if(c == 'v') {
+					if(!ctrl_arg_(s, PSG::CTRL::VOLUME, 0, 128)) return false;
+					st.plain += 2;
+				} else if(c == 'k') {
+					if(!ctrl_arg_(s, PSG::CTRL::TR, -88, 88)) return false;
+					st.plain += 2;
+				} else if(c == '@') {
+					auto n = s.size();
+					if(!at_(s)) return false;
+					st.plain += s.back().code.size();
+					if(s.size() > n && s.back().t == event_t::type::TERM) st.term = true;
+				} else if(c == '[') {
+					if(st.loop) return error_("nested loop");
+					st.loop = true;
+					s.push_back(event_t(event_t::type::FOR));
+					st.plain += 2;
+				} else if(c == ']') {
+					if(!st.loop) return error_("']' without '['");
+					if(!number_(n) || n < 1 || n > 255) return error_("bad loop count");
+					st.loop = false;
+					for(auto it = s.rbegin(); it != s.rend(); ++it) {
+						if(it->t == event_t::type::FOR) {
+							it->len = n;
+							break;
+						}
+					}
+					s.push_back(event_t(event_t::type::BEFORE));
+					st.plain += 1;
+				} else {
+					std::string t = "unknown command: '";
+					t += c;
+					return error_((t + "'").c_str());
+				}
+			}
+			return true;
+		}
+
+	public:
+		stream_t	ch[CH_NUM];
+
+		parser(const char* file) : file_(file), line_(0), p_(nullptr) { }
+
+		const std::string& get_error() const { return err_; }
+
+		uint32_t get_plain(uint8_t i) const { return state_[i].plain; }
+
+		bool line(const char* text)
+		{
+			++line_;
+			p_ = text;
+			skip_();
+			if(*p_ == 0 || *p_ == ';' || *p_ == '\n' || *p_ == '\r') return true;
+			std::vector<uint8_t> chs;
+			while(*p_ >= 'A' && *p_ <= 'H') {
+				chs.push_back(*p_ - 'A');
+				++p_;
+			}
+			if(chs.empty()) return error_("channel (A 〜 H) expected");
+			auto top = p_;
+			for(auto i : chs) {
+				p_ = top;
+				if(!mml_(ch[i], state_[i])) return false;
+			}
+			return true;
+		}
+
+		// 終端（END）を追加
+		bool finish()
+		{
+			for(uint8_t i = 0; i < CH_NUM; ++i) {
+				if(state_[i].loop) {
+					err_ = std::string(file_) + ": channel " + static_cast<char>('A' + i) + ": '[' without ']'";
+					return false;
+				}
+				if(ch[i].empty() || state_[i].term) continue;
+				event_t e(event_t::type::TERM);
+				e.code.push_back(ctrl_(PSG::CTRL::END));
+				ch[i].push_back(e);
+				state_[i].plain += 1;
+			}
+			return true;
+		}
+	};
+
+
+	//-------------------------------------------------------------//
+	// エンコーダー
+	//-------------------------------------------------------------//
+	static const int KEY_UNKNOWN = -1;
+	static const int KEY_KEEP = -2;  // サブ・スコアにノートが無い
+
+	struct song_t {
+		stream_t	ch[CH_NUM];
+		stream_t	sub[SUB_NUM];
+		int			sub_key[SUB_NUM];  // サブ・スコアを抜けた時のキー
+		uint8_t		sub_num;
+		bool		pack;
+		song_t() : sub_key{ }, sub_num(0), pack(true) { }
+	};
+
+	int pack_idx_(uint16_t len)
+	{
+		for(uint8_t i = 0; i < 8; ++i) {
+			if(PSG::pack_len(i) == len) return i;
+		}
+		return -1;
+	}
+
+	// key は、前のキー（KEY_UNKNOWN で不明）、戻り値は最後のキー
+	int encode_(const song_t& song, const stream_t& s, size_t b, size_t e, int key, std::vector<uint8_t>* out)
+	{
+		auto put = [&](uint8_t v) { if(out != nullptr) out->push_back(v); };
+		for(size_t i = b; i < e; ++i) {
+			const auto& ev = s[i];
+			switch(ev.t) {
+			case event_t::type::NOTE:
+				{
+					int d = ev.key - key;
+					int l = pack_idx_(ev.len);
+					if(song.pack && key >= 0 && d >= -7 && d <= 7 && l >= 0) {
+						put(PSG::PACK | (l << 4) | (d + 7));
+					} else {
+						put(ev.key);
+						put(ev.len);
+					}
+					key = ev.key;
+				}
+				break;
+			case event_t::type::REST:
+				{
+					uint16_t r = ev.len;
+					while(r > 255) {
+						put(KEY_Q);
+						put(255);
+						r -= 255;
+					}
+					int l = pack_idx_(r);
+					if(song.pack && l >= 0) {
+						put(PSG::PACK | (l << 4) | PSG::PACK_REST);
+					} else {
+						put(KEY_Q);
+						put(r);
+					}
+				}
+				break;
+			case event_t::type::CTRL:
+			case event_t::type::TERM:
+				for(auto v : ev.code) put(v);
+				break;
+			case event_t::type::FOR:
+				put(ctrl_(PSG::CTRL::FOR));
+				put(ev.len);
+				key = KEY_UNKNOWN;  // ループの先頭は、前のキーが２通り
+				break;
+			case event_t::type::BEFORE:
+				put(ctrl_(PSG::CTRL::BEFORE));
+				break;
+			case event_t::type::CALL:
+				put(ctrl_(PSG::CTRL::CALL0) + ev.key);
+				if(song.sub_key[ev.key] != KEY_KEEP) key = song.sub_key[ev.key];
+				break;
+			}
+		}
+		return key;
+	}
+
+	void encode_sub_(song_t& song, uint8_t idx, std::vector<uint8_t>* out)
+	{
+		const auto& s = song.sub[idx];
+		bool note = false;
+		for(const auto& e : s) {
+			if(e.t == event_t::type::NOTE) note = true;
+		}
+		int key = encode_(song, s, 0, s.size(), KEY_UNKNOWN, out);
+		song.sub_key[idx] = note ? key : KEY_KEEP;
+		if(out != nullptr) out->push_back(ctrl_(PSG::CTRL::RET));
+	}
+
+	uint32_t size_(song_t& song)
+	{
+		std::vector<uint8_t> out;
+		for(uint8_t i = 0; i < song.sub_num; ++i) {
+			encode_sub_(song, i, &out);
+		}
+		for(uint8_t i = 0; i < CH_NUM; ++i) {
+			encode_(song, song.ch[i], 0, song.ch[i].size(), KEY_UNKNOWN, &out);
+		}
+		return out.size();
+	}
+
+	bool sub_event_(const event_t& e)
+	{
+		return e.t == event_t::type::NOTE || e.t == event_t::type::REST || e.t == event_t::type::CTRL;
+	}
+
+	// s[pos] から、seq を CALL idx に置き換える（重ならない様に左から）
+	uint32_t replace_(stream_t& s, const stream_t& seq, uint8_t idx)
+	{
+		uint32_t n = 0;
+		std::string key;
+		for(const auto& e : seq) e.append(key);
+		for(size_t i = 0; (i + seq.size()) <= s.size(); ++i) {
+			std::string t;
+			for(size_t j = 0; j < seq.size(); ++j) s[i + j].append(t);
+			if(t != key) continue;
+			s.erase(s.begin() + i, s.begin() + i + seq.size());
+			s.insert(s.begin() + i, event_t(event_t::type::CALL, idx));
+			++n;
+		}
+		return n;
+	}
+
+	// 繰り返し現れる部分を、サブ・スコアに括り出す（効果が無くなるまで）
+	void dedup_(song_t& song)
+	{
+		struct cand_t {
+			uint8_t		ch;
+			uint32_t	pos;
+			uint32_t	len;
+			int32_t		gain;
+		};
+
+		while(song.sub_num < SUB_NUM) {
+			uint32_t base = size_(song);
+			std::map<std::string, std::vector<std::pair<uint8_t, uint32_t>>> map;
+			for(uint8_t c = 0; c < CH_NUM; ++c) {
+				const auto& s = song.ch[c];
+				for(uint32_t i = 0; i < s.size(); ++i) {
+					std::string key;
+					for(uint32_t l = 1; l <= SUB_MAX && (i + l) <= s.size(); ++l) {
+						if(!sub_event_(s[i + l - 1])) break;
+						s[i + l - 1].append(key);
+						if(l >= 2) map[key].emplace_back(c, i);
+					}
+				}
+			}
+
+			// 見積もり（先頭のノートが不明になる分は、実際のサイズで確認する）
+			std::vector<cand_t> cands;
+			for(const auto& m : map) {
+				const auto& v = m.second;
+				if(v.size() < 2) continue;
+				uint32_t len = 0;
+				{
+					const char* p = m.first.c_str();
+					const char* e = p + m.first.size();
+					while(p < e) {
+						p += 5 + static_cast<uint8_t>(p[4]);
+						++len;
+					}
+				}
+				uint32_t n = 0;
+				uint8_t lc = 0xff;
+				uint32_t end = 0;
+				for(const auto& o : v) {
+					if(o.first != lc || o.second >= end) {
+						++n;
+						lc = o.first;
+						end = o.second + len;
+					}
+				}
+				if(n < 2) continue;
+				const auto& s = song.ch[v[0].first];
+				std::vector<uint8_t> tmp;
+				encode_(song, s, v[0].second, v[0].second + len, KEY_UNKNOWN, &tmp);
+				int32_t gain = static_cast<int32_t>(n) * (static_cast<int32_t>(tmp.size()) - 1)
+					- static_cast<int32_t>(tmp.size()) - 1;
+				if(gain <= 0) continue;
+				cands.push_back({ v[0].first, v[0].second, len, gain });
+			}
+			if(cands.empty()) break;
+			std::sort(cands.begin(), cands.end(), [](const cand_t& a, const cand_t& b) {
+				if(a.gain != b.gain) return a.gain > b.gain;
+				return a.len > b.len;
+			});
+
+			// 上位の候補を実際に置き換えて、一番小さくなるものを採用
+			uint32_t best = base;
+			song_t best_song;
+			uint32_t tries = std::min<uint32_t>(cands.size(), 32);
+			for(uint32_t i = 0; i < tries; ++i) {
+				const auto& c = cands[i];
+				song_t t = song;
+				auto idx = t.sub_num;
+				const auto& s = song.ch[c.ch];
+				t.sub[idx].assign(s.begin() + c.pos, s.begin() + c.pos + c.len);
+				++t.sub_num;
+				uint32_t n = 0;
+				for(uint8_t ch = 0; ch < CH_NUM; ++ch) {
+					n += replace_(t.ch[ch], t.sub[idx], idx);
+				}
+				if(n < 2) continue;
+				auto sz = size_(t);
+				if(sz < best) {
+					best = sz;
+					best_song = t;
+				}
+			}
+			if(best >= base) break;
+			song = best_song;
+		}
+	}
+
+
+	//-------------------------------------------------------------//
+	// 出力
+	//-------------------------------------------------------------//
+	std::string ctrl_name_(uint8_t v)
+	{
+		static const char* tbl[] = {
+			"TR", "SQ25", "SQ50", "SQ75", "TRI", "VOLUME", "FADE", "FADE_SPEED", "TEMPO",
+			"FOR", "BEFORE", "END", "CALL0", "CALL1", "CALL2", "CALL3", "CALL4", "CALL5",
+			"CALL6", "CALL7", "RET", "REPEAT", "ATTACK", "RELEASE", "CHOUT",
+			"NOISE", "NOISE_S", "DPCM"
+		};
+		uint8_t i = v - ctrl_(PSG::CTRL::TR);
+		if(i < (sizeof(tbl) / sizeof(tbl[0]))) return std::string("PSG::CTRL::") + tbl[i];
+		return std::to_string(v);
+	}
+
+	void array_(const std::string& name, const stream_t& s, const std::vector<uint8_t>& code)
+	{
+		std::printf("\tconstexpr PSG::SCORE %s[] = {\n", name.c_str());
+		// イベント単位で改行（１行、最大１６バイト）
+		size_t pos = 0;
+		std::string line;
+		uint32_t n = 0;
+		auto flush = [&]() {
+			if(!line.empty()) std::printf("\t\t%s\n", line.c_str());
+			line.clear();
+			n = 0;
+		};
+		auto put = [&](const std::string& t) {
+			line += t + ",";
+			++n;
+		};
+		for(const auto& e : s) {
+			if(e.t == event_t::type::CTRL || e.t == event_t::type::TERM || e.t == event_t::type::FOR
+				|| e.t == event_t::type::BEFORE || e.t == event_t::type::CALL) {
+				flush();
+				put(ctrl_name_(code[pos]));
+				++pos;
+				size_t len = e.t == event_t::type::FOR ? 1 : (e.code.empty() ? 0 : e.code.size() - 1);
+				for(size_t i = 0; i < len; ++i) {
+					line += " ";
+					put(std::to_string(code[pos]));
+					++pos;
+				}
+				flush();
+			} else {
+				// NOTE、REST（１バイトか、２バイトの繰り返し）
+				auto next = [&]() {
+					char tmp[8];
+					std::snprintf(tmp, sizeof(tmp), "0x%02X", code[pos]);
+					++pos;
+					return std::string(tmp);
+				};
+				uint16_t r = e.t == event_t::type::REST ? e.len : 0;
+				do {
+					if(n >= 16) flush();
+					if(!line.empty()) line += " ";
+					if(code[pos] >= PSG::PACK) {
+						put(next());
+						r = 0;
+					} else {
+						put(next());
+						line += " ";
+						put(std::to_string(code[pos]));
+						r -= std::min<uint16_t>(r, code[pos]);
+						++pos;
+					}
+				} while(r > 0);
+			}
+		}
+		flush();
+		std::printf("\t};\n\n");
+	}
+
+	void output_(const std::string& name, const std::string& src, song_t& song,
+		const std::vector<uint8_t>& chs, uint32_t plain, uint32_t total)
+	{
+		std::printf("#pragma once\n");
+		std::printf("//=====================================================================//\n");
+		std::printf("/*!\t@file\n");
+		std::printf("\t@brief\tPSG スコア（psg_mml で %s から生成） @n\n", src.c_str());
+		std::printf("\t\t\t%s, %u bytes（従来形式 %u bytes）, sub %u\n", name.c_str(), total, plain, song.sub_num);
+		std::printf("    @author 平松邦仁 (hira@rvf-rc45.net)\n");
+		std::printf("\t@copyright\tCopyright (C) 2026 Kunihito Hiramatsu @n\n");
+		std::printf("\t\t\t\tReleased under the MIT license @n\n");
+		std::printf("\t\t\t\thttps://github.com/hirakuni45/R8C/blob/master/LICENSE\n");
+		std::printf("*/\n");
+		std::printf("//=====================================================================//\n");
+		std::printf("#include \"common/psg_mng.hpp\"\n\n");
+		std::printf("namespace {\n\n");
+		std::printf("\ttypedef utils::psg_base PSG;\n\n");
+
+		for(uint8_t i = 0; i < song.sub_num; ++i) {
+			std::vector<uint8_t> code;
+			encode_sub_(song, i, &code);
+			auto s = song.sub[i];
+			event_t e(event_t::type::TERM);
+			e.code.push_back(ctrl_(PSG::CTRL::RET));
+			s.push_back(e);
+			array_(name + "_s" + std::to_string(i) + "_", s, code);
+		}
+		for(auto i : chs) {
+			std::vector<uint8_t> code;
+			encode_(song, song.ch[i], 0, song.ch[i].size(), KEY_UNKNOWN, &code);
+			array_(name + "_" + static_cast<char>('a' + i) + "_", song.ch[i], code);
+		}
+
+		std::printf("\tconstexpr const PSG::SCORE* %s_sub_[%u] = {\n\t\t", name.c_str(), SUB_NUM);
+		for(uint8_t i = 0; i < SUB_NUM; ++i) {
+			if(i < song.sub_num) std::printf("%s_s%u_", name.c_str(), i);
+			else std::printf("nullptr");
+			std::printf(i < (SUB_NUM - 1) ? ", " : "\n");
+		}
+		std::printf("\t};\n\n");
+
+		// チャネル A 〜 最後のチャネル（使わないチャネルは nullptr）
+		uint8_t num = chs.back() + 1;
+		std::printf("\tconstexpr const PSG::SCORE* %s_score_[%u] = {\n\t\t", name.c_str(), num);
+		for(uint8_t i = 0; i < num; ++i) {
+			if(std::find(chs.begin(), chs.end(), i) != chs.end()) std::printf("%s_%c_", name.c_str(), 'a' + i);
+			else std::printf("nullptr");
+			std::printf(i < (num - 1) ? ", " : "\n");
+		}
+		std::printf("\t};\n\n");
+
+		std::printf("\t// サブ・スコアと、チャネル毎のスコアを設定して、演奏を開始\n");
+		std::printf("\ttemplate <class PSG_MNG>\n");
+		std::printf("\tvoid %s_start_(PSG_MNG& psg)\n\t{\n", name.c_str());
+		std::printf("\t\tfor(uint8_t i = 0; i < %u; ++i) {\n", SUB_NUM);
+		std::printf("\t\t\tpsg.set_sub_score(i, %s_sub_[i]);\n\t\t}\n", name.c_str());
+		std::printf("\t\tfor(uint8_t i = 0; i < %u; ++i) {\n", num);
+		std::printf("\t\t\tif(%s_score_[i] != nullptr) psg.set_score(i, %s_score_[i]);\n\t\t}\n",
+			name.c_str(), name.c_str());
+		std::printf("\t}\n}\n");
+	}
+
+
+	void help_(const char* cmd)
+	{
+		std::fprintf(stderr, "usage: %s [options] in.mml > out.hpp\n", cmd);
+		std::fprintf(stderr, "  -n name   array name prefix (default: file name)\n");
+		std::fprintf(stderr, "  -p        plain format (no packed notes, no sub-scores)\n");
+		std::fprintf(stderr, "  -s        no sub-scores\n");
+		std::fprintf(stderr, "\n");
+		std::fprintf(stderr, "MML:\n");
+		std::fprintf(stderr, "  A..H mml     channel (\"AB mml\" for both)\n");
+		std::fprintf(stderr, "  cdefgab[+#-][len][.][^len]  note, len: 1,2,4,8,16,32,64 or %%n (64 = whole)\n");
+		std::fprintf(stderr, "  r[len]  rest, n<key>[,len]  key number (0:A0 .. 87:C8, 0..15 for noise/dpcm)\n");
+		std::fprintf(stderr, "  o<n> > < l<len>  octave, default length\n");
+		std::fprintf(stderr, "  t<n> v<n> k<n>   tempo, volume, transpose\n");
+		std::fprintf(stderr, "  [ ... ]<n>       loop (no nesting)\n");
+		std::fprintf(stderr, "  @sq25 @sq50 @sq75 @tri @noise @noises @dpcm<n>\n");
+		std::fprintf(stderr, "  @atk<n> @rel<frame>,<gain> @fade<n> @fs<n> @chout<n> @repeat\n");
+		std::fprintf(stderr, "  ; comment\n");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::string name;
+	std::string file;
+	bool pack = true;
+	bool sub = true;
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-n" && (i + 1) < argc) name = argv[++i];
+		else if(p == "-p") pack = sub = false;
+		else if(p == "-s") sub = false;
+		else if(p[0] == '-' || !file.empty()) {
+			help_(argv[0]);
+			return 1;
+		} else file = p;
+	}
+	if(file.empty()) {
+		help_(argv[0]);
+		return 1;
+	}
+	if(name.empty()) {
+		auto pos = file.find_last_of('/');
+		name = pos == std::string::npos ? file : file.substr(pos + 1);
+		pos = name.find('.');
+		if(pos != std::string::npos) name = name.substr(0, pos);
+	}
+
+	FILE* fp = std::fopen(file.c_str(), "rb");
+	if(fp == nullptr) {
+		std::fprintf(stderr, "Can't open MML: '%s'\n", file.c_str());
+		return 1;
+	}
+	parser mml(file.c_str());
+	char tmp[1024];
+	bool ok = true;
+	while(ok && std::fgets(tmp, sizeof(tmp), fp) != nullptr) {
+		ok = mml.line(tmp);
+	}
+	std::fclose(fp);
+	if(!ok || !mml.finish()) {
+		std::fprintf(stderr, "%s\n", mml.get_error().c_str());
+		return 1;
+	}
+
+	song_t song;
+	song.pack = pack;
+	std::vector<uint8_t> chs;
+	uint32_t plain = 0;
+	for(uint8_t i = 0; i < CH_NUM; ++i) {
+		song.ch[i] = mml.ch[i];
+		if(song.ch[i].empty()) continue;
+		chs.push_back(i);
+		plain += mml.get_plain(i);
+	}
+	if(chs.empty()) {
+		std::fprintf(stderr, "No channel in: '%s'\n", file.c_str());
+		return 1;
+	}
+
+	uint32_t packed = size_(song);
+	if(sub) dedup_(song);
+	uint32_t total = size_(song);
+
+	for(auto i : chs) {
+		std::vector<uint8_t> code;
+		encode_(song, song.ch[i], 0, song.ch[i].size(), KEY_UNKNOWN, &code);
+		std::fprintf(stderr, "%c: %4u bytes (plain %4u)\n", 'A' + i,
+			static_cast<unsigned>(code.size()), mml.get_plain(i));
+	}
+	for(uint8_t i = 0; i < song.sub_num; ++i) {
+		std::vector<uint8_t> code;
+		encode_sub_(song, i, &code);
+		std::fprintf(stderr, "S%u: %3u bytes, %u events\n", i,
+			static_cast<unsigned>(code.size()), static_cast<unsigned>(song.sub[i].size()));
+	}
+	std::fprintf(stderr, "%s: plain %u, packed %u, total %u bytes (%.1f%%)\n", name.c_str(),
+		plain, packed, total, plain > 0 ? 100.0 * total / plain : 0.0);
+
+	auto pos = file.find_last_of('/');
+	output_(name, pos == std::string::npos ? file : file.substr(pos + 1), song, chs, plain, total);
+	return 0;
+}
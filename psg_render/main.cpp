@@ -0,0 +1,431 @@
+//=====================================================================//
+/*!	@file
+	@brief	psg_mng レンダリング・ツール @n
+			・PSG_sample の楽曲を、TICK 毎に render/service して、@n
+			　８ビット・モノラルの WAV ファイルに書き出す @n
+			・チャネル毎のコマンド数、発音サンプル数と、@n
+			　１ TICK の最大負荷（R8C のサイクル数の概算）を表示 @n
+			・WAV ファイルを、DPCM サンプル（１ビット／４ビット）の @n
+			　ヘッダーに変換する
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2026 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/R8C/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "PSG_sample/score.hpp"
+
+extern "C" {
+	// CHOUT コマンドの文字は、標準エラーに出す
+	void sci_putch(char ch) { std::fputc(ch, stderr); }
+}
+
+namespace {
+
+	static const uint16_t TICK = 100;
+	static const uint16_t CNUM = 3;
+
+	// F_CLK(20MHz) / 4 / 256、LOW_PROFILE は F_CLK / 8 / 256
+	static const uint16_t SAMPLE = 19531;
+	static const uint16_t SAMPLE_LOW = 9765;
+
+	struct song_t {
+		const char*			name;
+		const PSG::SCORE*	score[CNUM];
+	};
+
+	const song_t song_[] = {
+		{ "song", { ladutorm_a_, ladutorm_b_, nullptr } },
+		{ "test", { score_test_, nullptr, nullptr } },
+		{ "drum", { score_drum_, nullptr, nullptr } },
+		{ "band", { ladutorm_a_, ladutorm_b_, score_drum_ } },
+	};
+
+
+	void put16_(std::vector<uint8_t>& out, uint16_t v)
+	{
+		out.push_back(v);
+		out.push_back(v >> 8);
+	}
+
+
+	void put32_(std::vector<uint8_t>& out, uint32_t v)
+	{
+		put16_(out, v);
+		put16_(out, v >> 16);
+	}
+
+
+	bool write_wav_(const char* file, const std::vector<uint8_t>& wav, uint16_t rate)
+	{
+		std::vector<uint8_t> h;
+		h.insert(h.end(), { 'R', 'I', 'F', 'F' });
+		put32_(h, 36 + wav.size());
+		h.insert(h.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+		put32_(h, 16);
+		put16_(h, 1);  // PCM
+		put16_(h, 1);  // mono
+		put32_(h, rate);
+		put32_(h, rate);
+		put16_(h, 1);
+		put16_(h, 8);
+		h.insert(h.end(), { 'd', 'a', 't', 'a' });
+		put32_(h, wav.size());
+
+		FILE* fp = std::fopen(file, "wb");
+		if(fp == nullptr) return false;
+		std::fwrite(&h[0], 1, h.size(), fp);
+		if(!wav.empty()) std::fwrite(&wav[0], 1, wav.size(), fp);
+		std::fclose(fp);
+		return true;
+	}
+
+
+	// PCM の WAV を読み込む（最初のチャネルを、-32768 〜 32767 で返す）
+	bool read_wav_(const char* file, std::vector<int16_t>& out, uint32_t& rate)
+	{
+		FILE* fp = std::fopen(file, "rb");
+		if(fp == nullptr) return false;
+		std::vector<uint8_t> d;
+		int ch;
+		while((ch = std::fgetc(fp)) != EOF) d.push_back(ch);
+		std::fclose(fp);
+
+		auto get16 = [&](uint32_t i) { return static_cast<uint16_t>(d[i] | (d[i + 1] << 8)); };
+		auto get32 = [&](uint32_t i) { return static_cast<uint32_t>(get16(i) | (get16(i + 2) << 16)); };
+
+		if(d.size() < 12 || std::memcmp(&d[0], "RIFF", 4) != 0 || std::memcmp(&d[8], "WAVE", 4) != 0) {
+			return false;
+		}
+		uint16_t chs = 0;
+		uint16_t bits = 0;
+		uint32_t pos = 12;
+		while((pos + 8) <= d.size()) {
+			uint32_t len = get32(pos + 4);
+			uint32_t top = pos + 8;
+			if((top + len) > d.size()) len = d.size() - top;
+			if(std::memcmp(&d[pos], "fmt ", 4) == 0 && len >= 16) {
+				if(get16(top) != 1) return false;
+				chs = get16(top + 2);
+				rate = get32(top + 4);
+				bits = get16(top + 14);
+			} else if(std::memcmp(&d[pos], "data", 4) == 0) {
+				if(chs == 0 || (bits != 8 && bits != 16)) return false;
+				uint32_t step = chs * bits / 8;
+				for(uint32_t i = 0; (i + step) <= len; i += step) {
+					if(bits == 8) out.push_back((d[top + i] - 128) << 8);
+					else out.push_back(static_cast<int16_t>(get16(top + i)));
+				}
+				return true;
+			}
+			pos = top + len + (len & 1);
+		}
+		return false;
+	}
+
+
+	// DPCM に変換して、ヘッダーを標準出力に出す
+	int encode_(const char* name, const char* file, bool bit4, uint32_t rate)
+	{
+		std::vector<int16_t> src;
+		uint32_t src_rate = 0;
+		if(!read_wav_(file, src, src_rate) || src.empty()) {
+			std::fprintf(stderr, "Can't read WAV: '%s'\n", file);
+			return 1;
+		}
+
+		// 線形補間で再生レートに変換して、0 〜 127 にする
+		std::vector<uint8_t> lvl;
+		for(uint32_t i = 0; ; ++i) {
+			double t = static_cast<double>(i) * src_rate / rate;
+			uint32_t j = static_cast<uint32_t>(t);
+			if((j + 1) >= src.size()) break;
+			double v = src[j] + (src[j + 1] - src[j]) * (t - j);
+			lvl.push_back(static_cast<uint8_t>((v + 32768.0) / 512.0));
+		}
+
+		static const int8_t delta[16] = { 0, 1, 2, 4, 6, 9, 13, 18, -24, -18, -13, -9, -6, -4, -2, -1 };
+		uint8_t init = lvl.empty() ? 64 : lvl[0];
+		int16_t c = init;
+		std::vector<uint8_t> out;
+		uint8_t d = 0;
+		uint8_t b = 0;
+		for(auto x : lvl) {
+			if(bit4) {
+				uint8_t best = 0;
+				int16_t err = 256;
+				for(uint8_t n = 0; n < 16; ++n) {
+					int16_t v = c + delta[n];
+					if(v < 0) v = 0;
+					else if(v > 127) v = 127;
+					if(std::abs(v - x) < err) {
+						err = std::abs(v - x);
+						best = n;
+					}
+				}
+				c += delta[best];
+				d |= best << b;
+				b += 4;
+			} else {
+				if(x > c) {
+					c += 2;
+					d |= 1 << b;
+				} else {
+					c -= 2;
+				}
+				++b;
+			}
+			if(c < 0) c = 0;
+			else if(c > 127) c = 127;
+			if(b >= 8) {
+				out.push_back(d);
+				d = 0;
+				b = 0;
+			}
+		}
+		if(b > 0) out.push_back(d);
+
+		std::printf("#pragma once\n");
+		std::printf("//=====================================================================//\n");
+		std::printf("/*!\t@file\n");
+		std::printf("\t@brief\tDPCM サンプル（psg_render で生成） @n\n");
+		std::printf("\t\t\t%s, %u bytes, %u Hz, %d bits\n", name,
+			static_cast<unsigned>(out.size()), rate, bit4 ? 4 : 1);
+		std::printf("    @author 平松邦仁 (hira@rvf-rc45.net)\n");
+		std::printf("\t@copyright\tCopyright (C) 2026 Kunihito Hiramatsu @n\n");
+		std::printf("\t\t\t\tReleased under the MIT license @n\n");
+		std::printf("\t\t\t\thttps://github.com/hirakuni45/R8C/blob/master/LICENSE\n");
+		std::printf("*/\n");
+		std::printf("//=====================================================================//\n");
+		std::printf("#include \"common/psg_mng.hpp\"\n");
+		std::printf("\n");
+		std::printf("namespace {\n");
+		std::printf("\n");
+		std::printf("\tconstexpr uint8_t %s_data_[] = {", name);
+		for(uint32_t i = 0; i < out.size(); ++i) {
+			if((i % 16) == 0) std::printf("\n\t\t");
+			std::printf("0x%02X,", out[i]);
+		}
+		std::printf("\n\t};\n");
+		std::printf("\n");
+		std::printf("\tconstexpr utils::psg_base::DPCM %s_ = {\n", name);
+		std::printf("\t\t%s_data_, sizeof(%s_data_), %u, %s\n", name, name, init, bit4 ? "true" : "false");
+		std::printf("\t};\n");
+		std::printf("}\n");
+		return 0;
+	}
+
+
+	// R8C の１サンプル当たりの概算サイクル数（render の内側ループの命令数からの目安） @n
+	// 実機で計測した値があれば、ここを書き換える
+	static const uint16_t CYC_SQ    = 22;	///< 矩形波（チャネル毎）
+	static const uint16_t CYC_TRI   = 36;	///< 三角波（チャネル毎）
+	static const uint16_t CYC_NOISE = 28;	///< ノイズ（チャネル毎）
+	static const uint16_t CYC_DPCM  = 26;	///< DPCM（チャネル毎）
+	static const uint16_t CYC_MIX   = 30;	///< 合成バッファのクリアと正規化（サンプル毎）
+	static const uint16_t CYC_CMD   = 80;	///< スコア・コマンド１個
+
+	uint32_t f_clk_ = 20000000;
+
+	enum class WT : uint8_t { SQ, TRI, NOISE, DPCM, NUM };
+
+	WT wt_(PSG::WTYPE wt)
+	{
+		switch(wt) {
+		case PSG::WTYPE::TRI:
+			return WT::TRI;
+		case PSG::WTYPE::NOISE:
+		case PSG::WTYPE::NOISE_S:
+			return WT::NOISE;
+		case PSG::WTYPE::DPCM:
+			return WT::DPCM;
+		default:
+			return WT::SQ;
+		}
+	}
+
+	const uint16_t cyc_tbl_[static_cast<uint8_t>(WT::NUM)] = { CYC_SQ, CYC_TRI, CYC_NOISE, CYC_DPCM };
+
+	struct channel_prof_t {
+		uint32_t	notes;		///< 発音したノート数
+		uint32_t	cmds;		///< スコア・コマンド数
+		uint8_t		cmd_max;	///< １ TICK の最大コマンド数
+		uint32_t	smp[static_cast<uint8_t>(WT::NUM)];	///< 波形タイプ毎の発音サンプル数
+	};
+
+	struct prof_t {
+		channel_prof_t	ch[CNUM];
+		uint32_t	ticks;
+		uint8_t		voice_max;		///< 同時発音数の最大
+		uint32_t	cyc_max;		///< １ TICK の概算サイクル数の最大
+		uint32_t	cyc_tick;		///< 最大になった TICK
+		double		host;			///< ホストの処理時間の合計（us）
+	};
+
+
+	template <uint16_t SMP, uint16_t BSIZE>
+	void render_(const song_t& song, uint32_t limit, std::vector<uint8_t>& out, prof_t& prof)
+	{
+		typedef utils::psg_mng<SMP, TICK, BSIZE, CNUM> PSG_MNG;
+		PSG_MNG psg;
+
+		psg.set_dpcm(0, &dpcm_kick_);
+		for(uint8_t i = 0; i < 8; ++i) psg.set_sub_score(i, ladutorm_sub_[i]);
+		for(uint8_t i = 0; i < CNUM; ++i) {
+			if(song.score[i] != nullptr) psg.set_score(i, song.score[i]);
+		}
+
+		prof = prof_t();
+		out.reserve(static_cast<size_t>(limit) * SMP);
+		uint32_t done = 0;
+		uint16_t pos = 0;
+		for(uint32_t tick = 0; tick < limit * TICK; ++tick) {
+			bool end = true;
+			for(uint8_t i = 0; i < CNUM; ++i) {
+				if(!psg.is_end(i)) end = false;
+			}
+			if(end) break;
+
+			uint16_t len = (tick + 1) * SMP / TICK - done;
+
+			// 発音中のチャネルは、service まで変化しない
+			uint32_t cyc = CYC_MIX * len;
+			uint8_t voice = 0;
+			for(uint8_t i = 0; i < CNUM; ++i) {
+				if(!psg.is_sound(i)) continue;
+				auto wt = static_cast<uint8_t>(wt_(psg.get_wtype(i)));
+				prof.ch[i].smp[wt] += len;
+				cyc += static_cast<uint32_t>(cyc_tbl_[wt]) * len;
+				++voice;
+			}
+			if(voice > prof.voice_max) prof.voice_max = voice;
+
+			auto t0 = std::chrono::steady_clock::now();
+			psg.render(len);
+			for(uint8_t i = 0; i < CNUM; ++i) {
+				uint8_t n = psg.service(i);
+				auto& ch = prof.ch[i];
+				ch.cmds += n;
+				if(n > ch.cmd_max) ch.cmd_max = n;
+				if(n > 0 && psg.is_sound(i)) ++ch.notes;
+				cyc += CYC_CMD * n;
+			}
+			auto t1 = std::chrono::steady_clock::now();
+			prof.host += std::chrono::duration<double, std::micro>(t1 - t0).count();
+			if(cyc > prof.cyc_max) {
+				prof.cyc_max = cyc;
+				prof.cyc_tick = tick;
+			}
+
+			for(uint16_t i = 0; i < len; ++i) {
+				out.push_back(psg.get_wav(pos));
+				pos = (pos + 1) & (BSIZE - 1);
+			}
+			done += len;
+			++prof.ticks;
+		}
+	}
+
+
+	void report_(const prof_t& prof, uint16_t smp)
+	{
+		std::printf("ch  notes   cmds  cmd/tick  samples (SQ / TRI / NOISE / DPCM)\n");
+		for(uint8_t i = 0; i < CNUM; ++i) {
+			const auto& ch = prof.ch[i];
+			std::printf("%2u %6u %6u %9u  %u / %u / %u / %u\n", i, ch.notes, ch.cmds, ch.cmd_max,
+				ch.smp[0], ch.smp[1], ch.smp[2], ch.smp[3]);
+		}
+
+		double spt = static_cast<double>(smp) / TICK;
+		uint16_t bsize = 1;
+		while(bsize < (spt * 2)) bsize <<= 1;
+		std::printf("samples/tick: %.1f, BSIZE >= %u, max voices: %u\n", spt, bsize, prof.voice_max);
+
+		uint32_t budget = f_clk_ / TICK;
+		std::printf("worst tick: %.2f s, %u cycles (estimate), %.1f %% of %.1f MHz\n",
+			static_cast<double>(prof.cyc_tick) / TICK, prof.cyc_max,
+			100.0 * prof.cyc_max / budget, f_clk_ / 1e6);
+		std::printf("host: %.2f us/tick (average)\n", prof.ticks > 0 ? prof.host / prof.ticks : 0.0);
+	}
+
+
+	void help_(const char* cmd)
+	{
+		std::printf("usage:\n");
+		std::printf("  %s [options] song out.wav\n", cmd);
+		std::printf("    -t seconds   time limit (default 180)\n");
+		std::printf("    -l           low profile sample rate (%u Hz, default %u Hz)\n", SAMPLE_LOW, SAMPLE);
+		std::printf("    -c MHz       CPU clock for the load estimate (default 20)\n");
+		std::printf("    out.wav: '-' profile only\n");
+		std::printf("    song: ");
+		for(const auto& s : song_) std::printf("%s ", s.name);
+		std::printf("\n");
+		std::printf("  %s -e1|-e4 -f rate name in.wav > name.hpp\n", cmd);
+		std::printf("    encode WAV to 1/4 bits DPCM at rate (Hz)\n");
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	uint32_t limit = 180;
+	bool low = false;
+	int enc = 0;
+	uint32_t rate = 0;
+	std::vector<std::string> args;
+	for(int i = 1; i < argc; ++i) {
+		std::string p = argv[i];
+		if(p == "-t" && (i + 1) < argc) limit = std::atoi(argv[++i]);
+		else if(p == "-f" && (i + 1) < argc) rate = std::atoi(argv[++i]);
+		else if(p == "-c" && (i + 1) < argc) f_clk_ = std::atof(argv[++i]) * 1e6;
+		else if(p == "-l") low = true;
+		else if(p == "-e1") enc = 1;
+		else if(p == "-e4") enc = 4;
+		else if(p[0] == '-' && p.size() > 1) {
+			help_(argv[0]);
+			return 1;
+		} else args.push_back(p);
+	}
+
+	if(enc != 0) {
+		if(args.size() != 2 || rate == 0) {
+			help_(argv[0]);
+			return 1;
+		}
+		return encode_(args[0].c_str(), args[1].c_str(), enc == 4, rate);
+	}
+
+	if(args.size() != 2) {
+		help_(argv[0]);
+		return 1;
+	}
+	const song_t* song = nullptr;
+	for(const auto& s : song_) {
+		if(args[0] == s.name) song = &s;
+	}
+	if(song == nullptr) {
+		std::fprintf(stderr, "Song not found: '%s'\n", args[0].c_str());
+		return 1;
+	}
+
+	std::vector<uint8_t> wav;
+	prof_t prof;
+	if(low) render_<SAMPLE_LOW, 256>(*song, limit, wav, prof);
+	else render_<SAMPLE, 512>(*song, limit, wav, prof);
+
+	uint16_t smp = low ? SAMPLE_LOW : SAMPLE;
+	if(args[1] != "-" && !write_wav_(args[1].c_str(), wav, smp)) {
+		std::fprintf(stderr, "Can't write WAV: '%s'\n", args[1].c_str());
+		return 1;
+	}
+	std::printf("%s: %u samples (%.2f s), %u Hz\n", song->name,
+		static_cast<unsigned>(wav.size()), static_cast<double>(wav.size()) / smp, smp);
+	report_(prof, smp);
+	return 0;
+}